@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <Api/Searcher/DeterministicSearcher.h>
+#include <Api/Searcher/McmcSearcher.h>
+#include <Api/Searcher/ParetoSearcher.h>
+#include <Api/Searcher/RandomSearcher.h>
+#include <Kernel/KernelManager.h>
+#include <KernelArgument/KernelArgumentManager.h>
+#include <TuningRunner/ConfigurationData.h>
+#include <Utility/Logger/Logger.h>
+#include <Utility/Timer/ScopeTimer.h>
+
+// Benchmark of searcher and configuration space overhead on synthetic tuning spaces. No compute device is needed, kernel
+// durations are computed by an analytic cost function. Usage: SearcherBenchmark [maxExponent] [steps] [outputFile]
+
+const uint64_t valuesPerParameter = 10;
+const std::vector<double> constraintDensities = {0.0, 0.5, 1.0};
+
+struct SearcherFactory
+{
+    std::string m_Name;
+    std::function<std::unique_ptr<ktt::Searcher>()> m_Create;
+};
+
+const std::vector<SearcherFactory> searcherFactories =
+{
+    {"Deterministic", []() { return std::make_unique<ktt::DeterministicSearcher>(); }},
+    {"Random", []() { return std::make_unique<ktt::RandomSearcher>(); }},
+    {"MCMC", []() { return std::make_unique<ktt::McmcSearcher>(); }},
+    {"Pareto", []() { return std::make_unique<ktt::ParetoSearcher>(); }}
+};
+
+std::string GetParameterName(const size_t index)
+{
+    return "p" + std::to_string(index);
+}
+
+// Heap allocations of the whole benchmark are tracked, so that memory footprint of configuration data and searchers can be
+// measured directly instead of through resident memory of the process, which rarely changes after the first allocations.
+std::atomic<uint64_t> allocatedMemory{0};
+std::atomic<uint64_t> peakMemory{0};
+const size_t allocationHeader = alignof(std::max_align_t);
+
+void* operator new(size_t size)
+{
+    void* memory = std::malloc(size + allocationHeader);
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *static_cast<size_t*>(memory) = size;
+    const uint64_t current = allocatedMemory += size;
+    uint64_t peak = peakMemory.load();
+
+    while (current > peak && !peakMemory.compare_exchange_weak(peak, current))
+    {}
+
+    return static_cast<char*>(memory) + allocationHeader;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    void* memory = static_cast<char*>(pointer) - allocationHeader;
+    allocatedMemory -= *static_cast<size_t*>(memory);
+    std::free(memory);
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+// Smooth cost function with a single optimum, parameter weights make some dimensions more important than others.
+double ComputeCost(const ktt::KernelConfiguration& configuration)
+{
+    double cost = 1.0;
+
+    for (const auto& pair : configuration.GetPairs())
+    {
+        const size_t index = std::stoul(pair.GetName().substr(1));
+        const double target = static_cast<double>((3 * index + 7) % valuesPerParameter);
+        const double weight = static_cast<double>(1 + index % 3);
+        const double difference = static_cast<double>(pair.GetValueUint()) - target;
+        cost += weight * difference * difference / 81.0;
+    }
+
+    return cost;
+}
+
+ktt::KernelResult CreateResult(const std::string& kernelName, const ktt::KernelConfiguration& configuration)
+{
+    const double cost = ComputeCost(configuration);
+    ktt::ComputationResult computation("benchmarkKernel");
+    computation.SetDurationData(static_cast<ktt::Nanoseconds>(cost * 100'000.0), 0, 0);
+    return ktt::KernelResult(kernelName, configuration, {computation});
+}
+
+// Creates kernel with exponent parameters, each with 10 values. Constraint density controls the fraction of parameter pairs
+// which are bound by a constraint removing roughly a quarter of their combinations.
+ktt::KernelId CreateKernel(ktt::KernelManager& manager, const ktt::KernelDefinitionId definition, const size_t exponent,
+    const double density)
+{
+    const ktt::KernelId id = manager.CreateKernel("kernel" + std::to_string(exponent) + "_" + std::to_string(density), {definition});
+
+    for (size_t i = 0; i < exponent; ++i)
+    {
+        std::vector<ktt::ParameterValue> values;
+
+        for (uint64_t value = 0; value < valuesPerParameter; ++value)
+        {
+            values.push_back(value);
+        }
+
+        manager.AddParameter(id, GetParameterName(i), values, "");
+    }
+
+    const size_t pairsCount = exponent / 2;
+    const auto constrainedPairs = static_cast<size_t>(std::round(density * static_cast<double>(pairsCount)));
+
+    for (size_t i = 0; i < constrainedPairs; ++i)
+    {
+        manager.AddConstraint(id, {GetParameterName(2 * i), GetParameterName(2 * i + 1)}, [](const std::vector<uint64_t>& values)
+        {
+            return (values[0] + values[1]) % 4 != 3;
+        });
+    }
+
+    return id;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxExponent = 9;
+    size_t steps = 500;
+    std::string outputFile = "SearcherBenchmark.csv";
+
+    if (argc >= 2)
+    {
+        maxExponent = std::stoul(std::string(argv[1]));
+
+        if (argc >= 3)
+        {
+            steps = std::stoul(std::string(argv[2]));
+
+            if (argc >= 4)
+            {
+                outputFile = std::string(argv[3]);
+            }
+        }
+    }
+
+    ktt::Logger::GetLogger().SetLoggingLevel(ktt::LoggingLevel::Warning);
+
+    std::ofstream output(outputFile);
+    output << "Searcher,Configurations,ConstraintDensity,Step,LatencyNs,BestCost" << std::endl;
+
+    std::cout << std::left << std::setw(14) << "Searcher" << std::setw(14) << "Configs" << std::setw(9) << "Density"
+        << std::setw(12) << "Init [ms]" << std::setw(12) << "Memory [MB]" << std::setw(12) << "Peak [MB]" << std::setw(12)
+        << "Mean [us]" << std::setw(12) << "P95 [us]" << std::setw(12) << "Max [us]" << std::setw(10) << "Best" << std::endl;
+
+    for (size_t exponent = 3; exponent <= maxExponent; ++exponent)
+    {
+        for (const double density : constraintDensities)
+        {
+            for (const auto& factory : searcherFactories)
+            {
+                ktt::KernelArgumentManager argumentManager;
+                ktt::KernelManager kernelManager(argumentManager);
+                const ktt::KernelDefinitionId definition = kernelManager.AddKernelDefinition("benchmarkKernel", "",
+                    ktt::DimensionVector(), ktt::DimensionVector());
+                const ktt::KernelId id = CreateKernel(kernelManager, definition, exponent, density);
+                const auto& kernel = kernelManager.GetKernel(id);
+
+                auto searcher = factory.m_Create();
+                std::unique_ptr<ktt::ConfigurationData> data;
+                const uint64_t initialMemory = allocatedMemory.load();
+                peakMemory = initialMemory;
+
+                const ktt::Nanoseconds initTime = ktt::RunScopeTimer([&data, &searcher, &kernel]()
+                {
+                    data = std::make_unique<ktt::ConfigurationData>(*searcher, kernel);
+                });
+
+                const uint64_t configurations = data->GetTotalConfigurationsCount();
+                std::vector<ktt::Nanoseconds> latencies;
+                double bestCost = std::numeric_limits<double>::max();
+
+                for (size_t step = 0; step < steps && !data->IsProcessed(); ++step)
+                {
+                    const auto result = CreateResult(kernel.GetName(), data->GetCurrentConfiguration());
+                    bestCost = std::min(bestCost, ComputeCost(result.GetConfiguration()));
+
+                    const ktt::Nanoseconds latency = ktt::RunScopeTimer([&data, &result]()
+                    {
+                        data->CalculateNextConfiguration(result);
+                    });
+
+                    latencies.push_back(latency);
+                    output << factory.m_Name << "," << configurations << "," << density << "," << step << "," << latency << ","
+                        << bestCost << std::endl;
+                }
+
+                const uint64_t finalMemory = allocatedMemory.load();
+                const double memory = static_cast<double>(finalMemory > initialMemory ? finalMemory - initialMemory : 0) / 1'048'576.0;
+                const double peak = static_cast<double>(peakMemory.load() - initialMemory) / 1'048'576.0;
+                double mean = 0.0;
+
+                for (const auto latency : latencies)
+                {
+                    mean += static_cast<double>(latency);
+                }
+
+                mean /= static_cast<double>(std::max(static_cast<size_t>(1), latencies.size()));
+                std::sort(latencies.begin(), latencies.end());
+                const ktt::Nanoseconds p95 = latencies.empty() ? 0 : latencies[latencies.size() * 95 / 100];
+                const ktt::Nanoseconds maximum = latencies.empty() ? 0 : latencies.back();
+
+                std::cout << std::left << std::setw(14) << factory.m_Name << std::setw(14) << configurations << std::setw(9)
+                    << density << std::setw(12) << static_cast<double>(initTime) / 1'000'000.0 << std::setw(12) << memory
+                    << std::setw(12) << peak << std::setw(12) << mean / 1'000.0 << std::setw(12)
+                    << static_cast<double>(p95) / 1'000.0 << std::setw(12) << static_cast<double>(maximum) / 1'000.0 << std::setw(10) << bestCost << std::endl;
+            }
+        }
+    }
+
+    std::cout << "Per-step latencies and convergence curves were saved to " << outputFile << std::endl;
+    return 0;
+}
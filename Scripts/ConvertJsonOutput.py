@@ -15,8 +15,8 @@ ktt_result_status_mapping = {
         "ComputationFailed":"runtime",
         "ValidationFailed":"correctness",
         "CompilationFailed":"compile",
-        "DeviceLimitsExceeded":"runtime"
-        # timeout is marked as ComputationFailed in KTT
+        "DeviceLimitsExceeded":"runtime",
+        "Timeout":"timeout"
         # constraints is marked as CompilationFailed in KTT
         }
 
@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+
+"""Export pickled tree-based model (decision tree or ensemble of trees) to JSON format readable by native profile-based searcher.
+
+Usage:
+  export_model_to_json.py -i <model> [-o <output>]
+
+Options:
+  -h Show this screen.
+  -i Pickled model file generated by generate_decision_tree_model.py, metadata are loaded from <model>.metadata.json.
+  -o Output JSON file, defaults to <model>.json.
+"""
+
+import json
+import pickle
+from docopt import docopt
+
+
+def exportTree(tree):
+    # node values have shape (nodes, outputs, 1) for regression trees
+    return {
+        'LeftChildren': tree.children_left.tolist(),
+        'RightChildren': tree.children_right.tolist(),
+        'Features': tree.feature.tolist(),
+        'Thresholds': tree.threshold.tolist(),
+        'Values': [[float(output[0]) for output in node] for node in tree.value]
+    }
+
+
+def exportModel(model, metadata, filename):
+    if hasattr(model, 'estimators_'):
+        trees = [exportTree(estimator.tree_) for estimator in model.estimators_]
+    elif hasattr(model, 'tree_'):
+        trees = [exportTree(model.tree_)]
+    else:
+        raise ValueError('Only decision trees and ensembles of decision trees can be exported.')
+
+    output = {
+        'ComputeCapability': metadata['cc'],
+        'TuningParameters': metadata['tp'],
+        'ProfilingCounters': metadata['pc'],
+        'Trees': trees
+    }
+
+    with open(filename, 'w') as outputFile:
+        json.dump(output, outputFile)
+
+
+if __name__ == '__main__':
+    arguments = docopt(__doc__)
+    modelFile = arguments['-i']
+    outputFile = arguments['-o'] if arguments['-o'] else modelFile + '.json'
+
+    with open(modelFile, 'rb') as inputFile:
+        model = pickle.load(inputFile)
+    with open(modelFile + '.metadata.json', 'r') as metadataFile:
+        metadata = json.load(metadataFile)
+
+    exportModel(model, metadata, outputFile)
+    print('Model exported to', outputFile)
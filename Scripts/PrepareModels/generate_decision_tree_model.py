@@ -47,6 +47,7 @@ import pandas as pd
 import datetime
 from docopt import docopt
 import json
+from export_model_to_json import exportModel
 
 
 
@@ -135,9 +136,11 @@ if __name__ == '__main__':
         for col in rangeC:
             metadata['pc'].append(str(data.columns[col]))
         print(metadata)
-        filename = filename + ".metadata.json"
-        with open(filename, 'w', ) as fp:
+        metadataFilename = filename + ".metadata.json"
+        with open(metadataFilename, 'w', ) as fp:
             json.dump(metadata, fp, indent=4)
+        # export for native profile-based searcher which does not need Python
+        exportModel(imputer, metadata, filename + ".json")
 
 
     ExprimentEnd = datetime.datetime.now()
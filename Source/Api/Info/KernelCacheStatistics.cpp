@@ -0,0 +1,35 @@
+#include <Api/Info/KernelCacheStatistics.h>
+
+namespace ktt
+{
+
+KernelCacheStatistics::KernelCacheStatistics() :
+    m_HitCount(0),
+    m_MissCount(0),
+    m_EvictionCount(0),
+    m_EntryCount(0),
+    m_MemorySize(0)
+{}
+
+double KernelCacheStatistics::GetHitRate() const
+{
+    const uint64_t loadCount = m_HitCount + m_MissCount;
+
+    if (loadCount == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(m_HitCount) / static_cast<double>(loadCount);
+}
+
+void KernelCacheStatistics::Merge(const KernelCacheStatistics& other)
+{
+    m_HitCount += other.m_HitCount;
+    m_MissCount += other.m_MissCount;
+    m_EvictionCount += other.m_EvictionCount;
+    m_EntryCount += other.m_EntryCount;
+    m_MemorySize += other.m_MemorySize;
+}
+
+} // namespace ktt
@@ -0,0 +1,58 @@
+/** @file KernelCacheStatistics.h
+  * Statistics about usage of compiled kernel cache.
+  */
+#pragma once
+
+#include <cstdint>
+
+#include <KttPlatform.h>
+
+namespace ktt
+{
+
+/** @struct KernelCacheStatistics
+  * Structure which holds statistics about compiled kernel cache. The counters are accumulated over the lifetime of the tuner
+  * and are not reset when the cache is cleared.
+  */
+struct KTT_API KernelCacheStatistics
+{
+public:
+    /** @fn KernelCacheStatistics()
+      * Constructor which initializes all data values to zero.
+      */
+    KernelCacheStatistics();
+
+    /** @fn double GetHitRate() const
+      * Returns fraction of kernel loads which were served from the cache.
+      * @return Ratio of hits to all kernel loads. Zero if no kernel was loaded yet.
+      */
+    double GetHitRate() const;
+
+    /** @fn void Merge(const KernelCacheStatistics& other)
+      * Adds counters of other statistics to these statistics, e.g., to combine statistics of kernel caches on multiple devices.
+      * @param other Statistics which will be added to these statistics.
+      */
+    void Merge(const KernelCacheStatistics& other);
+
+    /** Number of kernel loads which were served from the cache.
+      */
+    uint64_t m_HitCount;
+
+    /** Number of kernel loads which required kernel compilation.
+      */
+    uint64_t m_MissCount;
+
+    /** Number of kernels which were removed from the cache due to exceeded capacity or memory limit.
+      */
+    uint64_t m_EvictionCount;
+
+    /** Number of kernels currently stored in the cache.
+      */
+    uint64_t m_EntryCount;
+
+    /** Total size of binaries of kernels currently stored in the cache in bytes.
+      */
+    uint64_t m_MemorySize;
+};
+
+} // namespace ktt
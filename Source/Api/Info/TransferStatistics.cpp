@@ -0,0 +1,53 @@
+#include <Api/Info/TransferStatistics.h>
+
+namespace ktt
+{
+
+TransferStatistics::TransferStatistics() :
+    m_UploadCount(0),
+    m_UploadedBytes(0),
+    m_UploadTime(0),
+    m_DownloadCount(0),
+    m_DownloadedBytes(0),
+    m_DownloadTime(0),
+    m_StagedTransferCount(0),
+    m_StagingAllocationCount(0),
+    m_StagingReuseCount(0),
+    m_StagingMemorySize(0)
+{}
+
+double TransferStatistics::GetUploadThroughput() const
+{
+    if (m_UploadTime == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(m_UploadedBytes) * 1'000'000'000.0 / static_cast<double>(m_UploadTime);
+}
+
+double TransferStatistics::GetDownloadThroughput() const
+{
+    if (m_DownloadTime == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(m_DownloadedBytes) * 1'000'000'000.0 / static_cast<double>(m_DownloadTime);
+}
+
+void TransferStatistics::Merge(const TransferStatistics& other)
+{
+    m_UploadCount += other.m_UploadCount;
+    m_UploadedBytes += other.m_UploadedBytes;
+    m_UploadTime += other.m_UploadTime;
+    m_DownloadCount += other.m_DownloadCount;
+    m_DownloadedBytes += other.m_DownloadedBytes;
+    m_DownloadTime += other.m_DownloadTime;
+    m_StagedTransferCount += other.m_StagedTransferCount;
+    m_StagingAllocationCount += other.m_StagingAllocationCount;
+    m_StagingReuseCount += other.m_StagingReuseCount;
+    m_StagingMemorySize += other.m_StagingMemorySize;
+}
+
+} // namespace ktt
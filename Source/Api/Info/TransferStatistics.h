@@ -0,0 +1,85 @@
+/** @file TransferStatistics.h
+  * Statistics about data transfers between host and device.
+  */
+#pragma once
+
+#include <cstdint>
+
+#include <KttPlatform.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+/** @struct TransferStatistics
+  * Structure which holds statistics about data transfers between host and device memory. The counters are accumulated over
+  * the lifetime of the tuner. Only transfers with valid duration are included.
+  */
+struct KTT_API TransferStatistics
+{
+public:
+    /** @fn TransferStatistics()
+      * Constructor which initializes all data values to zero.
+      */
+    TransferStatistics();
+
+    /** @fn double GetUploadThroughput() const
+      * Returns average throughput of transfers from host to device.
+      * @return Upload throughput in bytes per second. Zero if no data was uploaded yet.
+      */
+    double GetUploadThroughput() const;
+
+    /** @fn double GetDownloadThroughput() const
+      * Returns average throughput of transfers from device to host.
+      * @return Download throughput in bytes per second. Zero if no data was downloaded yet.
+      */
+    double GetDownloadThroughput() const;
+
+    /** @fn void Merge(const TransferStatistics& other)
+      * Adds counters of other statistics to these statistics, e.g., to combine statistics of transfers on multiple devices.
+      * @param other Statistics which will be added to these statistics.
+      */
+    void Merge(const TransferStatistics& other);
+
+    /** Number of transfers from host to device.
+      */
+    uint64_t m_UploadCount;
+
+    /** Total size of data transferred from host to device in bytes.
+      */
+    uint64_t m_UploadedBytes;
+
+    /** Total duration of transfers from host to device.
+      */
+    Nanoseconds m_UploadTime;
+
+    /** Number of transfers from device to host.
+      */
+    uint64_t m_DownloadCount;
+
+    /** Total size of data transferred from device to host in bytes.
+      */
+    uint64_t m_DownloadedBytes;
+
+    /** Total duration of transfers from device to host.
+      */
+    Nanoseconds m_DownloadTime;
+
+    /** Number of transfers which were performed through staging buffers.
+      */
+    uint64_t m_StagedTransferCount;
+
+    /** Number of staging buffers allocated from compute API.
+      */
+    uint64_t m_StagingAllocationCount;
+
+    /** Number of staging buffer requests which were served by previously allocated buffers.
+      */
+    uint64_t m_StagingReuseCount;
+
+    /** Total size of currently allocated staging buffers in bytes.
+      */
+    uint64_t m_StagingMemorySize;
+};
+
+} // namespace ktt
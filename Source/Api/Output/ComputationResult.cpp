@@ -169,9 +169,12 @@ ComputationResult& ComputationResult::operator=(const ComputationResult& other)
     m_KernelFunction = other.m_KernelFunction;
     m_Duration = other.m_Duration;
     m_Overhead = other.m_Overhead;
+    m_CompilationOverhead = other.m_CompilationOverhead;
     m_GlobalSize = other.m_GlobalSize;
     m_LocalSize = other.m_LocalSize;
     m_PowerUsage = other.m_PowerUsage;
+    m_CompilationData.reset();
+    m_ProfilingData.reset();
 
     if (other.HasCompilationData())
     {
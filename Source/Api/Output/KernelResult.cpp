@@ -1,4 +1,5 @@
 #include <Api/Output/KernelResult.h>
+#include <Api/KttException.h>
 
 namespace ktt
 {
@@ -12,6 +13,8 @@ KernelResult::KernelResult() :
     m_ProfilingRunsOverhead(InvalidDuration),
     m_ProfilingOverhead(InvalidDuration),
     m_CompilationOverhead(InvalidDuration),
+    m_CalibrationOverhead(InvalidDuration),
+    m_DriftCorrection(1.0),
     m_Status(ResultStatus::ComputationFailed)
 {}
 
@@ -26,6 +29,8 @@ KernelResult::KernelResult(const std::string& kernelName, const KernelConfigurat
     m_ProfilingRunsOverhead(0),
     m_ProfilingOverhead(0),
     m_CompilationOverhead(0),
+    m_CalibrationOverhead(0),
+    m_DriftCorrection(1.0),
     m_Status(ResultStatus::ComputationFailed)
 {}
 
@@ -42,6 +47,8 @@ KernelResult::KernelResult(const std::string& kernelName, const KernelConfigurat
     m_ProfilingRunsOverhead(0),
     m_ProfilingOverhead(0),
     m_CompilationOverhead(0),
+    m_CalibrationOverhead(0),
+    m_DriftCorrection(1.0),
     m_Status(ResultStatus::Ok)
 {}
 
@@ -85,6 +92,53 @@ void KernelResult::SetProfilingRunsOverhead(const Nanoseconds overhead)
     m_ProfilingRunsOverhead = overhead;
 }
 
+void KernelResult::SetCalibrationOverhead(const Nanoseconds overhead)
+{
+    m_CalibrationOverhead = overhead;
+}
+
+void KernelResult::SetMeasurementStatistics(const MeasurementStatistics& statistics)
+{
+    m_MeasurementStatistics = statistics;
+}
+
+void KernelResult::SetTuningDevice(const DeviceIndex device)
+{
+    m_TuningDevice = device;
+}
+
+void KernelResult::SetDriftCorrection(const double factor)
+{
+    m_DriftCorrection = factor;
+}
+
+void KernelResult::ApplyDriftCorrection(const double factor)
+{
+    const auto scale = [factor](const Nanoseconds duration)
+    {
+        return static_cast<Nanoseconds>(static_cast<double>(duration) * factor);
+    };
+
+    for (auto& result : m_Results)
+    {
+        result.SetDurationData(scale(result.GetDuration()), result.GetOverhead(), result.GetCompilationOverhead());
+    }
+
+    m_ExtraDuration = scale(m_ExtraDuration);
+
+    if (m_MeasurementStatistics.has_value())
+    {
+        auto& statistics = m_MeasurementStatistics.value();
+        statistics.m_Median = scale(statistics.m_Median);
+        statistics.m_Minimum = scale(statistics.m_Minimum);
+        statistics.m_StandardDeviation *= factor;
+        statistics.m_ConfidenceIntervalLower = scale(statistics.m_ConfidenceIntervalLower);
+        statistics.m_ConfidenceIntervalUpper = scale(statistics.m_ConfidenceIntervalUpper);
+    }
+
+    m_DriftCorrection *= factor;
+}
+
 const std::string& KernelResult::GetKernelName() const
 {
     return m_KernelName;
@@ -176,6 +230,11 @@ Nanoseconds KernelResult::GetProfilingRunsOverhead() const
     return m_ProfilingRunsOverhead;
 }
 
+Nanoseconds KernelResult::GetCalibrationOverhead() const
+{
+    return m_CalibrationOverhead;
+}
+
 Nanoseconds KernelResult::GetProfilingOverhead() const
 {
     return m_ProfilingOverhead;
@@ -199,12 +258,49 @@ Nanoseconds KernelResult::GetTotalDuration() const
 
 Nanoseconds KernelResult::GetTotalOverhead() const
 {
-    Nanoseconds overhead = m_DataMovementOverhead + m_ValidationOverhead + m_SearcherOverhead + /*GetKernelOverhead() +*/ m_FailedKernelOverhead + m_ProfilingRunsOverhead + m_CompilationOverhead;
+    Nanoseconds overhead = m_DataMovementOverhead + m_ValidationOverhead + m_SearcherOverhead + /*GetKernelOverhead() +*/ m_FailedKernelOverhead + m_ProfilingRunsOverhead + m_CompilationOverhead + m_CalibrationOverhead;
     if (m_ProfilingRunsOverhead == 0)
         overhead += GetKernelOverhead(); //in case there is no profiling, include also actual kernel overhead (was not fused)
+    if (HasMeasurementStatistics())
+        overhead += m_MeasurementStatistics->m_RepetitionOverhead;
     return overhead;
 }
 
+bool KernelResult::HasMeasurementStatistics() const
+{
+    return m_MeasurementStatistics.has_value();
+}
+
+const MeasurementStatistics& KernelResult::GetMeasurementStatistics() const
+{
+    if (!HasMeasurementStatistics())
+    {
+        throw KttException("Measurement statistics can only be retrieved after prior check that they exist");
+    }
+
+    return m_MeasurementStatistics.value();
+}
+
+bool KernelResult::HasTuningDevice() const
+{
+    return m_TuningDevice.has_value();
+}
+
+DeviceIndex KernelResult::GetTuningDevice() const
+{
+    if (!HasTuningDevice())
+    {
+        throw KttException("Tuning device can only be retrieved after prior check that it exists");
+    }
+
+    return m_TuningDevice.value();
+}
+
+double KernelResult::GetDriftCorrection() const
+{
+    return m_DriftCorrection;
+}
+
 bool KernelResult::IsValid() const
 {
     return m_Status == ResultStatus::Ok;
@@ -239,6 +335,7 @@ void KernelResult::FuseProfilingTimes(const KernelResult& previousResult, bool f
     m_ValidationOverhead += previousResult.GetValidationOverhead();
     m_SearcherOverhead += previousResult.GetSearcherOverhead();
     m_FailedKernelOverhead += previousResult.GetFailedKernelOverhead();
+    m_CalibrationOverhead += previousResult.GetCalibrationOverhead();
 }
 
 void KernelResult::CopyProfilingTimes(const KernelResult& originalResult)
@@ -251,6 +348,7 @@ void KernelResult::CopyProfilingTimes(const KernelResult& originalResult)
     m_ValidationOverhead = originalResult.GetValidationOverhead();
     m_SearcherOverhead = originalResult.GetSearcherOverhead();
     m_FailedKernelOverhead = originalResult.GetFailedKernelOverhead();
+    m_CalibrationOverhead = originalResult.GetCalibrationOverhead();
 }
 
 void KernelResult::TransferPowerData(const KernelResult& previousResult) 
@@ -3,10 +3,12 @@
   */
 #pragma once
 
+#include <optional>
 #include <vector>
 
 #include <Api/Configuration/KernelConfiguration.h>
 #include <Api/Output/ComputationResult.h>
+#include <Api/Output/MeasurementStatistics.h>
 #include <Api/Output/ResultStatus.h>
 #include <KttPlatform.h>
 #include <KttTypes.h>
@@ -90,6 +92,39 @@ public:
       */
     void SetProfilingRunsOverhead(const Nanoseconds overhead);
 
+    /** @fn void SetCalibrationOverhead(const Nanoseconds overhead)
+      * Sets measurement bias removed from kernel and launcher durations by timer calibration.
+      * @param overhead Time which was measured, but removed from durations by timer calibration.
+      */
+    void SetCalibrationOverhead(const Nanoseconds overhead);
+
+    /** @fn void SetMeasurementStatistics(const MeasurementStatistics& statistics)
+      * Sets statistics about repeated measurement of the kernel configuration.
+      * @param statistics Statistics collected from repeated kernel runs. See MeasurementStatistics for more information.
+      */
+    void SetMeasurementStatistics(const MeasurementStatistics& statistics);
+
+    /** @fn void SetTuningDevice(const DeviceIndex device)
+      * Sets device which produced the result during multi-device tuning.
+      * @param device Index of the device within the list of tuning devices.
+      */
+    void SetTuningDevice(const DeviceIndex device);
+
+    /** @fn void SetDriftCorrection(const double factor)
+      * Sets factor by which durations of the result were scaled to compensate for device performance drift. Durations of the
+      * result are not modified. Use ApplyDriftCorrection() to scale the durations.
+      * @param factor Factor by which the durations were scaled.
+      */
+    void SetDriftCorrection(const double factor);
+
+    /** @fn void ApplyDriftCorrection(const double factor)
+      * Scales kernel durations and measurement statistics of the result to compensate for device performance drift, e.g., thermal
+      * throttling, which affected the measurement. Overheads are not scaled. The factor is accumulated with previously applied
+      * corrections.
+      * @param factor Ratio between typical and drifted performance of the device.
+      */
+    void ApplyDriftCorrection(const double factor);
+
     /** @fn const std::string& GetKernelName() const
       * Returns name of a kernel tied to the result.
       * @return Name of a kernel tied to the result.
@@ -175,6 +210,13 @@ public:
       */
     Nanoseconds GetProfilingRunsOverhead() const;
 
+    /** @fn Nanoseconds GetCalibrationOverhead() const
+      * Retrieves measurement bias removed from kernel and launcher durations by timer calibration. See Tuner::CalibrateTimer()
+      * for more information.
+      * @return Time which was measured, but removed from durations by timer calibration. Zero if the timer is not calibrated.
+      */
+    Nanoseconds GetCalibrationOverhead() const;
+
     /** @fn Nanoseconds GetProfilingOverhead() const
       * Retrieves duration of all non-kernel operations performed during collection performance counters (e.g., data movements for extra kernel runs).
       * @return Duration operations different than kernel execution needed to coollect performance counters.
@@ -201,11 +243,44 @@ public:
     Nanoseconds GetTotalDuration() const;
 
     /** @fn Nanoseconds GetTotalOverhead() const
-      * Retrieves the sum of kernel, data movement, validation and searcher overhead.
-      * @return The sum of kernel, data movement, validation and searcher overhead.
+      * Retrieves the sum of kernel, data movement, validation, searcher and calibration overhead. If the result contains measurement
+      * statistics, the overhead of repeated runs is included as well.
+      * @return The sum of kernel, data movement, validation, searcher and calibration overhead.
       */
     Nanoseconds GetTotalOverhead() const;
 
+    /** @fn bool HasMeasurementStatistics() const
+      * Checks whether result contains statistics about repeated measurement.
+      * @return True if measurement statistics are available. False otherwise.
+      */
+    bool HasMeasurementStatistics() const;
+
+    /** @fn const MeasurementStatistics& GetMeasurementStatistics() const
+      * Retrieves statistics about repeated measurement. Should only be called after prior check for valid data.
+      * @return Statistics collected from repeated kernel runs. See MeasurementStatistics for more information.
+      */
+    const MeasurementStatistics& GetMeasurementStatistics() const;
+
+    /** @fn bool HasTuningDevice() const
+      * Checks whether result was produced during multi-device tuning and is tagged with the corresponding device.
+      * @return True if tuning device is available. False otherwise.
+      */
+    bool HasTuningDevice() const;
+
+    /** @fn DeviceIndex GetTuningDevice() const
+      * Retrieves device which produced the result during multi-device tuning. Should only be called after prior check for valid
+      * data.
+      * @return Index of the device within the list of tuning devices.
+      */
+    DeviceIndex GetTuningDevice() const;
+
+    /** @fn double GetDriftCorrection() const
+      * Returns factor by which durations of the result were scaled to compensate for device performance drift. Raw durations can
+      * be obtained by dividing the durations with the factor.
+      * @return Drift correction factor. One if no correction was applied.
+      */
+    double GetDriftCorrection() const;
+
     /** @fn bool IsValid() const
       * Checks whether kernel result is valid. I.e., its status has value Ok.
       * @return True if kernel result is valid. False otherwise.
@@ -250,6 +325,10 @@ private:
     Nanoseconds m_ProfilingRunsOverhead;
     Nanoseconds m_ProfilingOverhead;
     Nanoseconds m_CompilationOverhead;
+    Nanoseconds m_CalibrationOverhead;
+    std::optional<MeasurementStatistics> m_MeasurementStatistics;
+    std::optional<DeviceIndex> m_TuningDevice;
+    double m_DriftCorrection;
     ResultStatus m_Status;
 };
 
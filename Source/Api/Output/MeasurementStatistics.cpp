@@ -0,0 +1,29 @@
+#include <Api/Output/MeasurementStatistics.h>
+
+namespace ktt
+{
+
+MeasurementStatistics::MeasurementStatistics() :
+    m_Median(0),
+    m_Minimum(0),
+    m_StandardDeviation(0.0),
+    m_ConfidenceIntervalLower(0),
+    m_ConfidenceIntervalUpper(0),
+    m_RunCount(0),
+    m_WarmupRunCount(0),
+    m_EarlyAborted(false),
+    m_RepetitionOverhead(0)
+{}
+
+double MeasurementStatistics::GetRelativeConfidenceIntervalWidth() const
+{
+    if (m_Median == 0)
+    {
+        return 0.0;
+    }
+
+    const double width = static_cast<double>(m_ConfidenceIntervalUpper - m_ConfidenceIntervalLower);
+    return width / static_cast<double>(m_Median);
+}
+
+} // namespace ktt
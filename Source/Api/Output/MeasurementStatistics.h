@@ -0,0 +1,70 @@
+/** @file MeasurementStatistics.h
+  * Statistics about repeated measurement of specific kernel configuration.
+  */
+#pragma once
+
+#include <cstdint>
+
+#include <KttPlatform.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+/** @struct MeasurementStatistics
+  * Structure which holds statistics about repeated runs of specific kernel configuration. The statistics are computed from total
+  * durations of the individual runs, warm-up runs are not included.
+  */
+struct KTT_API MeasurementStatistics
+{
+public:
+    /** @fn MeasurementStatistics()
+      * Constructor which initializes all data values to zero.
+      */
+    MeasurementStatistics();
+
+    /** @fn double GetRelativeConfidenceIntervalWidth() const
+      * Returns width of the confidence interval of the median relative to the median.
+      * @return Width of the confidence interval relative to the median. Zero if the median is zero.
+      */
+    double GetRelativeConfidenceIntervalWidth() const;
+
+    /** Median duration of the measured runs.
+      */
+    Nanoseconds m_Median;
+
+    /** Minimum duration of the measured runs.
+      */
+    Nanoseconds m_Minimum;
+
+    /** Standard deviation of the measured run durations in nanoseconds.
+      */
+    double m_StandardDeviation;
+
+    /** Lower bound of the 95% confidence interval of the median.
+      */
+    Nanoseconds m_ConfidenceIntervalLower;
+
+    /** Upper bound of the 95% confidence interval of the median.
+      */
+    Nanoseconds m_ConfidenceIntervalUpper;
+
+    /** Number of measured runs, excluding warm-up runs.
+      */
+    uint64_t m_RunCount;
+
+    /** Number of warm-up runs performed before the measurement.
+      */
+    uint64_t m_WarmupRunCount;
+
+    /** Flag which indicates that the measurement was aborted before reaching the target confidence, because the configuration
+      * was found to be slower than the best configuration measured so far.
+      */
+    bool m_EarlyAborted;
+
+    /** Duration and overhead of warm-up runs and of measured runs other than the one chosen as representative result.
+      */
+    Nanoseconds m_RepetitionOverhead;
+};
+
+} // namespace ktt
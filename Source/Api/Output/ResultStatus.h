@@ -29,7 +29,11 @@ enum class ResultStatus
 
     /** Computation could not launch due to device limits being exceeded (e.g., local size was too large).
       */
-    DeviceLimitsExceeded
+    DeviceLimitsExceeded,
+
+    /** Computation did not finish within the time limit of sandboxed execution and its process was terminated.
+      */
+    Timeout
 };
 
 } // namespace ktt
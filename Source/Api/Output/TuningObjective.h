@@ -0,0 +1,32 @@
+/** @file TuningObjective.h
+  * Definition of enum for objectives which can be optimized during kernel tuning.
+  */
+#pragma once
+
+namespace ktt
+{
+
+/** @enum TuningObjective
+  * Enum for objectives which can be optimized during kernel tuning. All objectives are minimized.
+  */
+enum class TuningObjective
+{
+    /** Sum of kernel duration and kernel launcher duration (see KernelResult::GetTotalDuration()). This is the default objective.
+      */
+    TotalDuration,
+
+    /** Sum of raw kernel durations reported by compute API (see KernelResult::GetKernelDuration()).
+      */
+    KernelDuration,
+
+    /** Duration of kernel compilation (see KernelResult::GetCompilationOverhead()).
+      */
+    CompilationOverhead,
+
+    /** Total energy consumption of the kernel computations in joules. Computations without power usage data contribute zero
+      * energy.
+      */
+    EnergyConsumption
+};
+
+} // namespace ktt
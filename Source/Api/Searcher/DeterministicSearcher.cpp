@@ -24,4 +24,17 @@ KernelConfiguration DeterministicSearcher::GetCurrentConfiguration() const
     return GetConfiguration(m_Index);
 }
 
+std::vector<KernelConfiguration> DeterministicSearcher::GetUpcomingConfigurations(const size_t count) const
+{
+    std::vector<KernelConfiguration> result;
+    const uint64_t configurationsCount = GetConfigurationsCount();
+
+    for (uint64_t index = m_Index + 1; index < configurationsCount && result.size() < count; ++index)
+    {
+        result.push_back(GetConfiguration(index));
+    }
+
+    return result;
+}
+
 } // namespace ktt
@@ -26,6 +26,7 @@ public:
 
     bool CalculateNextConfiguration(const KernelResult& previousResult) override;
     KernelConfiguration GetCurrentConfiguration() const override;
+    std::vector<KernelConfiguration> GetUpcomingConfigurations(const size_t count) const override;
 
 private:
     uint64_t m_Index;
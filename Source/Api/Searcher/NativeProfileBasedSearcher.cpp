@@ -0,0 +1,393 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+#include <Api/KttException.h>
+#include <Api/Searcher/NativeProfileBasedSearcher.h>
+#include <Tuner.h>
+#include <TuningRunner/ProfileBased/BottleneckAnalyzer.h>
+#include <TuningRunner/ProfileBased/DecisionTreeModel.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+NativeProfileBasedSearcher::NativeProfileBasedSearcher(Tuner& tuner, const DeviceInfo& deviceInfo, const std::string& modelFile,
+    const uint32_t batchSize, const uint32_t neighbourSize, const uint32_t randomSize) :
+    Searcher(),
+    m_Tuner(tuner),
+    m_Model(std::make_unique<DecisionTreeModel>(modelFile)),
+    m_Analyzer(std::make_unique<BottleneckAnalyzer>(deviceInfo.GetCudaComputeCapabilityMajor(),
+        deviceInfo.GetCudaComputeCapabilityMinor(), deviceInfo.GetMaxComputeUnits())),
+    m_BestDuration(std::numeric_limits<Nanoseconds>::max()),
+    m_ProfilingBest(false),
+    m_Generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
+    m_BatchSize(std::max(static_cast<size_t>(batchSize), static_cast<size_t>(1))),
+    m_NeighbourSize(static_cast<size_t>(neighbourSize)),
+    m_RandomSize(static_cast<size_t>(randomSize))
+{
+    Logger::LogInfo("Loaded profile-based searcher model " + modelFile + " with batch size " + std::to_string(m_BatchSize)
+        + ", neighbour size " + std::to_string(m_NeighbourSize) + " and random size " + std::to_string(m_RandomSize));
+}
+
+NativeProfileBasedSearcher::~NativeProfileBasedSearcher() = default;
+
+void NativeProfileBasedSearcher::OnInitialize()
+{
+    // Order of tuning parameters in the model may differ from their order in the tuning space
+    const auto& modelParameters = m_Model->GetParameterNames();
+    const auto pairs = GetConfiguration(0).GetPairs();
+
+    if (pairs.size() != modelParameters.size())
+    {
+        throw KttException("Profile-based searcher model uses " + std::to_string(modelParameters.size())
+            + " tuning parameters, but the tuned kernel has " + std::to_string(pairs.size()));
+    }
+
+    m_FeatureIndices.clear();
+
+    for (const auto& pair : pairs)
+    {
+        if (pair.GetValueType() == ParameterValueType::String)
+        {
+            throw KttException("Profile-based searcher does not support string tuning parameter " + pair.GetName());
+        }
+
+        const auto iterator = std::find(modelParameters.cbegin(), modelParameters.cend(), pair.GetName());
+
+        if (iterator == modelParameters.cend())
+        {
+            throw KttException("Tuning parameter " + pair.GetName() + " is not present in profile-based searcher model");
+        }
+
+        m_FeatureIndices.push_back(static_cast<size_t>(std::distance(modelParameters.cbegin(), iterator)));
+    }
+
+    FillRandomBatch();
+    PopBatchConfiguration();
+}
+
+void NativeProfileBasedSearcher::OnReset()
+{
+    m_Batch.clear();
+    m_CurrentConfiguration = KernelConfiguration();
+    m_BestConfiguration = KernelConfiguration();
+    m_BestDuration = std::numeric_limits<Nanoseconds>::max();
+    m_ProfilingBest = false;
+    m_FeatureIndices.clear();
+}
+
+bool NativeProfileBasedSearcher::CalculateNextConfiguration(const KernelResult& previousResult)
+{
+    if (previousResult.IsValid() && !m_ProfilingBest
+        && (!m_BestConfiguration.IsValid() || previousResult.GetKernelDuration() < m_BestDuration))
+    {
+        m_BestDuration = previousResult.GetKernelDuration();
+        m_BestConfiguration = m_CurrentConfiguration;
+        Logger::LogDebug("Profile-based searcher found new best configuration in batch " + std::to_string(GetIndex(m_BestConfiguration)));
+    }
+
+    if (!m_Batch.empty())
+    {
+        PopBatchConfiguration();
+        return true;
+    }
+
+    if (!m_BestConfiguration.IsValid())
+    {
+        // Batch contained only invalid configurations
+        FillRandomBatch();
+    }
+    else if (!m_ProfilingBest)
+    {
+        // The fastest configuration from the batch is launched once again with profiling
+        m_CurrentConfiguration = m_BestConfiguration;
+        m_ProfilingBest = true;
+        m_Tuner.SetProfiling(true);
+        Logger::LogInfo("Profile-based searcher is collecting profiling counters for configuration "
+            + std::to_string(GetIndex(m_CurrentConfiguration)));
+        return true;
+    }
+    else
+    {
+        m_ProfilingBest = false;
+        m_Tuner.SetProfiling(false);
+        SelectBatch(previousResult);
+        m_BestConfiguration = KernelConfiguration();
+        m_BestDuration = std::numeric_limits<Nanoseconds>::max();
+    }
+
+    if (m_Batch.empty())
+    {
+        return false;
+    }
+
+    PopBatchConfiguration();
+    return true;
+}
+
+KernelConfiguration NativeProfileBasedSearcher::GetCurrentConfiguration() const
+{
+    return m_CurrentConfiguration;
+}
+
+void NativeProfileBasedSearcher::FillRandomBatch()
+{
+    const auto batchSize = static_cast<size_t>(std::min(static_cast<uint64_t>(m_BatchSize), GetUnexploredConfigurationsCount()));
+    std::vector<KernelConfiguration> batch;
+    std::set<uint64_t> indices;
+
+    while (batch.size() < batchSize)
+    {
+        AddUniqueConfiguration(GetRandomConfiguration(), batch, indices);
+    }
+
+    m_Batch.assign(batch.cbegin(), batch.cend());
+    Logger::LogInfo("Profile-based searcher generated random batch with " + std::to_string(m_Batch.size()) + " configurations");
+}
+
+void NativeProfileBasedSearcher::SelectBatch(const KernelResult& profiledResult)
+{
+    std::vector<double> changes;
+
+    try
+    {
+        std::vector<std::string> names;
+        std::vector<double> values;
+        GetProfilingCounters(profiledResult, names, values);
+        const Bottlenecks bottlenecks = m_Analyzer->AnalyzeBottlenecks(names, values);
+        changes = m_Analyzer->ComputeChanges(bottlenecks, m_Model->GetCounterNames(), m_Model->GetComputeCapability());
+    }
+    catch (const KttException& exception)
+    {
+        Logger::LogWarning(std::string("Profile-based searcher is unable to analyze bottlenecks, generating random batch: ")
+            + exception.what());
+        FillRandomBatch();
+        return;
+    }
+
+    const auto candidates = GatherCandidates();
+    std::vector<double> scores = ScoreCandidates(candidates, changes);
+    m_Batch.clear();
+
+    if (candidates.size() <= m_BatchSize)
+    {
+        m_Batch.assign(candidates.cbegin(), candidates.cend());
+    }
+    else
+    {
+        // Weighted random selection without repetition, biased by configuration scores
+        while (m_Batch.size() < m_BatchSize)
+        {
+            double scoreSum = 0.0;
+
+            for (const double score : scores)
+            {
+                scoreSum += score;
+            }
+
+            std::uniform_real_distribution<double> distribution(0.0, scoreSum);
+            const double threshold = distribution(m_Generator);
+            double accumulated = 0.0;
+            size_t selected = 0;
+
+            for (size_t i = 0; i < scores.size(); ++i)
+            {
+                if (scores[i] <= 0.0)
+                {
+                    continue;
+                }
+
+                selected = i;
+                accumulated += scores[i];
+
+                if (threshold < accumulated)
+                {
+                    break;
+                }
+            }
+
+            m_Batch.push_back(candidates[selected]);
+            scores[selected] = 0.0;
+        }
+    }
+
+    Logger::LogInfo("Profile-based searcher selected new batch with " + std::to_string(m_Batch.size()) + " configurations from "
+        + std::to_string(candidates.size()) + " candidates");
+}
+
+std::vector<KernelConfiguration> NativeProfileBasedSearcher::GatherCandidates() const
+{
+    // Candidates are neighbours of the profiled configuration extended with random sample of the tuning space
+    std::vector<KernelConfiguration> candidates;
+    std::set<uint64_t> indices;
+
+    for (const auto& neighbour : GetNeighbourConfigurations(m_BestConfiguration, m_NeighbourDistance, m_NeighbourSize))
+    {
+        AddUniqueConfiguration(neighbour, candidates, indices);
+    }
+
+    const auto candidatesCount = static_cast<size_t>(std::min(static_cast<uint64_t>(candidates.size() + m_RandomSize),
+        GetUnexploredConfigurationsCount()));
+
+    while (candidates.size() < candidatesCount)
+    {
+        AddUniqueConfiguration(GetRandomConfiguration(), candidates, indices);
+    }
+
+    return candidates;
+}
+
+std::vector<double> NativeProfileBasedSearcher::ScoreCandidates(const std::vector<KernelConfiguration>& candidates,
+    const std::vector<double>& changes) const
+{
+    const std::vector<double> profiledCounters = m_Model->Predict(GetModelFeatures(m_BestConfiguration));
+    std::vector<double> scores(candidates.size(), 0.0);
+
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        const std::vector<double> counters = m_Model->Predict(GetModelFeatures(candidates[i]));
+
+        // Models with fewer outputs than analyzed counters only score the counters they predict
+        const size_t counterCount = std::min({changes.size(), counters.size(), profiledCounters.size()});
+
+        for (size_t j = 0; j < counterCount; ++j)
+        {
+            const double difference = counters[j] - profiledCounters[j];
+            const double sum = counters[j] + profiledCounters[j];
+            const double direction = changes[j] * difference;
+
+            if (sum == 0.0 || direction == 0.0)
+            {
+                continue;
+            }
+
+            const double magnitude = std::abs(changes[j] * 2.0 * difference / sum);
+            scores[i] += direction > 0.0 ? magnitude : -magnitude;
+        }
+    }
+
+    if (scores.empty())
+    {
+        return scores;
+    }
+
+    const double minScore = *std::min_element(scores.cbegin(), scores.cend());
+    const double maxScore = *std::max_element(scores.cbegin(), scores.cend());
+    Logger::LogDebug("Profile-based searcher score interval: <" + std::to_string(minScore) + ", " + std::to_string(maxScore) + ">");
+
+    // Scores are normalized into interval <0, 2> and raised to prioritize configurations with high score
+    for (auto& score : scores)
+    {
+        if (score < m_ScoreCutoff)
+        {
+            score = m_MinimumScore;
+            continue;
+        }
+
+        if (score < 0.0)
+        {
+            score = 1.0 - score / minScore;
+        }
+        else if (score > 0.0)
+        {
+            score = 1.0 + score / maxScore;
+        }
+
+        score = std::max(std::pow(score, m_ScoreExponent), m_MinimumScore);
+    }
+
+    return scores;
+}
+
+std::vector<double> NativeProfileBasedSearcher::GetModelFeatures(const KernelConfiguration& configuration) const
+{
+    const auto& pairs = configuration.GetPairs();
+    std::vector<double> result(m_FeatureIndices.size(), 0.0);
+
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        result[m_FeatureIndices[i]] = std::visit([](const auto& value)
+        {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                return 0.0;
+            }
+            else
+            {
+                return static_cast<double>(value);
+            }
+        }, pairs[i].GetValue());
+    }
+
+    return result;
+}
+
+void NativeProfileBasedSearcher::AddUniqueConfiguration(const KernelConfiguration& configuration,
+    std::vector<KernelConfiguration>& target, std::set<uint64_t>& indices) const
+{
+    if (indices.insert(GetIndex(configuration)).second)
+    {
+        target.push_back(configuration);
+    }
+}
+
+void NativeProfileBasedSearcher::PopBatchConfiguration()
+{
+    m_CurrentConfiguration = m_Batch.front();
+    m_Batch.pop_front();
+}
+
+void NativeProfileBasedSearcher::GetProfilingCounters(const KernelResult& result, std::vector<std::string>& names,
+    std::vector<double>& values)
+{
+    const auto& computationResults = result.GetResults();
+
+    if (computationResults.empty() || !computationResults[0].HasProfilingData())
+    {
+        throw KttException("Profiled configuration does not contain profiling data");
+    }
+
+    if (computationResults.size() > 1)
+    {
+        Logger::LogWarning("Profile-based searcher does not support kernel compositions, only counters from the first kernel are used");
+    }
+
+    const auto& computation = computationResults[0];
+    const auto globalSize = static_cast<double>(computation.GetGlobalSize().GetTotalSize());
+    const auto localSize = static_cast<double>(computation.GetLocalSize().GetTotalSize());
+
+    names = {"Global size", "Local size"};
+    values = {globalSize * localSize, localSize};
+
+    for (const auto& counter : computation.GetProfilingData().GetCounters())
+    {
+        names.push_back(counter.GetName());
+
+        switch (counter.GetType())
+        {
+        case ProfilingCounterType::Int:
+            values.push_back(static_cast<double>(counter.GetValueInt()));
+            break;
+        case ProfilingCounterType::UnsignedInt:
+        case ProfilingCounterType::Throughput:
+        case ProfilingCounterType::UtilizationLevel:
+            values.push_back(static_cast<double>(counter.GetValueUint()));
+            break;
+        case ProfilingCounterType::Double:
+        case ProfilingCounterType::Percent:
+            values.push_back(counter.GetValueDouble());
+            break;
+        default:
+            KttError("Unhandled profiling counter type value");
+        }
+    }
+}
+
+} // namespace ktt
@@ -0,0 +1,91 @@
+/** @file NativeProfileBasedSearcher.h
+  * Searcher which explores configurations according to observed bottlenecks and decision tree model exported to JSON.
+  */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Api/Info/DeviceInfo.h>
+#include <Api/Searcher/Searcher.h>
+#include <KttPlatform.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+class BottleneckAnalyzer;
+class DecisionTreeModel;
+class Tuner;
+
+/** @class NativeProfileBasedSearcher
+  * Searcher which explores configurations according to observed bottlenecks and ML model created on historical data. It is
+  * a native port of the Python profile-based searcher, see J. Filipovic et al. Using hardware performance counters to speed
+  * up autotuning convergence on GPUs. JPDC, vol. 160, 2021. Profiling counters must be collected for the tuned kernel.
+  */
+class KTT_API NativeProfileBasedSearcher : public Searcher
+{
+public:
+    /** @fn explicit NativeProfileBasedSearcher(Tuner& tuner, const DeviceInfo& deviceInfo, const std::string& modelFile,
+      * const uint32_t batchSize, const uint32_t neighbourSize, const uint32_t randomSize)
+      * Initializes profile-based searcher.
+      * @param tuner Tuner which is used to profile the selected configurations.
+      * @param deviceInfo Information about tuned device, used to compute its theoretical throughput.
+      * @param modelFile Decision tree model exported to JSON, see Scripts/PrepareModels/export_model_to_json.py.
+      * @param batchSize Number of configurations from which the fastest one is profiled.
+      * @param neighbourSize Number of neighbouring configurations that are used for batch selection.
+      * @param randomSize Number of random configurations that are used for batch selection.
+      */
+    explicit NativeProfileBasedSearcher(Tuner& tuner, const DeviceInfo& deviceInfo, const std::string& modelFile,
+        const uint32_t batchSize, const uint32_t neighbourSize, const uint32_t randomSize);
+
+    /** @fn ~NativeProfileBasedSearcher() override
+      * Profile-based searcher destructor.
+      */
+    ~NativeProfileBasedSearcher() override;
+
+    void OnInitialize() override;
+    void OnReset() override;
+
+    bool CalculateNextConfiguration(const KernelResult& previousResult) override;
+    KernelConfiguration GetCurrentConfiguration() const override;
+
+private:
+    Tuner& m_Tuner;
+    std::unique_ptr<DecisionTreeModel> m_Model;
+    std::unique_ptr<BottleneckAnalyzer> m_Analyzer;
+    std::deque<KernelConfiguration> m_Batch;
+    KernelConfiguration m_CurrentConfiguration;
+    KernelConfiguration m_BestConfiguration;
+    Nanoseconds m_BestDuration;
+    bool m_ProfilingBest;
+    std::vector<size_t> m_FeatureIndices;
+    std::default_random_engine m_Generator;
+    size_t m_BatchSize;
+    size_t m_NeighbourSize;
+    size_t m_RandomSize;
+
+    inline static const uint64_t m_NeighbourDistance = 2;
+    inline static const double m_ScoreExponent = 8.0;
+    inline static const double m_ScoreCutoff = -0.25;
+    inline static const double m_MinimumScore = 0.0001;
+
+    void FillRandomBatch();
+    void SelectBatch(const KernelResult& profiledResult);
+    std::vector<KernelConfiguration> GatherCandidates() const;
+    std::vector<double> ScoreCandidates(const std::vector<KernelConfiguration>& candidates, const std::vector<double>& changes) const;
+    std::vector<double> GetModelFeatures(const KernelConfiguration& configuration) const;
+    void AddUniqueConfiguration(const KernelConfiguration& configuration, std::vector<KernelConfiguration>& target,
+        std::set<uint64_t>& indices) const;
+    void PopBatchConfiguration();
+
+    static void GetProfilingCounters(const KernelResult& result, std::vector<std::string>& names, std::vector<double>& values);
+};
+
+} // namespace ktt
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+
+#include <Api/Searcher/ParetoSearcher.h>
+#include <TuningRunner/ParetoFront.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+ParetoSearcher::ParetoSearcher(const size_t populationSize, const double mutationProbability) :
+    Searcher(),
+    m_CurrentIndex(0),
+    m_PopulationSize(std::max(static_cast<size_t>(2), populationSize)),
+    m_MutationProbability(std::clamp(mutationProbability, 0.0, 1.0)),
+    m_Generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
+    m_ProbabilityDistribution(0.0, 1.0)
+{}
+
+void ParetoSearcher::OnInitialize()
+{
+    m_CurrentIndex = GetIndex(GetRandomConfiguration());
+}
+
+void ParetoSearcher::OnReset()
+{
+    m_CurrentIndex = 0;
+    m_Population.clear();
+}
+
+bool ParetoSearcher::CalculateNextConfiguration(const KernelResult& previousResult)
+{
+    if (previousResult.IsValid())
+    {
+        m_Population.push_back({m_CurrentIndex, GetObjectiveValues(previousResult), 0, 0.0});
+
+        if (m_Population.size() > m_PopulationSize)
+        {
+            ReducePopulation();
+        }
+    }
+
+    if (GetUnexploredConfigurationsCount() == 0)
+    {
+        return false;
+    }
+
+    if (m_Population.size() < m_PopulationSize)
+    {
+        m_CurrentIndex = GetIndex(GetRandomConfiguration());
+        return true;
+    }
+
+    RankPopulation();
+    const Individual& first = SelectParent();
+    const Individual& second = SelectParent();
+    m_CurrentIndex = CreateOffspring(first, second);
+    return true;
+}
+
+KernelConfiguration ParetoSearcher::GetCurrentConfiguration() const
+{
+    return GetConfiguration(m_CurrentIndex);
+}
+
+void ParetoSearcher::RankPopulation()
+{
+    const size_t count = m_Population.size();
+    std::vector<std::vector<size_t>> dominatedIndividuals(count);
+    std::vector<size_t> dominationCounts(count, 0);
+    std::vector<size_t> currentFront;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            if (ParetoFront::Dominates(m_Population[i].m_Objectives, m_Population[j].m_Objectives))
+            {
+                dominatedIndividuals[i].push_back(j);
+            }
+            else if (ParetoFront::Dominates(m_Population[j].m_Objectives, m_Population[i].m_Objectives))
+            {
+                ++dominationCounts[i];
+            }
+        }
+
+        if (dominationCounts[i] == 0)
+        {
+            currentFront.push_back(i);
+        }
+    }
+
+    size_t rank = 0;
+
+    while (!currentFront.empty())
+    {
+        std::vector<size_t> nextFront;
+
+        for (const size_t i : currentFront)
+        {
+            m_Population[i].m_Rank = rank;
+            m_Population[i].m_CrowdingDistance = 0.0;
+
+            for (const size_t j : dominatedIndividuals[i])
+            {
+                --dominationCounts[j];
+
+                if (dominationCounts[j] == 0)
+                {
+                    nextFront.push_back(j);
+                }
+            }
+        }
+
+        const size_t objectivesCount = m_Population[currentFront[0]].m_Objectives.size();
+
+        for (size_t objective = 0; objective < objectivesCount; ++objective)
+        {
+            std::sort(currentFront.begin(), currentFront.end(), [this, objective](const size_t left, const size_t right)
+            {
+                return m_Population[left].m_Objectives[objective] < m_Population[right].m_Objectives[objective];
+            });
+
+            const double minimum = m_Population[currentFront.front()].m_Objectives[objective];
+            const double maximum = m_Population[currentFront.back()].m_Objectives[objective];
+            m_Population[currentFront.front()].m_CrowdingDistance = std::numeric_limits<double>::max();
+            m_Population[currentFront.back()].m_CrowdingDistance = std::numeric_limits<double>::max();
+
+            if (maximum <= minimum)
+            {
+                continue;
+            }
+
+            for (size_t i = 1; i + 1 < currentFront.size(); ++i)
+            {
+                auto& individual = m_Population[currentFront[i]];
+
+                if (individual.m_CrowdingDistance == std::numeric_limits<double>::max())
+                {
+                    continue;
+                }
+
+                const double previous = m_Population[currentFront[i - 1]].m_Objectives[objective];
+                const double next = m_Population[currentFront[i + 1]].m_Objectives[objective];
+                individual.m_CrowdingDistance += (next - previous) / (maximum - minimum);
+            }
+        }
+
+        currentFront = nextFront;
+        ++rank;
+    }
+}
+
+void ParetoSearcher::ReducePopulation()
+{
+    RankPopulation();
+
+    auto worst = std::max_element(m_Population.begin(), m_Population.end(), [](const auto& left, const auto& right)
+    {
+        if (left.m_Rank != right.m_Rank)
+        {
+            return left.m_Rank < right.m_Rank;
+        }
+
+        return left.m_CrowdingDistance > right.m_CrowdingDistance;
+    });
+
+    Logger::LogDebug("Pareto searcher removing configuration " + std::to_string(worst->m_Index) + " with rank "
+        + std::to_string(worst->m_Rank) + " from population");
+    m_Population.erase(worst);
+}
+
+const ParetoSearcher::Individual& ParetoSearcher::SelectParent()
+{
+    std::uniform_int_distribution<size_t> distribution(0, m_Population.size() - 1);
+    const Individual& first = m_Population[distribution(m_Generator)];
+    const Individual& second = m_Population[distribution(m_Generator)];
+
+    if (first.m_Rank != second.m_Rank)
+    {
+        return first.m_Rank < second.m_Rank ? first : second;
+    }
+
+    return first.m_CrowdingDistance >= second.m_CrowdingDistance ? first : second;
+}
+
+uint64_t ParetoSearcher::CreateOffspring(const Individual& first, const Individual& second)
+{
+    const auto neighbours = GetNeighbourConfigurations(GetConfiguration(first.m_Index), m_MaximumDifferences, m_MaximumNeighbours);
+
+    if (neighbours.empty())
+    {
+        Logger::LogDebug("Pareto searcher found no unexplored neighbours, selecting random configuration");
+        return GetIndex(GetRandomConfiguration());
+    }
+
+    if (m_ProbabilityDistribution(m_Generator) < m_MutationProbability)
+    {
+        std::uniform_int_distribution<size_t> distribution(0, neighbours.size() - 1);
+        return GetIndex(neighbours[distribution(m_Generator)]);
+    }
+
+    // Recombination, pick neighbour of the first parent which shares the most parameter values with the second parent
+    const auto& secondPairs = GetConfiguration(second.m_Index).GetPairs();
+    size_t bestNeighbour = 0;
+    size_t bestDifferences = std::numeric_limits<size_t>::max();
+
+    for (size_t i = 0; i < neighbours.size(); ++i)
+    {
+        size_t differences = 0;
+
+        for (const auto& pair : neighbours[i].GetPairs())
+        {
+            const bool sameValue = std::any_of(secondPairs.cbegin(), secondPairs.cend(), [&pair](const auto& secondPair)
+            {
+                return pair.GetName() == secondPair.GetName() && pair.HasSameValue(secondPair);
+            });
+
+            if (!sameValue)
+            {
+                ++differences;
+            }
+        }
+
+        if (differences < bestDifferences)
+        {
+            bestDifferences = differences;
+            bestNeighbour = i;
+        }
+    }
+
+    return GetIndex(neighbours[bestNeighbour]);
+}
+
+} // namespace ktt
@@ -0,0 +1,66 @@
+/** @file ParetoSearcher.h
+  * Searcher which explores configurations towards Pareto front of multiple tuning objectives.
+  */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <Api/Searcher/Searcher.h>
+#include <KttPlatform.h>
+
+namespace ktt
+{
+
+/** @class ParetoSearcher
+  * Searcher which explores configurations towards Pareto front of multiple tuning objectives. It is a steady-state variant of
+  * NSGA-II algorithm. Population is ranked by non-dominated sorting and crowding distance, new configurations are created by
+  * recombination of neighbourhood of one parent towards the other parent. Tuning objectives can be set with
+  * Tuner::SetTuningObjectives().
+  */
+class KTT_API ParetoSearcher : public Searcher
+{
+public:
+    /** @fn explicit ParetoSearcher(const size_t populationSize = 20, const double mutationProbability = 0.1)
+      * Initializes Pareto searcher.
+      * @param populationSize Number of configurations kept in population. Initial population is explored randomly.
+      * @param mutationProbability Probability that a random neighbour of the selected parent is chosen instead of a recombination
+      * with the other parent.
+      */
+    explicit ParetoSearcher(const size_t populationSize = 20, const double mutationProbability = 0.1);
+
+    void OnInitialize() override;
+    void OnReset() override;
+
+    bool CalculateNextConfiguration(const KernelResult& previousResult) override;
+    KernelConfiguration GetCurrentConfiguration() const override;
+
+private:
+    struct Individual
+    {
+        uint64_t m_Index;
+        std::vector<double> m_Objectives;
+        size_t m_Rank;
+        double m_CrowdingDistance;
+    };
+
+    std::vector<Individual> m_Population;
+    uint64_t m_CurrentIndex;
+    size_t m_PopulationSize;
+    double m_MutationProbability;
+
+    std::default_random_engine m_Generator;
+    std::uniform_real_distribution<double> m_ProbabilityDistribution;
+
+    void RankPopulation();
+    void ReducePopulation();
+    const Individual& SelectParent();
+    uint64_t CreateOffspring(const Individual& first, const Individual& second);
+
+    inline static size_t m_MaximumDifferences = 2;
+    inline static size_t m_MaximumNeighbours = 50;
+};
+
+} // namespace ktt
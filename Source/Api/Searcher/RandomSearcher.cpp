@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <set>
+
 #include <Api/Searcher/RandomSearcher.h>
 
 namespace ktt
@@ -9,12 +12,28 @@ RandomSearcher::RandomSearcher() :
 
 void RandomSearcher::OnInitialize()
 {
+    m_UpcomingConfigurations.clear();
     m_CurrentConfiguration = GetRandomConfiguration();
 }
 
+void RandomSearcher::OnReset()
+{
+    m_UpcomingConfigurations.clear();
+}
+
 bool RandomSearcher::CalculateNextConfiguration([[maybe_unused]] const KernelResult& previousResult)
 {
-    m_CurrentConfiguration = GetRandomConfiguration();
+    RemoveExploredConfigurations();
+
+    if (m_UpcomingConfigurations.empty())
+    {
+        m_CurrentConfiguration = GetRandomConfiguration();
+        return true;
+    }
+
+    // Configurations which were already reported as upcoming are used in the same order
+    m_CurrentConfiguration = m_UpcomingConfigurations.front();
+    m_UpcomingConfigurations.pop_front();
     return true;
 }
 
@@ -23,4 +42,48 @@ KernelConfiguration RandomSearcher::GetCurrentConfiguration() const
     return m_CurrentConfiguration;
 }
 
+std::vector<KernelConfiguration> RandomSearcher::GetUpcomingConfigurations(const size_t count) const
+{
+    RemoveExploredConfigurations();
+    std::set<uint64_t> sampledIndices{GetIndex(m_CurrentConfiguration)};
+
+    for (const auto& configuration : m_UpcomingConfigurations)
+    {
+        sampledIndices.insert(GetIndex(configuration));
+    }
+
+    // Current configuration is not explored yet, so it is included in the unexplored count
+    const uint64_t unexploredCount = GetUnexploredConfigurationsCount();
+
+    while (m_UpcomingConfigurations.size() < count && sampledIndices.size() < unexploredCount)
+    {
+        const KernelConfiguration configuration = GetRandomConfiguration();
+
+        if (sampledIndices.insert(GetIndex(configuration)).second)
+        {
+            m_UpcomingConfigurations.push_back(configuration);
+        }
+    }
+
+    const size_t resultCount = std::min(count, m_UpcomingConfigurations.size());
+    return std::vector<KernelConfiguration>(m_UpcomingConfigurations.cbegin(), m_UpcomingConfigurations.cbegin() + resultCount);
+}
+
+void RandomSearcher::RemoveExploredConfigurations() const
+{
+    const auto& exploredIndices = GetExploredIndices();
+
+    for (auto iterator = m_UpcomingConfigurations.begin(); iterator != m_UpcomingConfigurations.end();)
+    {
+        if (exploredIndices.find(GetIndex(*iterator)) != exploredIndices.cend())
+        {
+            iterator = m_UpcomingConfigurations.erase(iterator);
+        }
+        else
+        {
+            ++iterator;
+        }
+    }
+}
+
 } // namespace ktt
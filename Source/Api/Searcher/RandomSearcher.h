@@ -3,6 +3,8 @@
   */
 #pragma once
 
+#include <deque>
+
 #include <Api/Searcher/Searcher.h>
 #include <KttPlatform.h>
 
@@ -10,7 +12,8 @@ namespace ktt
 {
 
 /** @class RandomSearcher
-  * Searcher which explores configurations in random order.
+  * Searcher which explores configurations in random order. Upcoming configurations are sampled in advance, so that they can be
+  * compiled in background and evaluated on other devices during multi-device tuning.
   */
 class KTT_API RandomSearcher : public Searcher
 {
@@ -21,12 +24,17 @@ public:
     RandomSearcher();
 
     void OnInitialize() override;
+    void OnReset() override;
 
     bool CalculateNextConfiguration(const KernelResult& previousResult) override;
     KernelConfiguration GetCurrentConfiguration() const override;
+    std::vector<KernelConfiguration> GetUpcomingConfigurations(const size_t count) const override;
 
 private:
     KernelConfiguration m_CurrentConfiguration;
+    mutable std::deque<KernelConfiguration> m_UpcomingConfigurations;
+
+    void RemoveExploredConfigurations() const;
 };
 
 } // namespace ktt
@@ -10,6 +10,11 @@ void Searcher::OnInitialize()
 void Searcher::OnReset()
 {}
 
+std::vector<KernelConfiguration> Searcher::GetUpcomingConfigurations([[maybe_unused]] const size_t count) const
+{
+    return {};
+}
+
 Searcher::Searcher() :
     m_Data(nullptr)
 {}
@@ -50,6 +55,16 @@ const std::set<uint64_t>& Searcher::GetExploredIndices() const
     return m_Data->GetExploredConfigurations();
 }
 
+std::vector<double> Searcher::GetObjectiveValues(const KernelResult& result) const
+{
+    return m_Data->GetObjectiveValues(result);
+}
+
+std::vector<KernelResult> Searcher::GetParetoFront() const
+{
+    return m_Data->GetParetoFront();
+}
+
 bool Searcher::IsInitialized() const
 {
     return m_Data != nullptr;
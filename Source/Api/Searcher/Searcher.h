@@ -56,6 +56,16 @@ public:
       */
     virtual KernelConfiguration GetCurrentConfiguration() const = 0;
 
+    /** @fn virtual std::vector<KernelConfiguration> GetUpcomingConfigurations(const size_t count) const
+      * Returns configurations which are expected to be run after the current configuration. Used to compile kernels for upcoming
+      * configurations in advance, see Tuner::SetCompilationLookahead(), and to run them on other devices during multi-device
+      * tuning. Searchers whose next configuration depends on the results
+      * of previous runs may return fewer configurations than requested. Default implementation returns no configurations.
+      * @param count Maximum number of returned configurations.
+      * @return Configurations in the order in which they are expected to be run.
+      */
+    virtual std::vector<KernelConfiguration> GetUpcomingConfigurations(const size_t count) const;
+
     /** @fn Searcher()
       * Default searcher constructor. Should be called from inheriting searcher's constructor.
       */
@@ -114,6 +124,19 @@ public:
       */
     const std::set<uint64_t>& GetExploredIndices() const;
 
+    /** @fn std::vector<double> GetObjectiveValues(const KernelResult& result) const
+      * Computes values of tuning objectives for the specified result. The objectives can be set with Tuner::SetTuningObjectives().
+      * @param result Result whose objective values will be computed.
+      * @return Values of tuning objectives in the same order in which the objectives were specified. All values are minimized.
+      */
+    std::vector<double> GetObjectiveValues(const KernelResult& result) const;
+
+    /** @fn std::vector<KernelResult> GetParetoFront() const
+      * Returns results of explored configurations which form the current Pareto front with regard to tuning objectives.
+      * @return Results which are not dominated by any other explored configuration.
+      */
+    std::vector<KernelResult> GetParetoFront() const;
+
     /** @fn bool IsInitialized() const
       * Returns whether searcher is initialized.
       * @return True if searcher is initialized, false otherwise.
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <limits>
+
+#include <Api/StopCondition/ConvergenceCondition.h>
+#include <Utility/Timer/VirtualClock.h>
+
+namespace ktt
+{
+
+ConvergenceCondition::ConvergenceCondition(const double improvementThreshold, const uint64_t configurationWindow,
+    const double timeWindow, const uint64_t minimumEvaluations) :
+    m_BestDuration(std::numeric_limits<double>::max()),
+    m_ReferenceDuration(std::numeric_limits<double>::max()),
+    m_ImprovementThreshold(std::clamp(improvementThreshold, 0.0, 100.0) / 100.0),
+    m_PassedTime(0.0),
+    m_TimeWindow(std::max(0.0, timeWindow)),
+    m_ConfigurationsSinceImprovement(0),
+    m_ConfigurationWindow(configurationWindow),
+    m_EvaluatedCount(0),
+    m_MinimumEvaluations(minimumEvaluations)
+{}
+
+bool ConvergenceCondition::IsFulfilled() const
+{
+    if (m_EvaluatedCount < m_MinimumEvaluations)
+    {
+        return false;
+    }
+
+    const bool configurationsExceeded = m_ConfigurationWindow > 0 && m_ConfigurationsSinceImprovement >= m_ConfigurationWindow;
+    const bool timeExceeded = m_TimeWindow > 0.0 && m_PassedTime >= m_TimeWindow;
+    return configurationsExceeded || timeExceeded;
+}
+
+void ConvergenceCondition::Initialize([[maybe_unused]] const uint64_t configurationsCount)
+{
+    m_ImprovementTime = VirtualClock::Now();
+    m_BestDuration = std::numeric_limits<double>::max();
+    m_ReferenceDuration = std::numeric_limits<double>::max();
+    m_PassedTime = 0.0;
+    m_ConfigurationsSinceImprovement = 0;
+    m_EvaluatedCount = 0;
+}
+
+void ConvergenceCondition::Update(const KernelResult& result)
+{
+    ++m_EvaluatedCount;
+    ++m_ConfigurationsSinceImprovement;
+    const auto currentTime = VirtualClock::Now();
+
+    if (result.IsValid())
+    {
+        const double duration = static_cast<double>(result.GetTotalDuration()) / 1'000'000.0;
+        m_BestDuration = std::min(m_BestDuration, duration);
+
+        // Small improvements do not reset the window, but they accumulate until the threshold is exceeded
+        if (m_ReferenceDuration == std::numeric_limits<double>::max()
+            || duration < m_ReferenceDuration * (1.0 - m_ImprovementThreshold))
+        {
+            m_ReferenceDuration = duration;
+            m_ConfigurationsSinceImprovement = 0;
+            m_ImprovementTime = currentTime;
+        }
+    }
+
+    const uint64_t passedMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - m_ImprovementTime).count();
+    m_PassedTime = static_cast<double>(passedMilliseconds) / 1'000.0;
+}
+
+std::string ConvergenceCondition::GetStatusString() const
+{
+    std::string result = "Current best known configuration duration: " + std::to_string(m_BestDuration) + "ms, configurations "
+        + "without significant improvement: " + std::to_string(m_ConfigurationsSinceImprovement);
+
+    if (m_ConfigurationWindow > 0)
+    {
+        result += " / " + std::to_string(m_ConfigurationWindow);
+    }
+
+    result += ", time without significant improvement: " + std::to_string(m_PassedTime);
+
+    if (m_TimeWindow > 0.0)
+    {
+        result += " / " + std::to_string(m_TimeWindow);
+    }
+
+    return result + " seconds";
+}
+
+} // namespace ktt
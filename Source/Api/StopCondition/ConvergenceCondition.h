@@ -0,0 +1,54 @@
+/** @file ConvergenceCondition.h
+  * Stop condition based on convergence of the best configuration duration.
+  */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <Api/StopCondition/StopCondition.h>
+#include <KttPlatform.h>
+
+namespace ktt
+{
+
+/** @class ConvergenceCondition
+  * Class which implements stop condition based on convergence of the best configuration duration. The condition is fulfilled
+  * when the best duration has not improved significantly over the specified number of configurations or amount of time.
+  */
+class KTT_API ConvergenceCondition : public StopCondition
+{
+public:
+    /** @fn explicit ConvergenceCondition(const double improvementThreshold, const uint64_t configurationWindow,
+      * const double timeWindow = 0.0, const uint64_t minimumEvaluations = 0)
+      * Initializes convergence condition.
+      * @param improvementThreshold Minimum relative improvement of the best configuration duration which is considered
+      * significant. Specified in percent, e.g., value 1.0 means that new best configuration must be at least 1% faster.
+      * @param configurationWindow Condition will be fulfilled when no significant improvement is found within the specified
+      * number of tested configurations. Value 0 disables this check.
+      * @param timeWindow Condition will be fulfilled when no significant improvement is found within the specified amount of time.
+      * The time is specified in seconds. Value 0.0 disables this check.
+      * @param minimumEvaluations Condition cannot be fulfilled before the specified number of configurations is tested.
+      */
+    explicit ConvergenceCondition(const double improvementThreshold, const uint64_t configurationWindow,
+        const double timeWindow = 0.0, const uint64_t minimumEvaluations = 0);
+
+    bool IsFulfilled() const override;
+    void Initialize(const uint64_t configurationsCount) override;
+    void Update(const KernelResult& result) override;
+    std::string GetStatusString() const override;
+
+private:
+    std::chrono::steady_clock::time_point m_ImprovementTime;
+    double m_BestDuration;
+    double m_ReferenceDuration;
+    double m_ImprovementThreshold;
+    double m_PassedTime;
+    double m_TimeWindow;
+    uint64_t m_ConfigurationsSinceImprovement;
+    uint64_t m_ConfigurationWindow;
+    uint64_t m_EvaluatedCount;
+    uint64_t m_MinimumEvaluations;
+};
+
+} // namespace ktt
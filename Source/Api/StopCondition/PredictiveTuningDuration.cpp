@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Api/StopCondition/PredictiveTuningDuration.h>
+#include <Utility/Timer/VirtualClock.h>
+
+namespace ktt
+{
+
+PredictiveTuningDuration::PredictiveTuningDuration(const double duration, const double safetyFactor) :
+    m_PassedTime(0.0),
+    m_TargetTime(std::max(0.0, duration)),
+    m_SafetyFactor(std::max(0.0, safetyFactor)),
+    m_EvaluatedCount(0),
+    m_CompilationTime(0.0),
+    m_DataMovementTime(0.0),
+    m_KernelTime(0.0),
+    m_ValidationTime(0.0),
+    m_SearcherTime(0.0),
+    m_OtherTime(0.0)
+{}
+
+bool PredictiveTuningDuration::IsFulfilled() const
+{
+    if (m_PassedTime >= m_TargetTime)
+    {
+        return true;
+    }
+
+    return m_EvaluatedCount > 0 && GetPredictedEvaluationTime() * m_SafetyFactor > GetRemainingTime();
+}
+
+void PredictiveTuningDuration::Initialize([[maybe_unused]] const uint64_t configurationsCount)
+{
+    m_InitialTime = VirtualClock::Now();
+    m_LastUpdateTime = m_InitialTime;
+    m_PassedTime = 0.0;
+    m_EvaluatedCount = 0;
+    m_CompilationTime = 0.0;
+    m_DataMovementTime = 0.0;
+    m_KernelTime = 0.0;
+    m_ValidationTime = 0.0;
+    m_SearcherTime = 0.0;
+    m_OtherTime = 0.0;
+}
+
+void PredictiveTuningDuration::Update(const KernelResult& result)
+{
+    const auto currentTime = VirtualClock::Now();
+    const auto wallNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - m_LastUpdateTime).count();
+    const auto passedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - m_InitialTime).count();
+    m_LastUpdateTime = currentTime;
+    m_PassedTime = static_cast<double>(passedNanoseconds) / 1'000'000'000.0;
+
+    const auto toSeconds = [](const Nanoseconds duration)
+    {
+        return static_cast<double>(duration) / 1'000'000'000.0;
+    };
+
+    const double compilation = toSeconds(result.GetCompilationOverhead());
+    const double dataMovement = toSeconds(result.GetDataMovementOverhead());
+    const double kernel = toSeconds(result.GetTotalDuration() + result.GetKernelOverhead() + result.GetProfilingRunsOverhead()
+        + result.GetFailedKernelOverhead());
+    const double validation = toSeconds(result.GetValidationOverhead());
+    const double searcher = toSeconds(result.GetSearcherOverhead());
+    const double wall = static_cast<double>(wallNanoseconds) / 1'000'000'000.0;
+
+    // Time spent outside of measured parts (e.g., buffer preparation in tuner) is tracked separately, so that the prediction
+    // matches the real duration of evaluations
+    const double other = std::max(0.0, wall - compilation - dataMovement - kernel - validation - searcher);
+
+    ++m_EvaluatedCount;
+    const auto count = static_cast<double>(m_EvaluatedCount);
+    m_CompilationTime += (compilation - m_CompilationTime) / count;
+    m_DataMovementTime += (dataMovement - m_DataMovementTime) / count;
+    m_KernelTime += (kernel - m_KernelTime) / count;
+    m_ValidationTime += (validation - m_ValidationTime) / count;
+    m_SearcherTime += (searcher - m_SearcherTime) / count;
+    m_OtherTime += (other - m_OtherTime) / count;
+}
+
+std::string PredictiveTuningDuration::GetStatusString() const
+{
+    return "Current tuning time: " + std::to_string(m_PassedTime) + " / " + std::to_string(m_TargetTime) + " seconds, predicted "
+        + "evaluation time: " + std::to_string(GetPredictedEvaluationTime() * 1'000.0) + "ms (compilation: "
+        + std::to_string(m_CompilationTime * 1'000.0) + "ms, data movement: " + std::to_string(m_DataMovementTime * 1'000.0)
+        + "ms, kernel: " + std::to_string(m_KernelTime * 1'000.0) + "ms, validation: " + std::to_string(m_ValidationTime * 1'000.0)
+        + "ms, searcher: " + std::to_string(m_SearcherTime * 1'000.0) + "ms, other: " + std::to_string(m_OtherTime * 1'000.0)
+        + "ms), predicted remaining configurations: " + std::to_string(GetPredictedRemainingCount());
+}
+
+double PredictiveTuningDuration::GetPredictedEvaluationTime() const
+{
+    return m_CompilationTime + m_DataMovementTime + m_KernelTime + m_ValidationTime + m_SearcherTime + m_OtherTime;
+}
+
+uint64_t PredictiveTuningDuration::GetPredictedRemainingCount() const
+{
+    const double evaluationTime = GetPredictedEvaluationTime() * m_SafetyFactor;
+
+    if (evaluationTime <= 0.0)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(std::floor(GetRemainingTime() / evaluationTime));
+}
+
+double PredictiveTuningDuration::GetRemainingTime() const
+{
+    return std::max(0.0, m_TargetTime - m_PassedTime);
+}
+
+} // namespace ktt
@@ -0,0 +1,66 @@
+/** @file PredictiveTuningDuration.h
+  * Stop condition based on total tuning duration and predicted duration of the next configuration evaluation.
+  */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <Api/StopCondition/StopCondition.h>
+#include <KttPlatform.h>
+
+namespace ktt
+{
+
+/** @class PredictiveTuningDuration
+  * Class which implements stop condition based on total tuning duration. Unlike TuningDuration, the condition tracks running
+  * averages of compilation, data movement, kernel, validation, searcher and remaining overhead of tested configurations. It is
+  * fulfilled as soon as the predicted duration of the next evaluation does not fit into the remaining time budget.
+  */
+class KTT_API PredictiveTuningDuration : public StopCondition
+{
+public:
+    /** @fn explicit PredictiveTuningDuration(const double duration, const double safetyFactor = 1.0)
+      * Initializes predictive tuning duration condition.
+      * @param duration Time budget for the tuning. The measurement starts when kernel tuning begins. Duration is specified
+      * in seconds.
+      * @param safetyFactor Predicted duration of the next evaluation is multiplied by this factor before it is compared with
+      * the remaining budget. Values above 1.0 make the condition more conservative.
+      */
+    explicit PredictiveTuningDuration(const double duration, const double safetyFactor = 1.0);
+
+    bool IsFulfilled() const override;
+    void Initialize(const uint64_t configurationsCount) override;
+    void Update(const KernelResult& result) override;
+    std::string GetStatusString() const override;
+
+    /** @fn double GetPredictedEvaluationTime() const
+      * Returns predicted duration of the next configuration evaluation including all overheads.
+      * @return Predicted duration in seconds. Returns 0.0 if no configuration has been evaluated yet.
+      */
+    double GetPredictedEvaluationTime() const;
+
+    /** @fn uint64_t GetPredictedRemainingCount() const
+      * Returns predicted number of configurations which can still be evaluated within the remaining budget.
+      * @return Predicted number of configurations.
+      */
+    uint64_t GetPredictedRemainingCount() const;
+
+private:
+    std::chrono::steady_clock::time_point m_InitialTime;
+    std::chrono::steady_clock::time_point m_LastUpdateTime;
+    double m_PassedTime;
+    double m_TargetTime;
+    double m_SafetyFactor;
+    uint64_t m_EvaluatedCount;
+    double m_CompilationTime;
+    double m_DataMovementTime;
+    double m_KernelTime;
+    double m_ValidationTime;
+    double m_SearcherTime;
+    double m_OtherTime;
+
+    double GetRemainingTime() const;
+};
+
+} // namespace ktt
@@ -1,6 +1,7 @@
 #include <algorithm>
 
 #include <Api/StopCondition/TuningDuration.h>
+#include <Utility/Timer/VirtualClock.h>
 
 namespace ktt
 {
@@ -17,13 +18,13 @@ bool TuningDuration::IsFulfilled() const
 
 void TuningDuration::Initialize([[maybe_unused]] const uint64_t configurationsCount)
 {
-    m_InitialTime = std::chrono::steady_clock::now();
+    m_InitialTime = VirtualClock::Now();
     m_PassedTime = 0.0;
 }
 
 void TuningDuration::Update([[maybe_unused]] const KernelResult& result)
 {
-    const auto currentTime = std::chrono::steady_clock::now();
+    const auto currentTime = VirtualClock::Now();
     const uint64_t passedMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - m_InitialTime).count();
     m_PassedTime = static_cast<double>(passedMilliseconds) / 1'000.0;
 }
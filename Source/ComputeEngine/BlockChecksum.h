@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ktt
+{
+
+// Checksum of a contiguous block of buffer elements, sums are accumulated in double precision regardless of element type
+struct BlockChecksum
+{
+    uint64_t m_ElementCount;
+    double m_Sum;
+    double m_AbsoluteSum;
+    uint64_t m_IntegerSum;
+};
+
+} // namespace ktt
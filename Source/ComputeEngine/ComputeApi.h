@@ -21,7 +21,12 @@ enum class ComputeApi
 
     /** Tuner will use Vulkan as compute API.
     */
-    Vulkan
+    Vulkan,
+
+    /** Tuner will run kernels as C++ functions on the host processor. Kernel functions are registered with kernel definitions,
+      * each compute queue corresponds to a single host thread.
+      */
+    Host
 };
 
 } // namespace ktt
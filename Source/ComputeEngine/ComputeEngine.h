@@ -4,11 +4,15 @@
 #include <vector>
 
 #include <Api/Info/DeviceInfo.h>
+#include <Api/Info/KernelCacheStatistics.h>
+#include <Api/Info/TransferStatistics.h>
 #include <Api/Info/PlatformInfo.h>
 #include <Api/Output/ComputationResult.h>
+#include <ComputeEngine/BlockChecksum.h>
 #include <ComputeEngine/ComputeApi.h>
 #include <ComputeEngine/KernelComputeData.h>
 #include <ComputeEngine/GlobalSizeType.h>
+#include <ComputeEngine/KernelCachePolicy.h>
 #include <ComputeEngine/TransferResult.h>
 #include <KernelArgument/KernelArgument.h>
 #include <KttTypes.h>
@@ -26,6 +30,8 @@ public:
     virtual ComputationResult WaitForComputeAction(const ComputeActionId id) = 0;
     virtual void ClearData(const KernelComputeId& id) = 0;
     virtual void ClearKernelData(const std::string& kernelName) = 0;
+    virtual void CompileKernelAsync(const KernelComputeData& data) = 0;
+    virtual void PrecompileKernels(const std::vector<KernelComputeData>& data) = 0;
 
     // Profiling methods
     virtual ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) = 0;
@@ -54,6 +60,10 @@ public:
     virtual void ClearBuffers() = 0;
     virtual bool HasBuffer(const ArgumentId& id) = 0;
 
+    // Returns false if the backend cannot compute checksums of the buffer on the device
+    virtual bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) = 0;
+
     // Queue methods
     virtual QueueId AddComputeQueue(ComputeQueue queue) = 0;
     virtual void RemoveComputeQueue(const QueueId id) = 0;
@@ -70,13 +80,19 @@ public:
     virtual DeviceInfo GetCurrentDeviceInfo() const = 0;
     virtual ComputeApi GetComputeApi() const = 0;
     virtual GlobalSizeType GetGlobalSizeType() const = 0;
+    virtual KernelCacheStatistics GetKernelCacheStatistics() const = 0;
+    virtual TransferStatistics GetTransferStatistics() const = 0;
 
     // Utility methods
     virtual void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) = 0;
     virtual void SetGlobalSizeType(const GlobalSizeType type) = 0;
     virtual void SetAutomaticGlobalSizeCorrection(const bool flag) = 0;
     virtual void SetKernelCacheCapacity(const uint64_t capacity) = 0;
+    virtual void SetKernelCacheMemoryLimit(const uint64_t limit) = 0;
+    virtual void SetKernelCachePolicy(const KernelCachePolicy policy) = 0;
     virtual void ClearKernelCache() = 0;
+    virtual void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) = 0;
+    virtual void SetStagingMemoryLimit(const uint64_t limit) = 0;
     virtual void EnsureThreadContext() = 0;
 };
 
@@ -0,0 +1,46 @@
+#ifdef KTT_API_CUDA
+
+#include <string>
+
+#include <ComputeEngine/Cuda/Buffers/CudaStagingBuffer.h>
+#include <ComputeEngine/Cuda/CudaUtility.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+CudaStagingBuffer::CudaStagingBuffer(const size_t size) :
+    m_Pointer(nullptr),
+    m_Size(size)
+{
+    Logger::LogDebug("Initializing CUDA staging buffer with size " + std::to_string(size));
+    CheckError(cuMemHostAlloc(&m_Pointer, size, 0), "cuMemHostAlloc");
+}
+
+CudaStagingBuffer::~CudaStagingBuffer()
+{
+    Logger::LogDebug("Releasing CUDA staging buffer with size " + std::to_string(m_Size));
+
+    // Transfer which used the buffer last may still be in progress
+    m_Fence.WaitForFinish();
+    CheckError(cuMemFreeHost(m_Pointer), "cuMemFreeHost");
+}
+
+void* CudaStagingBuffer::GetPointer() const
+{
+    return m_Pointer;
+}
+
+size_t CudaStagingBuffer::GetSize() const
+{
+    return m_Size;
+}
+
+const CudaEvent& CudaStagingBuffer::GetFence() const
+{
+    return m_Fence;
+}
+
+} // namespace ktt
+
+#endif // KTT_API_CUDA
@@ -0,0 +1,30 @@
+#pragma once
+
+#ifdef KTT_API_CUDA
+
+#include <cstddef>
+
+#include <ComputeEngine/Cuda/CudaEvent.h>
+
+namespace ktt
+{
+
+class CudaStagingBuffer
+{
+public:
+    explicit CudaStagingBuffer(const size_t size);
+    ~CudaStagingBuffer();
+
+    void* GetPointer() const;
+    size_t GetSize() const;
+    const CudaEvent& GetFence() const;
+
+private:
+    void* m_Pointer;
+    size_t m_Size;
+    CudaEvent m_Fence;
+};
+
+} // namespace ktt
+
+#endif // KTT_API_CUDA
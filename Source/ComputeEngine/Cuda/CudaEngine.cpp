@@ -1,5 +1,9 @@
 #ifdef KTT_API_CUDA
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 #include <Api/KttException.h>
 #include <ComputeEngine/Cuda/Buffers/CudaDeviceBuffer.h>
 #include <ComputeEngine/Cuda/Buffers/CudaHostBuffer.h>
@@ -30,6 +34,10 @@ CudaEngine::CudaEngine(const DeviceIndex deviceIndex, const uint32_t queueCount)
     m_Configuration(GlobalSizeType::CUDA),
     m_DeviceIndex(deviceIndex),
     m_DeviceInfo(0, ""),
+    m_StagingPool([](const size_t size)
+    {
+        return std::make_unique<CudaStagingBuffer>(size);
+    }),
     m_KernelCache(10)
 {
     Logger::LogDebug("Initializing CUDA");
@@ -67,6 +75,10 @@ CudaEngine::CudaEngine(const DeviceIndex deviceIndex, const uint32_t queueCount)
 CudaEngine::CudaEngine(const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds) :
     m_Configuration(GlobalSizeType::CUDA),
     m_DeviceInfo(0, ""),
+    m_StagingPool([](const size_t size)
+    {
+        return std::make_unique<CudaStagingBuffer>(size);
+    }),
     m_KernelCache(10)
 {
     m_Context = std::make_unique<CudaContext>(initializer.GetContext());
@@ -215,6 +227,16 @@ void CudaEngine::ClearKernelData(const std::string& kernelName)
 #endif // KTT_PROFILING_CUPTI_LEGACY || KTT_PROFILING_CUPTI
 }
 
+void CudaEngine::CompileKernelAsync([[maybe_unused]] const KernelComputeData& data)
+{
+    // Background compilation is not supported, kernel is compiled on its first launch
+}
+
+void CudaEngine::PrecompileKernels([[maybe_unused]] const std::vector<KernelComputeData>& data)
+{
+    throw KttException("Kernel precompilation is not yet supported for CUDA backend");
+}
+
 ComputationResult CudaEngine::RunKernelWithProfiling([[maybe_unused]] const KernelComputeData& data, [[maybe_unused]] const QueueId queueId)
 {
 #ifdef KTT_PROFILING_CUPTI_LEGACY
@@ -417,9 +439,13 @@ TransferActionId CudaEngine::UploadArgument(KernelArgument& kernelArgument, cons
     auto buffer = CreateBuffer(kernelArgument);
     timer.Stop();
 
-    auto action = buffer->UploadData(*m_Streams[queueId], kernelArgument.GetData(), kernelArgument.GetDataSize());
+    const size_t dataSize = kernelArgument.GetDataSize();
+    const bool staged = IsStagingUsed(*buffer, dataSize);
+    auto action = staged ? UploadStaged(*buffer, *m_Streams[queueId], kernelArgument.GetData(), dataSize)
+        : buffer->UploadData(*m_Streams[queueId], kernelArgument.GetData(), dataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddUpload(actionId, dataSize, staged);
 
     m_Buffers[id] = std::move(buffer);
     m_TransferActions[actionId] = std::move(action);
@@ -455,9 +481,12 @@ TransferActionId CudaEngine::UpdateArgument(const ArgumentId& id, const QueueId
 
     timer.Stop();
 
-    auto action = buffer.UploadData(*m_Streams[queueId], data, actualDataSize);
+    const bool staged = IsStagingUsed(buffer, actualDataSize);
+    auto action = staged ? UploadStaged(buffer, *m_Streams[queueId], data, actualDataSize)
+        : buffer.UploadData(*m_Streams[queueId], data, actualDataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddUpload(actionId, actualDataSize, staged);
     m_TransferActions[actionId] = std::move(action);
     return actionId;
 }
@@ -490,9 +519,12 @@ TransferActionId CudaEngine::DownloadArgument(const ArgumentId& id, const QueueI
 
     timer.Stop();
 
-    auto action = buffer.DownloadData(*m_Streams[queueId], destination, actualDataSize);
+    const bool staged = IsStagingUsed(buffer, actualDataSize);
+    auto action = staged ? DownloadStaged(buffer, *m_Streams[queueId], destination, actualDataSize)
+        : buffer.DownloadData(*m_Streams[queueId], destination, actualDataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddDownload(actionId, actualDataSize, staged);
     m_TransferActions[actionId] = std::move(action);
     return actionId;
 }
@@ -551,6 +583,7 @@ TransferResult CudaEngine::WaitForTransferAction(const TransferActionId id)
     action.WaitForFinish();
     auto result = action.GenerateResult();
 
+    m_TransferMonitor.FinishTransfer(id, result);
     m_TransferActions.erase(id);
     return result;
 }
@@ -613,6 +646,13 @@ bool CudaEngine::HasBuffer(const ArgumentId& id)
     return ContainsKey(m_Buffers, id);
 }
 
+bool CudaEngine::ComputeBlockChecksums([[maybe_unused]] const ArgumentId& id, [[maybe_unused]] const ArgumentDataType dataType,
+    [[maybe_unused]] const size_t elementCount, [[maybe_unused]] const size_t blockSize, [[maybe_unused]] const QueueId queueId,
+    [[maybe_unused]] std::vector<BlockChecksum>& checksums)
+{
+    return false;
+}
+
 QueueId CudaEngine::AddComputeQueue(ComputeQueue queue)
 {
     if (!m_Context->IsUserOwned())
@@ -738,6 +778,26 @@ GlobalSizeType CudaEngine::GetGlobalSizeType() const
     return m_Configuration.GetGlobalSizeType();
 }
 
+KernelCacheStatistics CudaEngine::GetKernelCacheStatistics() const
+{
+    KernelCacheStatistics statistics;
+    statistics.m_HitCount = m_KernelCache.GetHitCount();
+    statistics.m_MissCount = m_KernelCache.GetMissCount();
+    statistics.m_EvictionCount = m_KernelCache.GetEvictionCount();
+    statistics.m_EntryCount = static_cast<uint64_t>(m_KernelCache.Size());
+    statistics.m_MemorySize = m_KernelCache.GetMemorySize();
+    return statistics;
+}
+
+TransferStatistics CudaEngine::GetTransferStatistics() const
+{
+    TransferStatistics statistics = m_TransferMonitor.GetStatistics();
+    statistics.m_StagingAllocationCount = m_StagingPool.GetAllocationCount();
+    statistics.m_StagingReuseCount = m_StagingPool.GetReuseCount();
+    statistics.m_StagingMemorySize = m_StagingPool.GetMemorySize();
+    return statistics;
+}
+
 void CudaEngine::SetCompilerOptions(const std::string& options, const bool overrideDefault)
 {
     std::string finalOptions = options;
@@ -771,11 +831,32 @@ void CudaEngine::SetKernelCacheCapacity(const uint64_t capacity)
     m_KernelCache.SetMaxSize(static_cast<size_t>(capacity));
 }
 
+void CudaEngine::SetKernelCacheMemoryLimit(const uint64_t limit)
+{
+    m_KernelCache.SetMemoryLimit(limit);
+}
+
+void CudaEngine::SetKernelCachePolicy(const KernelCachePolicy policy)
+{
+    m_KernelCache.SetSegmented(policy == KernelCachePolicy::SegmentedLeastRecentlyUsed);
+}
+
 void CudaEngine::ClearKernelCache()
 {
     m_KernelCache.Clear();
 }
 
+void CudaEngine::SetKernelBinaryCache([[maybe_unused]] const std::string& directory,
+    [[maybe_unused]] const uint64_t maximumSize)
+{
+    throw KttException("Kernel binary cache is not yet supported for CUDA backend");
+}
+
+void CudaEngine::SetStagingMemoryLimit(const uint64_t limit)
+{
+    m_StagingPool.SetMemoryLimit(limit);
+}
+
 void CudaEngine::EnsureThreadContext()
 {
     m_Context->EnsureThreadContext();
@@ -785,9 +866,14 @@ std::shared_ptr<CudaKernel> CudaEngine::LoadKernel(const KernelComputeData& data
 {
     const auto id = data.GetUniqueIdentifier();
 
-    if (m_KernelCache.GetMaxSize() > 0 && m_KernelCache.Exists(id))
+    if (m_KernelCache.GetMaxSize() > 0)
     {
-        return m_KernelCache.Get(id)->second;
+        const auto cachedItem = m_KernelCache.Get(id);
+
+        if (cachedItem != m_KernelCache.End())
+        {
+            return cachedItem->second;
+        }
     }
 
     const auto symbolArguments = KernelArgument::GetArgumentsWithMemoryType(data.GetArguments(), ArgumentMemoryType::Symbol);
@@ -796,7 +882,7 @@ std::shared_ptr<CudaKernel> CudaEngine::LoadKernel(const KernelComputeData& data
 
     if (m_KernelCache.GetMaxSize() > 0)
     {
-        m_KernelCache.Put(id, kernel);
+        m_KernelCache.Put(id, kernel, kernel->GetMemorySize());
     }
 
     return kernel;
@@ -945,6 +1031,137 @@ void CudaEngine::ClearStreamActions(const QueueId id)
     });
 }
 
+bool CudaEngine::IsStagingUsed(const CudaBuffer& buffer, const size_t dataSize) const
+{
+    return m_StagingPool.IsEnabled() && buffer.GetMemoryLocation() == ArgumentMemoryLocation::Device
+        && dataSize >= m_StagingThreshold;
+}
+
+std::unique_ptr<CudaTransferAction> CudaEngine::UploadStaged(const CudaBuffer& buffer, const CudaStream& stream,
+    const void* source, const size_t dataSize)
+{
+    Logger::LogDebug("Uploading data into CUDA buffer with id " + buffer.GetArgumentId() + " through staging buffers");
+
+    if (buffer.GetSize() < dataSize)
+    {
+        throw KttException("Size of data to upload is larger than size of buffer");
+    }
+
+    auto action = std::make_unique<CudaTransferAction>(m_TransferIdGenerator.GenerateId(), stream.GetId());
+    CheckError(cuEventRecord(action->GetStartEvent(), stream.GetStream()), "cuEventRecord");
+
+    const size_t chunkSize = m_StagingPool.GetChunkSize();
+    const auto* sourceBytes = static_cast<const uint8_t*>(source);
+    std::array<StagingBufferPool<CudaStagingBuffer>::Lease, 2> leases;
+
+    // Two staging buffers are used alternately, the transfer is asynchronous and each buffer is only rewritten once its fence
+    // signals that the previous transfer from it finished
+    for (size_t offset = 0, chunk = 0; offset < dataSize; offset += chunkSize, ++chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t size = std::min(chunkSize, dataSize - offset);
+
+        if (!leases[slot].IsValid())
+        {
+            leases[slot] = m_StagingPool.Acquire(size);
+        }
+
+        if (!leases[slot].IsValid())
+        {
+            // Staging memory limit was reached, the remaining data are transferred directly
+            CheckError(cuMemcpyHtoDAsync(*buffer.GetBuffer() + offset, sourceBytes + offset, dataSize - offset,
+                stream.GetStream()), "cuMemcpyHtoDAsync");
+            break;
+        }
+
+        const auto& staging = leases[slot].GetBuffer();
+        staging.GetFence().WaitForFinish();
+        std::memcpy(staging.GetPointer(), sourceBytes + offset, size);
+        CheckError(cuMemcpyHtoDAsync(*buffer.GetBuffer() + offset, staging.GetPointer(), size, stream.GetStream()),
+            "cuMemcpyHtoDAsync");
+        CheckError(cuEventRecord(staging.GetFence().GetEvent(), stream.GetStream()), "cuEventRecord");
+    }
+
+    CheckError(cuEventRecord(action->GetEndEvent(), stream.GetStream()), "cuEventRecord");
+    return action;
+}
+
+std::unique_ptr<CudaTransferAction> CudaEngine::DownloadStaged(const CudaBuffer& buffer, const CudaStream& stream,
+    void* destination, const size_t dataSize)
+{
+    Logger::LogDebug("Downloading data from CUDA buffer with id " + buffer.GetArgumentId() + " through staging buffers");
+
+    if (buffer.GetSize() < dataSize)
+    {
+        throw KttException("Size of data to download is larger than size of buffer");
+    }
+
+    auto action = std::make_unique<CudaTransferAction>(m_TransferIdGenerator.GenerateId(), stream.GetId());
+    CheckError(cuEventRecord(action->GetStartEvent(), stream.GetStream()), "cuEventRecord");
+
+    const size_t chunkSize = m_StagingPool.GetChunkSize();
+    const size_t chunkCount = (dataSize + chunkSize - 1) / chunkSize;
+    auto* destinationBytes = static_cast<uint8_t*>(destination);
+    std::array<StagingBufferPool<CudaStagingBuffer>::Lease, 2> leases;
+
+    const auto enqueueChunk = [&](const size_t chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t offset = chunk * chunkSize;
+        const size_t size = std::min(chunkSize, dataSize - offset);
+
+        if (!leases[slot].IsValid())
+        {
+            leases[slot] = m_StagingPool.Acquire(size);
+
+            if (!leases[slot].IsValid())
+            {
+                return false;
+            }
+        }
+
+        const auto& staging = leases[slot].GetBuffer();
+        staging.GetFence().WaitForFinish();
+        CheckError(cuMemcpyDtoHAsync(staging.GetPointer(), *buffer.GetBuffer() + offset, size, stream.GetStream()),
+            "cuMemcpyDtoHAsync");
+        CheckError(cuEventRecord(staging.GetFence().GetEvent(), stream.GetStream()), "cuEventRecord");
+        return true;
+    };
+
+    size_t enqueuedCount = 0;
+
+    while (enqueuedCount < std::min<size_t>(2, chunkCount) && enqueueChunk(enqueuedCount))
+    {
+        ++enqueuedCount;
+    }
+
+    // Transfer of the next chunk is enqueued as soon as a staging buffer is copied out, so that both directions overlap
+    for (size_t chunk = 0; chunk < enqueuedCount; ++chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t offset = chunk * chunkSize;
+        const auto& staging = leases[slot].GetBuffer();
+        staging.GetFence().WaitForFinish();
+        std::memcpy(destinationBytes + offset, staging.GetPointer(), std::min(chunkSize, dataSize - offset));
+
+        if (enqueuedCount < chunkCount && enqueueChunk(enqueuedCount))
+        {
+            ++enqueuedCount;
+        }
+    }
+
+    if (enqueuedCount < chunkCount)
+    {
+        // Staging memory limit was reached, the remaining data are transferred directly
+        const size_t offset = enqueuedCount * chunkSize;
+        CheckError(cuMemcpyDtoHAsync(destinationBytes + offset, *buffer.GetBuffer() + offset, dataSize - offset,
+            stream.GetStream()), "cuMemcpyDtoHAsync");
+    }
+
+    CheckError(cuEventRecord(action->GetEndEvent(), stream.GetStream()), "cuEventRecord");
+    return action;
+}
+
 #if defined(KTT_PROFILING_CUPTI)
 
 void CudaEngine::InitializeCupti()
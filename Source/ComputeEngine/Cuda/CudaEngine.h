@@ -10,11 +10,14 @@
 #include <ComputeEngine/Cuda/Actions/CudaComputeAction.h>
 #include <ComputeEngine/Cuda/Actions/CudaTransferAction.h>
 #include <ComputeEngine/Cuda/Buffers/CudaBuffer.h>
+#include <ComputeEngine/Cuda/Buffers/CudaStagingBuffer.h>
 #include <ComputeEngine/Cuda/CudaContext.h>
 #include <ComputeEngine/Cuda/CudaKernel.h>
 #include <ComputeEngine/Cuda/CudaStream.h>
 #include <ComputeEngine/ComputeEngine.h>
 #include <ComputeEngine/EngineConfiguration.h>
+#include <ComputeEngine/StagingBufferPool.h>
+#include <ComputeEngine/TransferMonitor.h>
 #include <Utility/IdGenerator.h>
 #include <Utility/LruCache.h>
 
@@ -44,6 +47,8 @@ public:
     ComputationResult WaitForComputeAction(const ComputeActionId id) override;
     void ClearData(const KernelComputeId& id) override;
     void ClearKernelData(const std::string& kernelName) override;
+    void CompileKernelAsync(const KernelComputeData& data) override;
+    void PrecompileKernels(const std::vector<KernelComputeData>& data) override;
 
     // Profiling methods
     ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) override;
@@ -70,6 +75,8 @@ public:
     void ClearBuffer(const ArgumentId& id) override;
     void ClearBuffers() override;
     bool HasBuffer(const ArgumentId& id) override;
+    bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) override;
 
     // Queue methods
     QueueId AddComputeQueue(ComputeQueue queue) override;
@@ -87,13 +94,19 @@ public:
     DeviceInfo GetCurrentDeviceInfo() const override;
     ComputeApi GetComputeApi() const override;
     GlobalSizeType GetGlobalSizeType() const override;
+    KernelCacheStatistics GetKernelCacheStatistics() const override;
+    TransferStatistics GetTransferStatistics() const override;
 
     // Utility methods
     void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) override;
     void SetGlobalSizeType(const GlobalSizeType type) override;
     void SetAutomaticGlobalSizeCorrection(const bool flag) override;
     void SetKernelCacheCapacity(const uint64_t capacity) override;
+    void SetKernelCacheMemoryLimit(const uint64_t limit) override;
+    void SetKernelCachePolicy(const KernelCachePolicy policy) override;
     void ClearKernelCache() override;
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) override;
+    void SetStagingMemoryLimit(const uint64_t limit) override;
     void EnsureThreadContext() override;
 
 private:
@@ -105,6 +118,8 @@ private:
     IdGenerator<TransferActionId> m_TransferIdGenerator;
     std::unique_ptr<CudaContext> m_Context;
     std::map<QueueId, std::unique_ptr<CudaStream>> m_Streams;
+    StagingBufferPool<CudaStagingBuffer> m_StagingPool;
+    TransferMonitor m_TransferMonitor;
     std::map<ArgumentId, std::unique_ptr<CudaBuffer>> m_Buffers;
     LruCache<KernelComputeId, std::shared_ptr<CudaKernel>> m_KernelCache;
     std::map<ComputeActionId, std::unique_ptr<CudaComputeAction>> m_ComputeActions;
@@ -130,6 +145,11 @@ private:
     std::unique_ptr<CudaBuffer> CreateUserBuffer(KernelArgument& argument, ComputeBuffer buffer);
     std::string GetDefaultCompilerOptions() const;
     void ClearStreamActions(const QueueId id);
+    bool IsStagingUsed(const CudaBuffer& buffer, const size_t dataSize) const;
+    std::unique_ptr<CudaTransferAction> UploadStaged(const CudaBuffer& buffer, const CudaStream& stream, const void* source,
+        const size_t dataSize);
+    std::unique_ptr<CudaTransferAction> DownloadStaged(const CudaBuffer& buffer, const CudaStream& stream, void* destination,
+        const size_t dataSize);
 
 #if defined(KTT_PROFILING_CUPTI)
     void InitializeCupti();
@@ -139,6 +159,9 @@ private:
     void InitializeProfiling(const KernelComputeId& id);
     void FillProfilingData(const KernelComputeId& id, ComputationResult& result);
 #endif // KTT_PROFILING_CUPTI || KTT_PROFILING_CUPTI_LEGACY
+
+    // Small transfers do not benefit from staging, since the extra copy costs more than the slower transfer from pageable memory
+    inline static const size_t m_StagingThreshold = 1 << 16;
 };
 
 } // namespace ktt
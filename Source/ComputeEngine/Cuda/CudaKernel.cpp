@@ -26,6 +26,7 @@ CudaKernel::CudaKernel(IdGenerator<ComputeActionId>& generator, const EngineConf
     m_Program->Build(m_Configuration.GetCompilerOptions());
 
     const std::string ptx = m_Program->GetPtxSource();
+    m_ModuleSize = static_cast<uint64_t>(ptx.size());
     CheckError(cuModuleLoadDataEx(&m_Module, ptx.data(), 0, nullptr, nullptr), "cuModuleLoadDataEx");
 
     const std::string loweredName = m_Program->GetLoweredName();
@@ -104,6 +105,12 @@ uint64_t CudaKernel::GetAttribute(const CUfunction_attribute attribute) const
     return static_cast<uint64_t>(value);
 }
 
+uint64_t CudaKernel::GetMemorySize() const
+{
+    // Constant memory of the module is allocated on device for as long as the kernel is loaded
+    return m_ModuleSize + GetAttribute(CU_FUNC_ATTRIBUTE_CONST_SIZE_BYTES);
+}
+
 DimensionVector CudaKernel::AdjustGlobalSize(const DimensionVector& globalSize, const DimensionVector& localSize) const
 {
     DimensionVector result = globalSize;
@@ -37,6 +37,7 @@ public:
     CUfunction GetKernel() const;
     CUmodule GetModule() const;
     uint64_t GetAttribute(const CUfunction_attribute attribute) const;
+    uint64_t GetMemorySize() const;
 
 private:
     std::string m_Name;
@@ -45,6 +46,7 @@ private:
     const EngineConfiguration& m_Configuration;
     CUfunction m_Kernel;
     CUmodule m_Module;
+    uint64_t m_ModuleSize;
 
     DimensionVector AdjustGlobalSize(const DimensionVector& globalSize, const DimensionVector& localSize) const;
 };
@@ -0,0 +1,665 @@
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <thread>
+
+#include <Api/Configuration/KernelConfiguration.h>
+#include <Api/KttException.h>
+#include <ComputeEngine/Host/HostEngine.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/Logger/Logger.h>
+#include <Utility/Timer/Timer.h>
+#include <Utility/StlHelpers.h>
+#include <Utility/StringUtility.h>
+
+namespace ktt
+{
+
+HostEngine::HostEngine(const PlatformIndex platformIndex, const DeviceIndex deviceIndex, const uint32_t queueCount) :
+    m_Configuration(GlobalSizeType::OpenCL),
+    // All host device indices refer to the same processor, which allows parallel tuning runners on the host
+    m_DeviceInfo(CreateDeviceInfo(deviceIndex))
+{
+    if (platformIndex != 0)
+    {
+        throw KttException("Invalid platform index: " + std::to_string(platformIndex));
+    }
+
+    if (queueCount == 0)
+    {
+        throw KttException("Number of compute queues must be greater than zero");
+    }
+
+    for (uint32_t i = 0; i < queueCount; ++i)
+    {
+        m_Queues.push_back(std::make_unique<ctpl::thread_pool>(1));
+    }
+}
+
+HostEngine::~HostEngine()
+{
+    WaitForQueues();
+}
+
+ComputeActionId HostEngine::RunKernelAsync(const KernelComputeData& data, const QueueId queueId,
+    [[maybe_unused]] const bool powerMeasurementAllowed)
+{
+    CheckQueue(queueId);
+
+    if (!data.GetHostFunction())
+    {
+        throw KttException("Kernel definition with name " + data.GetName() + " does not have a host function");
+    }
+
+    Timer timer;
+    timer.Start();
+
+    std::vector<void*> arguments = GetKernelArguments(data.GetArguments());
+    HostComputeAction action;
+    action.m_QueueId = queueId;
+    action.m_ComputeId = data.GetUniqueIdentifier();
+    action.m_KernelName = data.GetName();
+    action.m_GlobalSize = data.GetGlobalSize();
+    action.m_LocalSize = data.GetLocalSize();
+
+    // Function and configuration are copied, since compute data does not have to outlive the asynchronous run
+    action.m_Duration = m_Queues[static_cast<size_t>(queueId)]->push([function = data.GetHostFunction(),
+        configuration = data.GetConfiguration(), arguments = std::move(arguments)]()
+    {
+        Timer kernelTimer;
+        kernelTimer.Start();
+        function(configuration, arguments);
+        kernelTimer.Stop();
+        return kernelTimer.GetElapsedTime();
+    });
+
+    timer.Stop();
+    action.m_Overhead = timer.GetElapsedTime();
+
+    const auto id = m_ComputeIdGenerator.GenerateId();
+    m_ComputeActions[id] = std::move(action);
+    return id;
+}
+
+ComputationResult HostEngine::WaitForComputeAction(const ComputeActionId id)
+{
+    if (!ContainsKey(m_ComputeActions, id))
+    {
+        throw KttException("Compute action with id " + std::to_string(id) + " was not found");
+    }
+
+    auto& action = m_ComputeActions[id];
+    Nanoseconds duration;
+
+    try
+    {
+        duration = action.m_Duration.get();
+    }
+    catch (const KttException&)
+    {
+        m_ComputeActions.erase(id);
+        throw;
+    }
+    catch (const std::exception& exception)
+    {
+        const std::string name = action.m_KernelName;
+        m_ComputeActions.erase(id);
+        throw KttException("Host function of kernel " + name + " failed with reason: " + exception.what());
+    }
+
+    ComputationResult result(action.m_KernelName);
+    result.SetDurationData(duration, action.m_Overhead, 0);
+    result.SetSizeData(action.m_GlobalSize, action.m_LocalSize);
+
+    m_ComputeActions.erase(id);
+    return result;
+}
+
+void HostEngine::ClearData(const KernelComputeId& id)
+{
+    WaitForQueues();
+
+    EraseIf(m_ComputeActions, [&id](const auto& pair)
+    {
+        return pair.second.m_ComputeId == id;
+    });
+}
+
+void HostEngine::ClearKernelData(const std::string& kernelName)
+{
+    WaitForQueues();
+
+    EraseIf(m_ComputeActions, [&kernelName](const auto& pair)
+    {
+        return StartsWith(pair.second.m_ComputeId, kernelName);
+    });
+}
+
+void HostEngine::CompileKernelAsync([[maybe_unused]] const KernelComputeData& data)
+{
+    // Host functions are compiled together with the application
+}
+
+void HostEngine::PrecompileKernels([[maybe_unused]] const std::vector<KernelComputeData>& data)
+{
+    // Host functions are compiled together with the application
+}
+
+ComputationResult HostEngine::RunKernelWithProfiling([[maybe_unused]] const KernelComputeData& data,
+    [[maybe_unused]] const QueueId queueId)
+{
+    throw KttException("Profiling is not supported for host backend");
+}
+
+void HostEngine::SetProfilingCounters([[maybe_unused]] const std::vector<std::string>& counters)
+{
+    throw KttException("Profiling is not supported for host backend");
+}
+
+bool HostEngine::IsProfilingSessionActive([[maybe_unused]] const KernelComputeId& id)
+{
+    throw KttException("Profiling is not supported for host backend");
+}
+
+uint64_t HostEngine::GetRemainingProfilingRuns([[maybe_unused]] const KernelComputeId& id)
+{
+    throw KttException("Profiling is not supported for host backend");
+}
+
+bool HostEngine::HasAccurateRemainingProfilingRuns() const
+{
+    return false;
+}
+
+bool HostEngine::SupportsMultiInstanceProfiling() const
+{
+    return false;
+}
+
+bool HostEngine::IsProfilingActive() const
+{
+    return false;
+}
+
+void HostEngine::SetProfiling(const bool profiling)
+{
+    if (profiling)
+    {
+        throw KttException("Profiling is not supported for host backend");
+    }
+}
+
+TransferActionId HostEngine::UploadArgument(KernelArgument& kernelArgument, const QueueId queueId)
+{
+    Timer timer;
+    timer.Start();
+
+    const auto id = kernelArgument.GetId();
+    Logger::LogDebug("Uploading buffer for argument with id " + id);
+    CheckQueue(queueId);
+
+    if (ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " already exists");
+    }
+
+    if (kernelArgument.GetMemoryType() != ArgumentMemoryType::Vector)
+    {
+        throw KttException("Argument with id " + id + " is not a vector and cannot be uploaded into buffer");
+    }
+
+    HostBuffer buffer;
+    buffer.m_Size = kernelArgument.GetDataSize();
+    buffer.m_CopyOnWrite = false;
+
+    if (kernelArgument.GetMemoryLocation() == ArgumentMemoryLocation::HostZeroCopy)
+    {
+        buffer.m_Memory = kernelArgument.GetData();
+    }
+    else if (kernelArgument.GetAccessType() == ArgumentAccessType::ReadOnly)
+    {
+        buffer.m_Memory = kernelArgument.GetData();
+        buffer.m_CopyOnWrite = true;
+    }
+    else
+    {
+        // Kernel output must not overwrite the argument data, which is uploaded again before the next run
+        const auto* data = static_cast<const uint8_t*>(kernelArgument.GetData());
+        buffer.m_OwnedData.assign(data, data + buffer.m_Size);
+        buffer.m_Memory = buffer.m_OwnedData.data();
+    }
+
+    m_Buffers[id] = std::move(buffer);
+    timer.Stop();
+
+    const auto actionId = AddTransferAction(timer.GetElapsedTime(), 0);
+    m_TransferMonitor.AddUpload(actionId, kernelArgument.GetDataSize(), false);
+    return actionId;
+}
+
+TransferActionId HostEngine::UpdateArgument(const ArgumentId& id, const QueueId queueId, const void* data, const size_t dataSize)
+{
+    Timer timer;
+    timer.Start();
+
+    Logger::LogDebug("Updating buffer for argument with id " + id);
+    CheckQueue(queueId);
+    WaitForQueue(queueId);
+
+    auto& buffer = GetBuffer(id);
+    const size_t actualDataSize = dataSize == 0 ? buffer.m_Size : dataSize;
+
+    if (actualDataSize > buffer.m_Size)
+    {
+        throw KttException("Size of data exceeds size of buffer for argument with id " + id);
+    }
+
+    std::memcpy(GetWritableMemory(buffer), data, actualDataSize);
+    timer.Stop();
+
+    const auto actionId = AddTransferAction(timer.GetElapsedTime(), 0);
+    m_TransferMonitor.AddUpload(actionId, actualDataSize, false);
+    return actionId;
+}
+
+TransferActionId HostEngine::DownloadArgument(const ArgumentId& id, const QueueId queueId, void* destination,
+    const size_t dataSize)
+{
+    Timer timer;
+    timer.Start();
+
+    Logger::LogDebug("Downloading buffer for argument with id " + id);
+    CheckQueue(queueId);
+    WaitForQueue(queueId);
+
+    const auto& buffer = GetBuffer(id);
+    const size_t actualDataSize = dataSize == 0 ? buffer.m_Size : dataSize;
+
+    if (actualDataSize > buffer.m_Size)
+    {
+        throw KttException("Requested data size exceeds size of buffer for argument with id " + id);
+    }
+
+    // Zero-copy buffers are downloaded into their own memory
+    if (destination != buffer.m_Memory)
+    {
+        std::memcpy(destination, buffer.m_Memory, actualDataSize);
+    }
+
+    timer.Stop();
+
+    const auto actionId = AddTransferAction(timer.GetElapsedTime(), 0);
+    m_TransferMonitor.AddDownload(actionId, actualDataSize, false);
+    return actionId;
+}
+
+TransferActionId HostEngine::CopyArgument(const ArgumentId& destination, const QueueId queueId, const ArgumentId& source,
+    const size_t dataSize)
+{
+    Timer timer;
+    timer.Start();
+
+    Logger::LogDebug("Copying buffer for argument with id " + source + " into buffer for argument with id " + destination);
+    CheckQueue(queueId);
+    WaitForQueue(queueId);
+
+    const auto& sourceBuffer = GetBuffer(source);
+    auto& destinationBuffer = GetBuffer(destination);
+    const size_t actualDataSize = dataSize == 0 ? sourceBuffer.m_Size : dataSize;
+
+    if (actualDataSize > sourceBuffer.m_Size || actualDataSize > destinationBuffer.m_Size)
+    {
+        throw KttException("Size of copied data exceeds size of buffer for argument with id " + source + " or " + destination);
+    }
+
+    std::memmove(GetWritableMemory(destinationBuffer), sourceBuffer.m_Memory, actualDataSize);
+    timer.Stop();
+
+    return AddTransferAction(timer.GetElapsedTime(), 0);
+}
+
+TransferResult HostEngine::WaitForTransferAction(const TransferActionId id)
+{
+    if (!ContainsKey(m_TransferActions, id))
+    {
+        throw KttException("Transfer action with id " + std::to_string(id) + " was not found");
+    }
+
+    const TransferResult result = m_TransferActions[id];
+    m_TransferMonitor.FinishTransfer(id, result);
+    m_TransferActions.erase(id);
+    return result;
+}
+
+void HostEngine::ResizeArgument(const ArgumentId& id, const size_t newSize, const bool preserveData)
+{
+    Logger::LogDebug("Resizing buffer for argument with id " + id);
+    WaitForQueues();
+
+    auto& buffer = GetBuffer(id);
+
+    if (buffer.m_Size == newSize)
+    {
+        return;
+    }
+
+    if (buffer.m_OwnedData.empty() && !buffer.m_CopyOnWrite)
+    {
+        throw KttException("Buffer for argument with id " + id + " uses memory provided by user and cannot be resized");
+    }
+
+    std::vector<uint8_t> data(newSize);
+
+    if (preserveData)
+    {
+        std::memcpy(data.data(), buffer.m_Memory, std::min(buffer.m_Size, newSize));
+    }
+
+    buffer.m_OwnedData = std::move(data);
+    buffer.m_Memory = buffer.m_OwnedData.data();
+    buffer.m_Size = newSize;
+    buffer.m_CopyOnWrite = false;
+}
+
+void HostEngine::GetUnifiedMemoryBufferHandle(const ArgumentId& id, UnifiedBufferMemory& handle)
+{
+    auto& buffer = GetBuffer(id);
+    handle = GetWritableMemory(buffer);
+}
+
+void HostEngine::AddCustomBuffer(KernelArgument& kernelArgument, ComputeBuffer buffer)
+{
+    const auto id = kernelArgument.GetId();
+
+    if (ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " already exists");
+    }
+
+    if (buffer == nullptr)
+    {
+        throw KttException("The custom buffer provided for argument with id " + id + " is null");
+    }
+
+    HostBuffer hostBuffer;
+    hostBuffer.m_Memory = buffer;
+    hostBuffer.m_Size = kernelArgument.GetDataSize();
+    hostBuffer.m_CopyOnWrite = false;
+    m_Buffers[id] = std::move(hostBuffer);
+}
+
+void HostEngine::ClearBuffer(const ArgumentId& id)
+{
+    WaitForQueues();
+    m_Buffers.erase(id);
+}
+
+void HostEngine::ClearBuffers()
+{
+    WaitForQueues();
+    m_Buffers.clear();
+}
+
+bool HostEngine::HasBuffer(const ArgumentId& id)
+{
+    return ContainsKey(m_Buffers, id);
+}
+
+bool HostEngine::ComputeBlockChecksums([[maybe_unused]] const ArgumentId& id, [[maybe_unused]] const ArgumentDataType dataType,
+    [[maybe_unused]] const size_t elementCount, [[maybe_unused]] const size_t blockSize, [[maybe_unused]] const QueueId queueId,
+    [[maybe_unused]] std::vector<BlockChecksum>& checksums)
+{
+    return false;
+}
+
+QueueId HostEngine::AddComputeQueue([[maybe_unused]] ComputeQueue queue)
+{
+    throw KttException("Support for compute queue addition is not available for host backend");
+}
+
+void HostEngine::RemoveComputeQueue([[maybe_unused]] const QueueId id)
+{
+    throw KttException("Support for compute queue removal is not available for host backend");
+}
+
+QueueId HostEngine::GetDefaultQueue() const
+{
+    return static_cast<QueueId>(0);
+}
+
+std::vector<QueueId> HostEngine::GetAllQueues() const
+{
+    std::vector<QueueId> result;
+
+    for (size_t i = 0; i < m_Queues.size(); ++i)
+    {
+        result.push_back(static_cast<QueueId>(i));
+    }
+
+    return result;
+}
+
+void HostEngine::SynchronizeQueue(const QueueId queueId)
+{
+    CheckQueue(queueId);
+    WaitForQueue(queueId);
+    ClearQueueActions(queueId);
+}
+
+void HostEngine::SynchronizeQueues()
+{
+    WaitForQueues();
+
+    for (size_t i = 0; i < m_Queues.size(); ++i)
+    {
+        ClearQueueActions(static_cast<QueueId>(i));
+    }
+}
+
+void HostEngine::SynchronizeDevice()
+{
+    WaitForQueues();
+    m_ComputeActions.clear();
+    m_TransferActions.clear();
+}
+
+std::vector<PlatformInfo> HostEngine::GetPlatformInfo() const
+{
+    PlatformInfo info(0, "Host");
+    info.SetVendor("N/A");
+    info.SetVersion("N/A");
+    info.SetExtensions("N/A");
+    return std::vector<PlatformInfo>{info};
+}
+
+std::vector<DeviceInfo> HostEngine::GetDeviceInfo(const PlatformIndex platformIndex) const
+{
+    if (platformIndex != 0)
+    {
+        throw KttException("Invalid platform index: " + std::to_string(platformIndex));
+    }
+
+    return std::vector<DeviceInfo>{CreateDeviceInfo(0)};
+}
+
+PlatformInfo HostEngine::GetCurrentPlatformInfo() const
+{
+    return GetPlatformInfo()[0];
+}
+
+DeviceInfo HostEngine::GetCurrentDeviceInfo() const
+{
+    return m_DeviceInfo;
+}
+
+ComputeApi HostEngine::GetComputeApi() const
+{
+    return ComputeApi::Host;
+}
+
+GlobalSizeType HostEngine::GetGlobalSizeType() const
+{
+    return m_Configuration.GetGlobalSizeType();
+}
+
+KernelCacheStatistics HostEngine::GetKernelCacheStatistics() const
+{
+    return KernelCacheStatistics();
+}
+
+TransferStatistics HostEngine::GetTransferStatistics() const
+{
+    return m_TransferMonitor.GetStatistics();
+}
+
+void HostEngine::SetCompilerOptions(const std::string& options, [[maybe_unused]] const bool overrideDefault)
+{
+    m_Configuration.SetCompilerOptions(options);
+}
+
+void HostEngine::SetGlobalSizeType(const GlobalSizeType type)
+{
+    m_Configuration.SetGlobalSizeType(type);
+}
+
+void HostEngine::SetAutomaticGlobalSizeCorrection(const bool flag)
+{
+    m_Configuration.SetGlobalSizeCorrection(flag);
+}
+
+void HostEngine::SetKernelCacheCapacity([[maybe_unused]] const uint64_t capacity)
+{
+    // Host functions are not compiled at runtime, so there is nothing to cache
+}
+
+void HostEngine::SetKernelCacheMemoryLimit([[maybe_unused]] const uint64_t limit)
+{}
+
+void HostEngine::SetKernelCachePolicy([[maybe_unused]] const KernelCachePolicy policy)
+{}
+
+void HostEngine::ClearKernelCache()
+{}
+
+void HostEngine::SetKernelBinaryCache([[maybe_unused]] const std::string& directory, [[maybe_unused]] const uint64_t maximumSize)
+{}
+
+void HostEngine::SetStagingMemoryLimit(const uint64_t limit)
+{
+    if (limit > 0)
+    {
+        throw KttException("Staging buffers are not used by host backend");
+    }
+}
+
+void HostEngine::EnsureThreadContext()
+{}
+
+HostEngine::HostBuffer& HostEngine::GetBuffer(const ArgumentId& id)
+{
+    if (!ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " was not found");
+    }
+
+    return m_Buffers[id];
+}
+
+void* HostEngine::GetWritableMemory(HostBuffer& buffer)
+{
+    if (buffer.m_CopyOnWrite)
+    {
+        const auto* data = static_cast<const uint8_t*>(buffer.m_Memory);
+        buffer.m_OwnedData.assign(data, data + buffer.m_Size);
+        buffer.m_Memory = buffer.m_OwnedData.data();
+        buffer.m_CopyOnWrite = false;
+    }
+
+    return buffer.m_Memory;
+}
+
+std::vector<void*> HostEngine::GetKernelArguments(const std::vector<KernelArgument*>& arguments)
+{
+    std::vector<void*> result;
+
+    for (auto* argument : arguments)
+    {
+        switch (argument->GetMemoryType())
+        {
+        case ArgumentMemoryType::Scalar:
+        case ArgumentMemoryType::Symbol:
+            result.push_back(argument->GetData());
+            break;
+        case ArgumentMemoryType::Vector:
+            result.push_back(GetBuffer(argument->GetId()).m_Memory);
+            break;
+        case ArgumentMemoryType::Local:
+            // Host functions allocate their own scratch memory, local memory size is available through the argument
+            result.push_back(nullptr);
+            break;
+        default:
+            KttError("Unhandled argument memory type value");
+        }
+    }
+
+    return result;
+}
+
+TransferActionId HostEngine::AddTransferAction(const Nanoseconds duration, const Nanoseconds overhead)
+{
+    const auto id = m_TransferIdGenerator.GenerateId();
+    m_TransferActions[id] = TransferResult(duration, overhead);
+    return id;
+}
+
+void HostEngine::CheckQueue(const QueueId queueId) const
+{
+    if (static_cast<size_t>(queueId) >= m_Queues.size())
+    {
+        throw KttException("Invalid host queue index: " + std::to_string(queueId));
+    }
+}
+
+void HostEngine::WaitForQueue(const QueueId queueId)
+{
+    for (const auto& pair : m_ComputeActions)
+    {
+        if (pair.second.m_QueueId == queueId && pair.second.m_Duration.valid())
+        {
+            pair.second.m_Duration.wait();
+        }
+    }
+}
+
+void HostEngine::WaitForQueues()
+{
+    for (const auto& pair : m_ComputeActions)
+    {
+        if (pair.second.m_Duration.valid())
+        {
+            pair.second.m_Duration.wait();
+        }
+    }
+}
+
+DeviceInfo HostEngine::CreateDeviceInfo(const DeviceIndex index)
+{
+    DeviceInfo info(index, "Host processor");
+    info.SetVendor("N/A");
+    info.SetExtensions("N/A");
+    info.SetDeviceType(DeviceType::CPU);
+    info.SetMaxWorkGroupSize(std::numeric_limits<uint64_t>::max());
+    info.SetMaxComputeUnits(std::max(1u, std::thread::hardware_concurrency()));
+    return info;
+}
+
+void HostEngine::ClearQueueActions(const QueueId id)
+{
+    EraseIf(m_ComputeActions, [id](const auto& pair)
+    {
+        return pair.second.m_QueueId == id || pair.second.m_QueueId == InvalidQueueId;
+    });
+}
+
+} // namespace ktt
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctpl_stl.h>
+
+#include <ComputeEngine/ComputeEngine.h>
+#include <ComputeEngine/EngineConfiguration.h>
+#include <ComputeEngine/TransferMonitor.h>
+#include <Utility/IdGenerator.h>
+
+namespace ktt
+{
+
+// Kernels are host functions registered with kernel definitions, each queue is a single thread which runs them in order
+class HostEngine : public ComputeEngine
+{
+public:
+    explicit HostEngine(const PlatformIndex platformIndex, const DeviceIndex deviceIndex, const uint32_t queueCount);
+    ~HostEngine() override;
+
+    // Kernel methods
+    ComputeActionId RunKernelAsync(const KernelComputeData& data, const QueueId queueId, const bool powerMeasurementAllowed = false) override;
+    ComputationResult WaitForComputeAction(const ComputeActionId id) override;
+    void ClearData(const KernelComputeId& id) override;
+    void ClearKernelData(const std::string& kernelName) override;
+    void CompileKernelAsync(const KernelComputeData& data) override;
+    void PrecompileKernels(const std::vector<KernelComputeData>& data) override;
+
+    // Profiling methods
+    ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) override;
+    void SetProfilingCounters(const std::vector<std::string>& counters) override;
+    bool IsProfilingSessionActive(const KernelComputeId& id) override;
+    uint64_t GetRemainingProfilingRuns(const KernelComputeId& id) override;
+    bool HasAccurateRemainingProfilingRuns() const override;
+    bool SupportsMultiInstanceProfiling() const override;
+    bool IsProfilingActive() const override;
+    void SetProfiling(const bool profiling) override;
+
+    // Buffer methods
+    TransferActionId UploadArgument(KernelArgument& kernelArgument, const QueueId queueId) override;
+    TransferActionId UpdateArgument(const ArgumentId& id, const QueueId queueId, const void* data,
+        const size_t dataSize) override;
+    TransferActionId DownloadArgument(const ArgumentId& id, const QueueId queueId, void* destination,
+        const size_t dataSize) override;
+    TransferActionId CopyArgument(const ArgumentId& destination, const QueueId queueId, const ArgumentId& source,
+        const size_t dataSize) override;
+    TransferResult WaitForTransferAction(const TransferActionId id) override;
+    void ResizeArgument(const ArgumentId& id, const size_t newSize, const bool preserveData) override;
+    void GetUnifiedMemoryBufferHandle(const ArgumentId& id, UnifiedBufferMemory& handle) override;
+    void AddCustomBuffer(KernelArgument& kernelArgument, ComputeBuffer buffer) override;
+    void ClearBuffer(const ArgumentId& id) override;
+    void ClearBuffers() override;
+    bool HasBuffer(const ArgumentId& id) override;
+    bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) override;
+
+    // Queue methods
+    QueueId AddComputeQueue(ComputeQueue queue) override;
+    void RemoveComputeQueue(const QueueId id) override;
+    QueueId GetDefaultQueue() const override;
+    std::vector<QueueId> GetAllQueues() const override;
+    void SynchronizeQueue(const QueueId queueId) override;
+    void SynchronizeQueues() override;
+    void SynchronizeDevice() override;
+
+    // Information retrieval methods
+    std::vector<PlatformInfo> GetPlatformInfo() const override;
+    std::vector<DeviceInfo> GetDeviceInfo(const PlatformIndex platformIndex) const override;
+    PlatformInfo GetCurrentPlatformInfo() const override;
+    DeviceInfo GetCurrentDeviceInfo() const override;
+    ComputeApi GetComputeApi() const override;
+    GlobalSizeType GetGlobalSizeType() const override;
+    KernelCacheStatistics GetKernelCacheStatistics() const override;
+    TransferStatistics GetTransferStatistics() const override;
+
+    // Utility methods
+    void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) override;
+    void SetGlobalSizeType(const GlobalSizeType type) override;
+    void SetAutomaticGlobalSizeCorrection(const bool flag) override;
+    void SetKernelCacheCapacity(const uint64_t capacity) override;
+    void SetKernelCacheMemoryLimit(const uint64_t limit) override;
+    void SetKernelCachePolicy(const KernelCachePolicy policy) override;
+    void ClearKernelCache() override;
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) override;
+    void SetStagingMemoryLimit(const uint64_t limit) override;
+    void EnsureThreadContext() override;
+
+private:
+    struct HostBuffer
+    {
+        std::vector<uint8_t> m_OwnedData;
+        void* m_Memory;
+        size_t m_Size;
+        // Read-only arguments share memory with their host data until something else than the kernel writes into them
+        bool m_CopyOnWrite;
+    };
+
+    struct HostComputeAction
+    {
+        QueueId m_QueueId;
+        KernelComputeId m_ComputeId;
+        std::string m_KernelName;
+        DimensionVector m_GlobalSize;
+        DimensionVector m_LocalSize;
+        Nanoseconds m_Overhead;
+        std::future<Nanoseconds> m_Duration;
+    };
+
+    EngineConfiguration m_Configuration;
+    DeviceInfo m_DeviceInfo;
+    IdGenerator<ComputeActionId> m_ComputeIdGenerator;
+    IdGenerator<TransferActionId> m_TransferIdGenerator;
+    std::vector<std::unique_ptr<ctpl::thread_pool>> m_Queues;
+    std::map<ArgumentId, HostBuffer> m_Buffers;
+    TransferMonitor m_TransferMonitor;
+    std::map<ComputeActionId, HostComputeAction> m_ComputeActions;
+    std::map<TransferActionId, TransferResult> m_TransferActions;
+
+    HostBuffer& GetBuffer(const ArgumentId& id);
+    void* GetWritableMemory(HostBuffer& buffer);
+    std::vector<void*> GetKernelArguments(const std::vector<KernelArgument*>& arguments);
+    TransferActionId AddTransferAction(const Nanoseconds duration, const Nanoseconds overhead);
+    void CheckQueue(const QueueId queueId) const;
+    void WaitForQueue(const QueueId queueId);
+    void WaitForQueues();
+    void ClearQueueActions(const QueueId id);
+
+    static DeviceInfo CreateDeviceInfo(const DeviceIndex index);
+};
+
+} // namespace ktt
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include <Api/KttException.h>
+#include <ComputeEngine/KernelBinaryCache.h>
+#include <Utility/FileSystem.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+KernelBinaryCache::KernelBinaryCache() :
+    m_MaximumSize(0),
+    m_TotalSize(0),
+    m_NextTick(0)
+{}
+
+void KernelBinaryCache::SetDirectory(const std::string& directory)
+{
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        if (error)
+        {
+            throw KttException("Unable to create kernel binary cache directory " + directory + ": " + error.message());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Directory = directory;
+    ScanDirectory();
+    EvictEntries();
+}
+
+void KernelBinaryCache::SetMaximumSize(const uint64_t size)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MaximumSize = size;
+    EvictEntries();
+}
+
+bool KernelBinaryCache::IsEnabled() const
+{
+    return !m_Directory.empty();
+}
+
+bool KernelBinaryCache::Load(const std::string& key, std::vector<uint8_t>& binary) const
+{
+    if (!Exists(key))
+    {
+        return false;
+    }
+
+    try
+    {
+        binary = LoadFileToBinary(GetFilePath(key));
+    }
+    catch (const KttException& exception)
+    {
+        Logger::LogWarning(std::string("Unable to load kernel binary from cache: ") + exception.what());
+        return false;
+    }
+
+    // Modification time of entries is used as their last access time when the directory is scanned again
+    std::error_code error;
+    std::filesystem::last_write_time(GetFilePath(key), std::filesystem::file_time_type::clock::now(), error);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    UpdateEntry(key, static_cast<uint64_t>(binary.size()));
+    return !binary.empty();
+}
+
+void KernelBinaryCache::Store(const std::string& key, const std::vector<uint8_t>& binary) const
+{
+    if (!IsEnabled() || binary.empty())
+    {
+        return;
+    }
+
+    // Binary is written under a temporary name first, so that concurrent readers never see a partially written file
+    std::stringstream temporaryPath;
+    temporaryPath << GetFilePath(key) << ".tmp" << std::this_thread::get_id();
+
+    try
+    {
+        SaveBinaryToFile(temporaryPath.str(), binary);
+    }
+    catch (const KttException& exception)
+    {
+        Logger::LogWarning(std::string("Unable to store kernel binary in cache: ") + exception.what());
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath.str(), GetFilePath(key), error);
+
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath.str(), error);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    UpdateEntry(key, static_cast<uint64_t>(binary.size()));
+
+    if (m_MaximumSize > 0 && m_TotalSize > m_MaximumSize)
+    {
+        EvictEntries();
+    }
+}
+
+bool KernelBinaryCache::Exists(const std::string& key) const
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    std::error_code error;
+    return std::filesystem::exists(GetFilePath(key), error);
+}
+
+std::string KernelBinaryCache::GenerateKey(const std::vector<std::string>& components)
+{
+    // 64-bit FNV-1a hash, components are separated so that their boundaries affect the result
+    uint64_t hash = 14695981039346656037ull;
+
+    for (const auto& component : components)
+    {
+        for (const char character : component)
+        {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 1099511628211ull;
+        }
+
+        hash ^= 0xFFull;
+        hash *= 1099511628211ull;
+    }
+
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+std::string KernelBinaryCache::GetFilePath(const std::string& key) const
+{
+    return (std::filesystem::path(m_Directory) / (key + m_FileExtension)).string();
+}
+
+void KernelBinaryCache::ScanDirectory()
+{
+    m_Entries.clear();
+    m_AccessOrder.clear();
+    m_TotalSize = 0;
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> files;
+    std::error_code error;
+
+    for (const auto& file : std::filesystem::directory_iterator(m_Directory, error))
+    {
+        if (file.is_regular_file(error) && file.path().extension() == m_FileExtension)
+        {
+            files.emplace_back(file.last_write_time(error), file.path());
+        }
+    }
+
+    // Existing entries are ordered by their last access time recorded in the file system
+    std::sort(files.begin(), files.end());
+
+    for (const auto& file : files)
+    {
+        const uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(file.second, error));
+
+        if (!error)
+        {
+            UpdateEntry(file.second.stem().string(), size);
+        }
+    }
+}
+
+void KernelBinaryCache::UpdateEntry(const std::string& key, const uint64_t size) const
+{
+    const auto iterator = m_Entries.find(key);
+
+    if (iterator != m_Entries.cend())
+    {
+        m_TotalSize -= iterator->second.m_Size;
+        m_AccessOrder.erase(iterator->second.m_AccessTick);
+    }
+
+    const uint64_t tick = m_NextTick++;
+    m_Entries[key] = CacheEntry{size, tick};
+    m_AccessOrder[tick] = key;
+    m_TotalSize += size;
+}
+
+void KernelBinaryCache::EvictEntries() const
+{
+    if (!IsEnabled() || m_MaximumSize == 0)
+    {
+        return;
+    }
+
+    // Least recently used entries are at the beginning of access order
+    while (m_TotalSize > m_MaximumSize && !m_AccessOrder.empty())
+    {
+        const auto oldest = m_AccessOrder.cbegin();
+        const std::string key = oldest->second;
+        const auto entry = m_Entries.find(key);
+        std::error_code error;
+
+        // Entries which were already removed by another process are dropped from the index as well
+        std::filesystem::remove(GetFilePath(key), error);
+
+        if (!error)
+        {
+            Logger::LogDebug("Evicting kernel binary " + key + m_FileExtension + " from cache");
+        }
+
+        m_TotalSize -= entry->second.m_Size;
+        m_Entries.erase(entry);
+        m_AccessOrder.erase(oldest);
+    }
+}
+
+} // namespace ktt
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+// Sizes and access order of entries are tracked in memory after the directory is scanned once, binaries stored by other
+// processes are added to the index when they are loaded
+class KernelBinaryCache
+{
+public:
+    KernelBinaryCache();
+
+    void SetDirectory(const std::string& directory);
+    void SetMaximumSize(const uint64_t size);
+    bool IsEnabled() const;
+
+    bool Load(const std::string& key, std::vector<uint8_t>& binary) const;
+    void Store(const std::string& key, const std::vector<uint8_t>& binary) const;
+    bool Exists(const std::string& key) const;
+
+    static std::string GenerateKey(const std::vector<std::string>& components);
+
+private:
+    struct CacheEntry
+    {
+        uint64_t m_Size;
+        uint64_t m_AccessTick;
+    };
+
+    std::string m_Directory;
+    uint64_t m_MaximumSize;
+    mutable std::map<std::string, CacheEntry> m_Entries;
+    mutable std::map<uint64_t, std::string> m_AccessOrder;
+    mutable uint64_t m_TotalSize;
+    mutable uint64_t m_NextTick;
+    mutable std::mutex m_Mutex;
+
+    std::string GetFilePath(const std::string& key) const;
+    void ScanDirectory();
+    void UpdateEntry(const std::string& key, const uint64_t size) const;
+    void EvictEntries() const;
+
+    inline static const std::string m_FileExtension = ".bin";
+};
+
+} // namespace ktt
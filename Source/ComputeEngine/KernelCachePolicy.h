@@ -0,0 +1,25 @@
+/** @file KernelCachePolicy.h
+  * Eviction policy of compiled kernel cache.
+  */
+#pragma once
+
+namespace ktt
+{
+
+/** @enum KernelCachePolicy
+  * Enum for eviction policy of compiled kernel cache. Specifies which kernel is removed from the cache when its capacity or
+  * memory limit is exceeded.
+  */
+enum class KernelCachePolicy
+{
+    /** The least recently used kernel is evicted.
+      */
+    LeastRecentlyUsed,
+
+    /** Kernels which were launched repeatedly are moved into protected segment of the cache. Kernels which were launched only once
+      * are evicted first. Suitable for searchers which revisit neighbourhood of previously explored configurations.
+      */
+    SegmentedLeastRecentlyUsed
+};
+
+} // namespace ktt
@@ -19,7 +19,8 @@ KernelComputeData::KernelComputeData(const Kernel& kernel, const KernelDefinitio
     m_ConfigurationPrefix(configuration.GeneratePrefix()),
     m_TemplatedName(definition.GetTemplatedName()),
     m_Configuration(&configuration),
-    m_Arguments(definition.GetArguments())
+    m_Arguments(definition.GetArguments()),
+    m_HostFunction(definition.GetHostFunction())
 {
     const auto id = definition.GetId();
     const auto& pairs = configuration.GetPairs();
@@ -156,4 +157,9 @@ const std::vector<KernelArgument*>& KernelComputeData::GetArguments() const
     return m_Arguments;
 }
 
+const HostFunction& KernelComputeData::GetHostFunction() const
+{
+    return m_HostFunction;
+}
+
 } // namespace ktt
@@ -0,0 +1,53 @@
+#ifdef KTT_API_OPENCL
+
+#include <string>
+
+#include <ComputeEngine/OpenCl/Buffers/OpenClStagingBuffer.h>
+#include <ComputeEngine/OpenCl/OpenClCommandQueue.h>
+#include <ComputeEngine/OpenCl/OpenClUtility.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+OpenClStagingBuffer::OpenClStagingBuffer(const OpenClCommandQueue& queue, const size_t size) :
+    m_Queue(queue.GetQueue()),
+    m_Size(size)
+{
+    Logger::LogDebug("Initializing OpenCL staging buffer with size " + std::to_string(size));
+
+    // Buffers allocated by the driver in host memory are pinned, mapping them once keeps the pinned pointer valid for transfers
+    cl_int result;
+    m_Buffer = clCreateBuffer(queue.GetContext(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size, nullptr, &result);
+    CheckError(result, "clCreateBuffer");
+
+    m_Pointer = clEnqueueMapBuffer(m_Queue, m_Buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, size, 0, nullptr, nullptr, &result);
+
+    if (result != CL_SUCCESS)
+    {
+        clReleaseMemObject(m_Buffer);
+        CheckError(result, "clEnqueueMapBuffer");
+    }
+}
+
+OpenClStagingBuffer::~OpenClStagingBuffer()
+{
+    Logger::LogDebug("Releasing OpenCL staging buffer with size " + std::to_string(m_Size));
+    CheckError(clEnqueueUnmapMemObject(m_Queue, m_Buffer, m_Pointer, 0, nullptr, nullptr), "clEnqueueUnmapMemObject");
+    CheckError(clFinish(m_Queue), "clFinish");
+    CheckError(clReleaseMemObject(m_Buffer), "clReleaseMemObject");
+}
+
+void* OpenClStagingBuffer::GetPointer() const
+{
+    return m_Pointer;
+}
+
+size_t OpenClStagingBuffer::GetSize() const
+{
+    return m_Size;
+}
+
+} // namespace ktt
+
+#endif // KTT_API_OPENCL
@@ -0,0 +1,31 @@
+#pragma once
+
+#ifdef KTT_API_OPENCL
+
+#include <cstddef>
+#include <CL/cl.h>
+
+namespace ktt
+{
+
+class OpenClCommandQueue;
+
+class OpenClStagingBuffer
+{
+public:
+    explicit OpenClStagingBuffer(const OpenClCommandQueue& queue, const size_t size);
+    ~OpenClStagingBuffer();
+
+    void* GetPointer() const;
+    size_t GetSize() const;
+
+private:
+    cl_command_queue m_Queue;
+    cl_mem m_Buffer;
+    void* m_Pointer;
+    size_t m_Size;
+};
+
+} // namespace ktt
+
+#endif // KTT_API_OPENCL
@@ -10,10 +10,11 @@
 namespace ktt
 {
 
-OpenClContext::OpenClContext(const OpenClPlatform& platform, const OpenClDevice& device) :
+OpenClContext::OpenClContext(const OpenClPlatform& platform, const OpenClDevice& device, const bool owningDevice) :
     m_Platform(platform.GetId()),
     m_Device(device.GetId()),
-    m_OwningContext(true)
+    m_OwningContext(true),
+    m_OwningDevice(owningDevice)
 {
     Logger::LogDebug("Initializing OpenCL context");
     cl_context_properties properties[] = {CL_CONTEXT_PLATFORM, reinterpret_cast<cl_context_properties>(platform.GetId()), 0};
@@ -23,7 +24,8 @@ OpenClContext::OpenClContext(const OpenClPlatform& platform, const OpenClDevice&
 }
 
 OpenClContext::OpenClContext(ComputeContext context) :
-    m_OwningContext(false)
+    m_OwningContext(false),
+    m_OwningDevice(false)
 {
     Logger::LogDebug("Initializing OpenCL context");
     m_Context = static_cast<cl_context>(context);
@@ -59,6 +61,11 @@ OpenClContext::~OpenClContext()
     {
         CheckError(clReleaseContext(m_Context), "clReleaseContext");
     }
+
+    if (m_OwningDevice)
+    {
+        CheckError(clReleaseDevice(m_Device), "clReleaseDevice");
+    }
 }
 
 cl_context OpenClContext::GetContext() const
@@ -15,7 +15,7 @@ class OpenClPlatform;
 class OpenClContext
 {
 public:
-    explicit OpenClContext(const OpenClPlatform& platform, const OpenClDevice& device);
+    explicit OpenClContext(const OpenClPlatform& platform, const OpenClDevice& device, const bool owningDevice = false);
     explicit OpenClContext(ComputeContext context);
     ~OpenClContext();
 
@@ -29,6 +29,7 @@ private:
     cl_platform_id m_Platform;
     cl_device_id m_Device;
     bool m_OwningContext;
+    bool m_OwningDevice;
 };
 
 } // namespace ktt
@@ -1,5 +1,6 @@
 #ifdef KTT_API_OPENCL
 
+#include <Api/KttException.h>
 #include <ComputeEngine/OpenCl/OpenClDevice.h>
 #include <ComputeEngine/OpenCl/OpenClUtility.h>
 #include <Utility/StringUtility.h>
@@ -71,6 +72,45 @@ DeviceInfo OpenClDevice::GetInfo() const
     return result;
 }
 
+std::string OpenClDevice::GetDriverVersion() const
+{
+    return GetInfoString(CL_DRIVER_VERSION);
+}
+
+std::vector<cl_device_id> OpenClDevice::CreateSubDevices(const uint32_t count) const
+{
+    const auto computeUnits = GetInfoWithType<cl_uint>(CL_DEVICE_MAX_COMPUTE_UNITS);
+    const auto maxSubDevices = GetInfoWithType<cl_uint>(CL_DEVICE_PARTITION_MAX_SUB_DEVICES);
+
+    if (count == 0 || count > computeUnits || count > maxSubDevices)
+    {
+        throw KttException("Device " + GetInfoString(CL_DEVICE_NAME) + " cannot be partitioned into " + std::to_string(count)
+            + " sub-devices");
+    }
+
+    const cl_device_partition_property properties[] =
+    {
+        CL_DEVICE_PARTITION_EQUALLY,
+        static_cast<cl_device_partition_property>(computeUnits / count),
+        0
+    };
+
+    cl_uint subDeviceCount;
+    CheckError(clCreateSubDevices(m_Id, properties, 0, nullptr, &subDeviceCount), "clCreateSubDevices");
+
+    std::vector<cl_device_id> subDevices(subDeviceCount);
+    CheckError(clCreateSubDevices(m_Id, properties, subDeviceCount, subDevices.data(), nullptr), "clCreateSubDevices");
+
+    // Equal partitioning creates additional sub-device from leftover compute units if their count is not divisible
+    for (size_t i = count; i < subDevices.size(); ++i)
+    {
+        CheckError(clReleaseDevice(subDevices[i]), "clReleaseDevice");
+    }
+
+    subDevices.resize(count);
+    return subDevices;
+}
+
 std::string OpenClDevice::GetInfoString(const cl_device_info info) const
 {
     size_t infoSize;
@@ -3,6 +3,7 @@
 #ifdef KTT_API_OPENCL
 
 #include <string>
+#include <vector>
 #include <CL/cl.h>
 
 #include <Api/Info/DeviceInfo.h>
@@ -20,6 +21,8 @@ public:
     cl_device_id GetId() const;
     DeviceType GetDeviceType() const;
     DeviceInfo GetInfo() const;
+    std::string GetDriverVersion() const;
+    std::vector<cl_device_id> CreateSubDevices(const uint32_t count) const;
 
 private:
     DeviceIndex m_Index;
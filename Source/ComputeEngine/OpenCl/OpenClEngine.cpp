@@ -1,9 +1,14 @@
 #ifdef KTT_API_OPENCL
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 #include <Api/KttException.h>
 #include <ComputeEngine/OpenCl/Buffers/OpenClDeviceBuffer.h>
 #include <ComputeEngine/OpenCl/Buffers/OpenClHostBuffer.h>
 #include <ComputeEngine/OpenCl/Buffers/OpenClUnifiedBuffer.h>
+#include <ComputeEngine/OpenCl/OpenClDevice.h>
 #include <ComputeEngine/OpenCl/OpenClEngine.h>
 #include <ComputeEngine/OpenCl/OpenClPlatform.h>
 #include <Utility/ErrorHandling/Assert.h>
@@ -24,6 +29,10 @@ OpenClEngine::OpenClEngine(const PlatformIndex platformIndex, const DeviceIndex
     m_PlatformIndex(platformIndex),
     m_DeviceIndex(deviceIndex),
     m_DeviceInfo(0, ""),
+    m_StagingPool([this](const size_t size)
+    {
+        return std::make_unique<OpenClStagingBuffer>(*m_Queues[GetDefaultQueue()], size);
+    }),
     m_KernelCache(10)
 {
     const auto platforms = OpenClPlatform::GetAllPlatforms();
@@ -61,6 +70,10 @@ OpenClEngine::OpenClEngine(const PlatformIndex platformIndex, const DeviceIndex
 OpenClEngine::OpenClEngine(const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds) :
     m_Configuration(GlobalSizeType::OpenCL),
     m_DeviceInfo(0, ""),
+    m_StagingPool([this](const size_t size)
+    {
+        return std::make_unique<OpenClStagingBuffer>(*m_Queues[GetDefaultQueue()], size);
+    }),
     m_KernelCache(10)
 {
     m_Context = std::make_unique<OpenClContext>(initializer.GetContext());
@@ -105,6 +118,81 @@ OpenClEngine::OpenClEngine(const ComputeApiInitializer& initializer, std::vector
 #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
 }
 
+OpenClEngine::OpenClEngine(const PlatformIndex platformIndex, const DeviceIndex deviceIndex, cl_device_id subDevice,
+    const uint32_t queueCount) :
+    m_Configuration(GlobalSizeType::OpenCL),
+    m_PlatformIndex(platformIndex),
+    m_DeviceIndex(deviceIndex),
+    m_DeviceInfo(0, ""),
+    m_StagingPool([this](const size_t size)
+    {
+        return std::make_unique<OpenClStagingBuffer>(*m_Queues[GetDefaultQueue()], size);
+    }),
+    m_KernelCache(10)
+{
+    const auto platforms = OpenClPlatform::GetAllPlatforms();
+    const auto& platform = platforms[static_cast<size_t>(platformIndex)];
+    const OpenClDevice device(deviceIndex, subDevice);
+
+    // Engine takes ownership of the sub-device, it is released together with the context
+    m_Context = std::make_unique<OpenClContext>(platform, device, true);
+
+    for (uint32_t i = 0; i < queueCount; ++i)
+    {
+        const QueueId id = m_QueueIdGenerator.GenerateId();
+        auto commandQueue = std::make_unique<OpenClCommandQueue>(id, *m_Context);
+        m_Queues[id] = std::move(commandQueue);
+    }
+
+    // Sub-device has its own limits, e.g., number of compute units, which differ from the parent device
+    m_DeviceInfo = device.GetInfo();
+
+#if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
+    InitializeGpa();
+#endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
+}
+
+std::vector<std::unique_ptr<ComputeEngine>> OpenClEngine::CreateSubDeviceEngines(const PlatformIndex platformIndex,
+    const DeviceIndex deviceIndex, const uint32_t subDeviceCount, const uint32_t queueCount)
+{
+    const auto platforms = OpenClPlatform::GetAllPlatforms();
+
+    if (platformIndex >= static_cast<PlatformIndex>(platforms.size()))
+    {
+        throw KttException("Invalid platform index: " + std::to_string(platformIndex));
+    }
+
+    const auto devices = platforms[static_cast<size_t>(platformIndex)].GetDevices();
+
+    if (deviceIndex >= static_cast<DeviceIndex>(devices.size()))
+    {
+        throw KttException("Invalid device index: " + std::to_string(deviceIndex));
+    }
+
+    const auto subDevices = devices[static_cast<size_t>(deviceIndex)].CreateSubDevices(subDeviceCount);
+    std::vector<std::unique_ptr<ComputeEngine>> engines;
+
+    for (size_t i = 0; i < subDevices.size(); ++i)
+    {
+        try
+        {
+            engines.push_back(std::make_unique<OpenClEngine>(platformIndex, deviceIndex, subDevices[i], queueCount));
+        }
+        catch (const KttException&)
+        {
+            // Sub-devices which were not yet passed to an engine would otherwise leak
+            for (size_t j = i + 1; j < subDevices.size(); ++j)
+            {
+                clReleaseDevice(subDevices[j]);
+            }
+
+            throw;
+        }
+    }
+
+    return engines;
+}
+
 ComputeActionId OpenClEngine::RunKernelAsync(const KernelComputeData& data, const QueueId queueId, const bool powerMeasurementAllowed)
 {
     if (!ContainsKey(m_Queues, queueId))
@@ -187,6 +275,75 @@ void OpenClEngine::ClearKernelData(const std::string& kernelName)
         return StartsWith(pair.first, kernelName);
     });
 #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
+
+    EraseIf(m_PendingKernels, [&kernelName](const auto& pair)
+    {
+        return StartsWith(pair.first, kernelName);
+    });
+}
+
+void OpenClEngine::CompileKernelAsync(const KernelComputeData& data)
+{
+    const auto id = data.GetUniqueIdentifier();
+
+    if (m_KernelCache.GetMaxSize() == 0 || m_KernelCache.Exists(id) || ContainsKey(m_PendingKernels, id))
+    {
+        return;
+    }
+
+    // Task only captures copies of the data, compute data may be destroyed before the compilation finishes
+    m_PendingKernels[id] = GetCompilationPool().push([this, name = data.GetName(), source = data.GetSource(),
+        options = m_Configuration.GetCompilerOptions()]()
+    {
+        return CompileKernel(name, source, options);
+    });
+}
+
+void OpenClEngine::PrecompileKernels(const std::vector<KernelComputeData>& data)
+{
+    if (!m_BinaryCache.IsEnabled())
+    {
+        throw KttException("Kernel precompilation requires kernel binary cache directory to be set");
+    }
+
+    const std::string& options = m_Configuration.GetCompilerOptions();
+    std::set<std::string> submittedKeys;
+    std::vector<std::future<void>> futures;
+
+    for (const auto& computeData : data)
+    {
+        std::string source = computeData.GetSource();
+        const std::string key = GetBinaryCacheKey(source, options);
+
+        if (m_BinaryCache.Exists(key) || !submittedKeys.insert(key).second)
+        {
+            continue;
+        }
+
+        // Each task builds its own program, binaries are picked up from the cache once the kernels are launched
+        futures.push_back(GetCompilationPool().push([this, source = std::move(source), options]()
+        {
+            BuildProgram(source, options);
+        }));
+    }
+
+    uint64_t failedCount = 0;
+
+    for (auto& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (const KttException& exception)
+        {
+            Logger::LogWarning(std::string("Kernel precompilation failed with reason: ") + exception.what());
+            ++failedCount;
+        }
+    }
+
+    Logger::LogInfo("Precompiled " + std::to_string(futures.size() - failedCount) + " kernels, " + std::to_string(failedCount)
+        + " compilations failed");
 }
 
 ComputationResult OpenClEngine::RunKernelWithProfiling([[maybe_unused]] const KernelComputeData& data,
@@ -318,10 +475,13 @@ TransferActionId OpenClEngine::UploadArgument(KernelArgument& kernelArgument, co
     auto buffer = CreateBuffer(kernelArgument);
     timer.Stop();
 
-    auto action = buffer->UploadData(*m_Queues[queueId], kernelArgument.GetData(),
-        kernelArgument.GetDataSize());
+    const size_t dataSize = kernelArgument.GetDataSize();
+    const bool staged = IsStagingUsed(*buffer, dataSize);
+    auto action = staged ? UploadStaged(*buffer, *m_Queues[queueId], kernelArgument.GetData(), dataSize)
+        : buffer->UploadData(*m_Queues[queueId], kernelArgument.GetData(), dataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddUpload(actionId, dataSize, staged);
 
     m_Buffers[id] = std::move(buffer);
     m_TransferActions[actionId] = std::move(action);
@@ -357,9 +517,12 @@ TransferActionId OpenClEngine::UpdateArgument(const ArgumentId& id, const QueueI
 
     timer.Stop();
 
-    auto action = buffer.UploadData(*m_Queues[queueId], data, actualDataSize);
+    const bool staged = IsStagingUsed(buffer, actualDataSize);
+    auto action = staged ? UploadStaged(buffer, *m_Queues[queueId], data, actualDataSize)
+        : buffer.UploadData(*m_Queues[queueId], data, actualDataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddUpload(actionId, actualDataSize, staged);
     m_TransferActions[actionId] = std::move(action);
     return actionId;
 }
@@ -392,9 +555,12 @@ TransferActionId OpenClEngine::DownloadArgument(const ArgumentId& id, const Queu
 
     timer.Stop();
 
-    auto action = buffer.DownloadData(*m_Queues[queueId], destination, actualDataSize);
+    const bool staged = IsStagingUsed(buffer, actualDataSize);
+    auto action = staged ? DownloadStaged(buffer, *m_Queues[queueId], destination, actualDataSize)
+        : buffer.DownloadData(*m_Queues[queueId], destination, actualDataSize);
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddDownload(actionId, actualDataSize, staged);
     m_TransferActions[actionId] = std::move(action);
     return actionId;
 }
@@ -453,6 +619,7 @@ TransferResult OpenClEngine::WaitForTransferAction(const TransferActionId id)
     action.WaitForFinish();
     auto result = action.GenerateResult();
 
+    m_TransferMonitor.FinishTransfer(id, result);
     m_TransferActions.erase(id);
     return result;
 }
@@ -515,6 +682,80 @@ bool OpenClEngine::HasBuffer(const ArgumentId& id)
     return ContainsKey(m_Buffers, id);
 }
 
+bool OpenClEngine::ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+    const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums)
+{
+    if (dataType != ArgumentDataType::Float && dataType != ArgumentDataType::Double)
+    {
+        return false;
+    }
+
+    // Sums are accumulated in double precision, so that they match the sums computed on host
+    if (m_DeviceInfo.GetExtensions().find("cl_khr_fp64") == std::string::npos)
+    {
+        return false;
+    }
+
+    if (!ContainsKey(m_Queues, queueId))
+    {
+        throw KttException("Invalid queue index: " + std::to_string(queueId));
+    }
+
+    if (!ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " was not found");
+    }
+
+    Logger::LogDebug("Computing block checksums on device for argument with id " + id);
+    auto kernel = LoadChecksumKernel(dataType);
+    const size_t blockCount = (elementCount + blockSize - 1) / blockSize;
+    std::vector<double> sums(2 * blockCount);
+
+    KernelArgument sumsArgument("KttChecksumSums", sizeof(double), ArgumentDataType::Double, ArgumentMemoryLocation::Device,
+        ArgumentAccessType::WriteOnly, ArgumentMemoryType::Vector, ArgumentManagementType::Framework);
+    sumsArgument.SetReferencedData(sums.data(), sums.size() * sizeof(double));
+    auto sumsBuffer = CreateBuffer(sumsArgument);
+
+    const cl_ulong count = static_cast<cl_ulong>(elementCount);
+    const cl_ulong size = static_cast<cl_ulong>(blockSize);
+    KernelArgument countArgument("KttChecksumCount", sizeof(cl_ulong), ArgumentDataType::UnsignedLong,
+        ArgumentMemoryLocation::Undefined, ArgumentAccessType::ReadOnly, ArgumentMemoryType::Scalar,
+        ArgumentManagementType::Framework);
+    countArgument.SetOwnedData(&count, sizeof(cl_ulong));
+    KernelArgument sizeArgument("KttChecksumBlockSize", sizeof(cl_ulong), ArgumentDataType::UnsignedLong,
+        ArgumentMemoryLocation::Undefined, ArgumentAccessType::ReadOnly, ArgumentMemoryType::Scalar,
+        ArgumentManagementType::Framework);
+    sizeArgument.SetOwnedData(&size, sizeof(cl_ulong));
+
+    kernel->ResetArguments();
+    kernel->SetArgument(*m_Buffers[id]);
+    kernel->SetArgument(*sumsBuffer);
+    kernel->SetArgument(countArgument);
+    kernel->SetArgument(sizeArgument);
+
+    // Each work-group reduces one block
+    const size_t globalSize = m_Configuration.GetGlobalSizeType() == GlobalSizeType::OpenCL ? blockCount * m_ChecksumGroupSize
+        : blockCount;
+    const auto& queue = *m_Queues[queueId];
+    auto action = kernel->Launch(queue, DimensionVector(globalSize), DimensionVector(m_ChecksumGroupSize));
+    action->WaitForFinish();
+
+    auto transfer = sumsBuffer->DownloadData(queue, sums.data(), sums.size() * sizeof(double));
+    transfer->WaitForFinish();
+    checksums.resize(blockCount);
+
+    for (size_t block = 0; block < blockCount; ++block)
+    {
+        const size_t begin = block * blockSize;
+        checksums[block].m_ElementCount = static_cast<uint64_t>(std::min(begin + blockSize, elementCount) - begin);
+        checksums[block].m_Sum = sums[2 * block];
+        checksums[block].m_AbsoluteSum = sums[2 * block + 1];
+        checksums[block].m_IntegerSum = 0;
+    }
+
+    return true;
+}
+
 QueueId OpenClEngine::AddComputeQueue(ComputeQueue queue)
 {
     if (!m_Context->IsUserOwned())
@@ -648,6 +889,26 @@ GlobalSizeType OpenClEngine::GetGlobalSizeType() const
     return m_Configuration.GetGlobalSizeType();
 }
 
+KernelCacheStatistics OpenClEngine::GetKernelCacheStatistics() const
+{
+    KernelCacheStatistics statistics;
+    statistics.m_HitCount = m_KernelCache.GetHitCount();
+    statistics.m_MissCount = m_KernelCache.GetMissCount();
+    statistics.m_EvictionCount = m_KernelCache.GetEvictionCount();
+    statistics.m_EntryCount = static_cast<uint64_t>(m_KernelCache.Size());
+    statistics.m_MemorySize = m_KernelCache.GetMemorySize();
+    return statistics;
+}
+
+TransferStatistics OpenClEngine::GetTransferStatistics() const
+{
+    TransferStatistics statistics = m_TransferMonitor.GetStatistics();
+    statistics.m_StagingAllocationCount = m_StagingPool.GetAllocationCount();
+    statistics.m_StagingReuseCount = m_StagingPool.GetReuseCount();
+    statistics.m_StagingMemorySize = m_StagingPool.GetMemorySize();
+    return statistics;
+}
+
 void OpenClEngine::SetCompilerOptions(const std::string& options, [[maybe_unused]] const bool overrideDefault)
 {
     m_Configuration.SetCompilerOptions(options);
@@ -669,9 +930,32 @@ void OpenClEngine::SetKernelCacheCapacity(const uint64_t capacity)
     m_KernelCache.SetMaxSize(static_cast<size_t>(capacity));
 }
 
+void OpenClEngine::SetKernelCacheMemoryLimit(const uint64_t limit)
+{
+    m_KernelCache.SetMemoryLimit(limit);
+}
+
+void OpenClEngine::SetKernelCachePolicy(const KernelCachePolicy policy)
+{
+    m_KernelCache.SetSegmented(policy == KernelCachePolicy::SegmentedLeastRecentlyUsed);
+}
+
 void OpenClEngine::ClearKernelCache()
 {
     m_KernelCache.Clear();
+    m_PendingKernels.clear();
+}
+
+void OpenClEngine::SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize)
+{
+    m_BinaryCache.SetDirectory(directory);
+    m_BinaryCache.SetMaximumSize(maximumSize);
+    m_DriverVersion = OpenClDevice(m_DeviceIndex, m_Context->GetDevice()).GetDriverVersion();
+}
+
+void OpenClEngine::SetStagingMemoryLimit(const uint64_t limit)
+{
+    m_StagingPool.SetMemoryLimit(limit);
 }
 
 void OpenClEngine::EnsureThreadContext()
@@ -681,23 +965,294 @@ std::shared_ptr<OpenClKernel> OpenClEngine::LoadKernel(const KernelComputeData&
 {
     const auto id = data.GetUniqueIdentifier();
 
-    if (m_KernelCache.GetMaxSize() > 0 && m_KernelCache.Exists(id))
+    if (m_KernelCache.GetMaxSize() > 0)
     {
-        return m_KernelCache.Get(id)->second;
+        const auto cachedItem = m_KernelCache.Get(id);
+
+        if (cachedItem != m_KernelCache.End())
+        {
+            return cachedItem->second;
+        }
     }
 
-    auto program = std::make_unique<OpenClProgram>(*m_Context, data.GetSource());
-    program->Build(m_Configuration.GetCompilerOptions());
-    auto kernel = std::make_shared<OpenClKernel>(std::move(program), data.GetName(), m_ComputeIdGenerator, m_Configuration);
+    std::shared_ptr<OpenClKernel> kernel;
+
+    if (ContainsKey(m_PendingKernels, id))
+    {
+        // Kernel is being compiled in background, only the remaining compilation time is spent here
+        auto future = std::move(m_PendingKernels[id]);
+        m_PendingKernels.erase(id);
+        kernel = future.get();
+    }
+    else
+    {
+        kernel = CompileKernel(data.GetName(), data.GetSource(), m_Configuration.GetCompilerOptions());
+    }
 
     if (m_KernelCache.GetMaxSize() > 0)
     {
-        m_KernelCache.Put(id, kernel);
+        m_KernelCache.Put(id, kernel, kernel->GetMemorySize());
     }
 
     return kernel;
 }
 
+std::shared_ptr<OpenClKernel> OpenClEngine::LoadChecksumKernel(const ArgumentDataType dataType)
+{
+    if (ContainsKey(m_ChecksumKernels, dataType))
+    {
+        return m_ChecksumKernels[dataType];
+    }
+
+    static const std::string source = R"(
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+
+__kernel void kttBlockChecksum(__global const KTT_CHECKSUM_TYPE* data, __global double* sums, const ulong elementCount,
+    const ulong blockSize)
+{
+    __local double localSums[KTT_CHECKSUM_GROUP_SIZE];
+    __local double localAbsoluteSums[KTT_CHECKSUM_GROUP_SIZE];
+
+    const ulong block = get_group_id(0);
+    const uint item = get_local_id(0);
+    const ulong begin = block * blockSize;
+    const ulong end = min(begin + blockSize, elementCount);
+    double sum = 0.0;
+    double absoluteSum = 0.0;
+
+    for (ulong i = begin + item; i < end; i += KTT_CHECKSUM_GROUP_SIZE)
+    {
+        const double value = (double)data[i];
+        sum += value;
+        absoluteSum += fabs(value);
+    }
+
+    localSums[item] = sum;
+    localAbsoluteSums[item] = absoluteSum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint stride = KTT_CHECKSUM_GROUP_SIZE / 2; stride > 0; stride /= 2)
+    {
+        if (item < stride)
+        {
+            localSums[item] += localSums[item + stride];
+            localAbsoluteSums[item] += localAbsoluteSums[item + stride];
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (item == 0)
+    {
+        sums[2 * block] = localSums[0];
+        sums[2 * block + 1] = localAbsoluteSums[0];
+    }
+}
+)";
+
+    const std::string type = dataType == ArgumentDataType::Float ? "float" : "double";
+    const std::string options = "-DKTT_CHECKSUM_TYPE=" + type + " -DKTT_CHECKSUM_GROUP_SIZE="
+        + std::to_string(m_ChecksumGroupSize);
+    auto kernel = CompileKernel("kttBlockChecksum", source, options);
+    m_ChecksumKernels[dataType] = kernel;
+    return kernel;
+}
+
+std::shared_ptr<OpenClKernel> OpenClEngine::CompileKernel(const std::string& name, const std::string& source,
+    const std::string& compilerOptions)
+{
+    auto program = BuildProgram(source, compilerOptions);
+    return std::make_shared<OpenClKernel>(std::move(program), name, m_ComputeIdGenerator, m_Configuration);
+}
+
+std::unique_ptr<OpenClProgram> OpenClEngine::BuildProgram(const std::string& source, const std::string& compilerOptions)
+{
+    if (!m_BinaryCache.IsEnabled())
+    {
+        auto program = std::make_unique<OpenClProgram>(*m_Context, source);
+        program->Build(compilerOptions);
+        return program;
+    }
+
+    const std::string key = GetBinaryCacheKey(source, compilerOptions);
+    std::vector<uint8_t> binary;
+
+    if (m_BinaryCache.Load(key, binary))
+    {
+        try
+        {
+            auto program = std::make_unique<OpenClProgram>(*m_Context, source, binary);
+            program->Build(compilerOptions);
+            return program;
+        }
+        catch (const KttException& exception)
+        {
+            Logger::LogDebug(std::string("Cached kernel binary could not be used, kernel will be recompiled: ") + exception.what());
+        }
+    }
+
+    auto program = std::make_unique<OpenClProgram>(*m_Context, source);
+    program->Build(compilerOptions);
+    m_BinaryCache.Store(key, program->GetBinary());
+    return program;
+}
+
+std::string OpenClEngine::GetBinaryCacheKey(const std::string& source, const std::string& compilerOptions) const
+{
+    return KernelBinaryCache::GenerateKey({source, compilerOptions, m_DeviceInfo.GetName(), m_DriverVersion});
+}
+
+ctpl::thread_pool& OpenClEngine::GetCompilationPool()
+{
+    if (m_CompilationPool == nullptr)
+    {
+        m_CompilationPool = std::make_unique<ctpl::thread_pool>();
+    }
+
+    return *m_CompilationPool;
+}
+
+bool OpenClEngine::IsStagingUsed(const OpenClBuffer& buffer, const size_t dataSize) const
+{
+    return m_StagingPool.IsEnabled() && buffer.GetMemoryLocation() == ArgumentMemoryLocation::Device
+        && dataSize >= m_StagingThreshold;
+}
+
+std::unique_ptr<OpenClTransferAction> OpenClEngine::UploadStaged(const OpenClBuffer& buffer, const OpenClCommandQueue& queue,
+    const void* source, const size_t dataSize)
+{
+    Logger::LogDebug("Uploading data into OpenCL buffer with id " + buffer.GetArgumentId() + " through staging buffers");
+
+    Timer timer;
+    timer.Start();
+
+    const size_t chunkSize = m_StagingPool.GetChunkSize();
+    const auto* sourceBytes = static_cast<const uint8_t*>(source);
+    std::array<StagingBufferPool<OpenClStagingBuffer>::Lease, 2> leases;
+    std::array<std::unique_ptr<OpenClEvent>, 2> events;
+
+    // Two staging buffers are used alternately, copying of a chunk into pinned memory overlaps with transfer of the previous one
+    for (size_t offset = 0, chunk = 0; offset < dataSize; offset += chunkSize, ++chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t size = std::min(chunkSize, dataSize - offset);
+
+        if (events[slot] != nullptr)
+        {
+            events[slot]->WaitForFinish();
+        }
+
+        if (!leases[slot].IsValid())
+        {
+            leases[slot] = m_StagingPool.Acquire(size);
+        }
+
+        events[slot] = std::make_unique<OpenClEvent>();
+
+        if (!leases[slot].IsValid())
+        {
+            // Staging memory limit was reached, the remaining data are transferred directly
+            CheckError(clEnqueueWriteBuffer(queue.GetQueue(), buffer.GetBuffer(), CL_FALSE, offset, dataSize - offset,
+                sourceBytes + offset, 0, nullptr, events[slot]->GetEvent()), "clEnqueueWriteBuffer");
+            events[slot]->SetReleaseFlag();
+            break;
+        }
+
+        void* staging = leases[slot].GetBuffer().GetPointer();
+        std::memcpy(staging, sourceBytes + offset, size);
+        CheckError(clEnqueueWriteBuffer(queue.GetQueue(), buffer.GetBuffer(), CL_FALSE, offset, size, staging, 0, nullptr,
+            events[slot]->GetEvent()), "clEnqueueWriteBuffer");
+        events[slot]->SetReleaseFlag();
+    }
+
+    for (const auto& event : events)
+    {
+        if (event != nullptr)
+        {
+            event->WaitForFinish();
+        }
+    }
+
+    timer.Stop();
+
+    auto action = std::make_unique<OpenClTransferAction>(m_TransferIdGenerator.GenerateId(), queue.GetId(), false);
+    action->SetDuration(timer.GetElapsedTime());
+    return action;
+}
+
+std::unique_ptr<OpenClTransferAction> OpenClEngine::DownloadStaged(const OpenClBuffer& buffer, const OpenClCommandQueue& queue,
+    void* destination, const size_t dataSize)
+{
+    Logger::LogDebug("Downloading data from OpenCL buffer with id " + buffer.GetArgumentId() + " through staging buffers");
+
+    Timer timer;
+    timer.Start();
+
+    const size_t chunkSize = m_StagingPool.GetChunkSize();
+    const size_t chunkCount = (dataSize + chunkSize - 1) / chunkSize;
+    auto* destinationBytes = static_cast<uint8_t*>(destination);
+    std::array<StagingBufferPool<OpenClStagingBuffer>::Lease, 2> leases;
+    std::array<std::unique_ptr<OpenClEvent>, 2> events;
+
+    const auto enqueueChunk = [&](const size_t chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t offset = chunk * chunkSize;
+        const size_t size = std::min(chunkSize, dataSize - offset);
+
+        if (!leases[slot].IsValid())
+        {
+            leases[slot] = m_StagingPool.Acquire(size);
+
+            if (!leases[slot].IsValid())
+            {
+                return false;
+            }
+        }
+
+        events[slot] = std::make_unique<OpenClEvent>();
+        CheckError(clEnqueueReadBuffer(queue.GetQueue(), buffer.GetBuffer(), CL_FALSE, offset, size,
+            leases[slot].GetBuffer().GetPointer(), 0, nullptr, events[slot]->GetEvent()), "clEnqueueReadBuffer");
+        events[slot]->SetReleaseFlag();
+        return true;
+    };
+
+    size_t enqueuedCount = 0;
+
+    while (enqueuedCount < std::min<size_t>(2, chunkCount) && enqueueChunk(enqueuedCount))
+    {
+        ++enqueuedCount;
+    }
+
+    // Transfer of the next chunk is enqueued as soon as a staging buffer is copied out, so that both directions overlap
+    for (size_t chunk = 0; chunk < enqueuedCount; ++chunk)
+    {
+        const size_t slot = chunk % 2;
+        const size_t offset = chunk * chunkSize;
+        events[slot]->WaitForFinish();
+        std::memcpy(destinationBytes + offset, leases[slot].GetBuffer().GetPointer(), std::min(chunkSize, dataSize - offset));
+
+        if (enqueuedCount < chunkCount && enqueueChunk(enqueuedCount))
+        {
+            ++enqueuedCount;
+        }
+    }
+
+    if (enqueuedCount < chunkCount)
+    {
+        // Staging memory limit was reached, the remaining data are transferred directly
+        const size_t offset = enqueuedCount * chunkSize;
+        CheckError(clEnqueueReadBuffer(queue.GetQueue(), buffer.GetBuffer(), CL_TRUE, offset, dataSize - offset,
+            destinationBytes + offset, 0, nullptr, nullptr), "clEnqueueReadBuffer");
+    }
+
+    timer.Stop();
+
+    auto action = std::make_unique<OpenClTransferAction>(m_TransferIdGenerator.GenerateId(), queue.GetId(), false);
+    action->SetDuration(timer.GetElapsedTime());
+    return action;
+}
+
 void OpenClEngine::SetKernelArguments(OpenClKernel& kernel, const std::vector<KernelArgument*> arguments)
 {
     kernel.ResetArguments();
@@ -2,19 +2,26 @@
 
 #ifdef KTT_API_OPENCL
 
+#include <future>
 #include <map>
 #include <memory>
+#include <set>
 #include <vector>
+#include <ctpl_stl.h>
 
 #include <Api/ComputeApiInitializer.h>
 #include <ComputeEngine/OpenCl/Actions/OpenClComputeAction.h>
 #include <ComputeEngine/OpenCl/Actions/OpenClTransferAction.h>
 #include <ComputeEngine/OpenCl/Buffers/OpenClBuffer.h>
+#include <ComputeEngine/OpenCl/Buffers/OpenClStagingBuffer.h>
 #include <ComputeEngine/OpenCl/OpenClCommandQueue.h>
 #include <ComputeEngine/OpenCl/OpenClContext.h>
 #include <ComputeEngine/OpenCl/OpenClKernel.h>
 #include <ComputeEngine/ComputeEngine.h>
 #include <ComputeEngine/EngineConfiguration.h>
+#include <ComputeEngine/KernelBinaryCache.h>
+#include <ComputeEngine/StagingBufferPool.h>
+#include <ComputeEngine/TransferMonitor.h>
 #include <Utility/IdGenerator.h>
 #include <Utility/LruCache.h>
 
@@ -32,12 +39,19 @@ class OpenClEngine : public ComputeEngine
 public:
     explicit OpenClEngine(const PlatformIndex platformIndex, const DeviceIndex deviceIndex, const uint32_t queueCount);
     explicit OpenClEngine(const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds);
+    explicit OpenClEngine(const PlatformIndex platformIndex, const DeviceIndex deviceIndex, cl_device_id subDevice,
+        const uint32_t queueCount);
+
+    static std::vector<std::unique_ptr<ComputeEngine>> CreateSubDeviceEngines(const PlatformIndex platformIndex,
+        const DeviceIndex deviceIndex, const uint32_t subDeviceCount, const uint32_t queueCount);
 
     // Kernel methods
     ComputeActionId RunKernelAsync(const KernelComputeData& data, const QueueId queueId, const bool powerMeasurementAllowed = false) override;
     ComputationResult WaitForComputeAction(const ComputeActionId id) override;
     void ClearData(const KernelComputeId& id) override;
     void ClearKernelData(const std::string& kernelName) override;
+    void CompileKernelAsync(const KernelComputeData& data) override;
+    void PrecompileKernels(const std::vector<KernelComputeData>& data) override;
 
     // Profiling methods
     ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) override;
@@ -64,6 +78,8 @@ public:
     void ClearBuffer(const ArgumentId& id) override;
     void ClearBuffers() override;
     bool HasBuffer(const ArgumentId& id) override;
+    bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) override;
 
     // Queue methods
     QueueId AddComputeQueue(ComputeQueue queue) override;
@@ -81,13 +97,19 @@ public:
     DeviceInfo GetCurrentDeviceInfo() const override;
     ComputeApi GetComputeApi() const override;
     GlobalSizeType GetGlobalSizeType() const override;
+    KernelCacheStatistics GetKernelCacheStatistics() const override;
+    TransferStatistics GetTransferStatistics() const override;
 
     // Utility methods
     void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) override;
     void SetGlobalSizeType(const GlobalSizeType type) override;
     void SetAutomaticGlobalSizeCorrection(const bool flag) override;
     void SetKernelCacheCapacity(const uint64_t capacity) override;
+    void SetKernelCacheMemoryLimit(const uint64_t limit) override;
+    void SetKernelCachePolicy(const KernelCachePolicy policy) override;
     void ClearKernelCache() override;
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) override;
+    void SetStagingMemoryLimit(const uint64_t limit) override;
     void EnsureThreadContext() override;
 
 private:
@@ -100,10 +122,17 @@ private:
     IdGenerator<TransferActionId> m_TransferIdGenerator;
     std::unique_ptr<OpenClContext> m_Context;
     std::map<QueueId, std::unique_ptr<OpenClCommandQueue>> m_Queues;
+    StagingBufferPool<OpenClStagingBuffer> m_StagingPool;
+    TransferMonitor m_TransferMonitor;
     std::map<ArgumentId, std::unique_ptr<OpenClBuffer>> m_Buffers;
     LruCache<KernelComputeId, std::shared_ptr<OpenClKernel>> m_KernelCache;
+    std::map<ArgumentDataType, std::shared_ptr<OpenClKernel>> m_ChecksumKernels;
+    KernelBinaryCache m_BinaryCache;
+    std::string m_DriverVersion;
     std::map<ComputeActionId, std::unique_ptr<OpenClComputeAction>> m_ComputeActions;
     std::map<TransferActionId, std::unique_ptr<OpenClTransferAction>> m_TransferActions;
+    std::map<KernelComputeId, std::future<std::shared_ptr<OpenClKernel>>> m_PendingKernels;
+    std::unique_ptr<ctpl::thread_pool> m_CompilationPool;
 
 #if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
     std::unique_ptr<GpaInterface> m_GpaInterface;
@@ -112,6 +141,17 @@ private:
 #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
 
     std::shared_ptr<OpenClKernel> LoadKernel(const KernelComputeData& data);
+    std::shared_ptr<OpenClKernel> LoadChecksumKernel(const ArgumentDataType dataType);
+    std::shared_ptr<OpenClKernel> CompileKernel(const std::string& name, const std::string& source,
+        const std::string& compilerOptions);
+    std::unique_ptr<OpenClProgram> BuildProgram(const std::string& source, const std::string& compilerOptions);
+    std::string GetBinaryCacheKey(const std::string& source, const std::string& compilerOptions) const;
+    ctpl::thread_pool& GetCompilationPool();
+    bool IsStagingUsed(const OpenClBuffer& buffer, const size_t dataSize) const;
+    std::unique_ptr<OpenClTransferAction> UploadStaged(const OpenClBuffer& buffer, const OpenClCommandQueue& queue,
+        const void* source, const size_t dataSize);
+    std::unique_ptr<OpenClTransferAction> DownloadStaged(const OpenClBuffer& buffer, const OpenClCommandQueue& queue,
+        void* destination, const size_t dataSize);
     void SetKernelArguments(OpenClKernel& kernel, const std::vector<KernelArgument*> arguments);
     void SetKernelArgument(OpenClKernel& kernel, const KernelArgument& argument);
     size_t GetLocalMemorySize(const std::vector<KernelArgument*>& arguments) const;
@@ -124,6 +164,12 @@ private:
     void InitializeProfiling(const KernelComputeId& id);
     void FillProfilingData(const KernelComputeId& id, ComputationResult& result);
 #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
+
+    // Small transfers do not benefit from staging, since the extra copy costs more than the slower transfer from pageable memory
+    inline static const size_t m_StagingThreshold = 1 << 16;
+
+    // Work-group size of the kernel which reduces a single checksum block
+    inline static const size_t m_ChecksumGroupSize = 64;
 };
 
 } // namespace ktt
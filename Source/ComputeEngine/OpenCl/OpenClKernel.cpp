@@ -132,6 +132,11 @@ uint64_t OpenClKernel::GetAttribute(const cl_kernel_work_group_info attribute) c
     return result;
 }
 
+uint64_t OpenClKernel::GetMemorySize() const
+{
+    return static_cast<uint64_t>(m_Program->GetBinarySize());
+}
+
 void OpenClKernel::SetKernelArgumentVector(const void* buffer)
 {
     Logger::LogDebug("Setting vector argument on index " + std::to_string(m_NextArgumentIndex)
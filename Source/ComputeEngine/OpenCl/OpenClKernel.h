@@ -39,6 +39,7 @@ public:
     const std::string& GetName() const;
     cl_kernel GetKernel() const;
     uint64_t GetAttribute(const cl_kernel_work_group_info attribute) const;
+    uint64_t GetMemorySize() const;
 
 private:
     std::string m_Name;
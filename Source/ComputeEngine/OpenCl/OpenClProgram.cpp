@@ -23,6 +23,20 @@ OpenClProgram::OpenClProgram(const OpenClContext& context, const std::string& so
     CheckError(result, "clCreateProgramWithSource");
 }
 
+OpenClProgram::OpenClProgram(const OpenClContext& context, const std::string& source, const std::vector<uint8_t>& binary) :
+    m_Source(source),
+    m_Device(context.GetDevice())
+{
+    const size_t binaryLength = binary.size();
+    const unsigned char* binaryPointer = binary.data();
+    cl_int binaryStatus;
+    cl_int result;
+    m_Program = clCreateProgramWithBinary(context.GetContext(), 1, &m_Device, &binaryLength, &binaryPointer, &binaryStatus,
+        &result);
+    CheckError(result, "clCreateProgramWithBinary");
+    CheckError(binaryStatus, "clCreateProgramWithBinary");
+}
+
 OpenClProgram::~OpenClProgram()
 {
     CheckError(clReleaseProgram(m_Program), "clReleaseProgram");
@@ -56,6 +70,23 @@ cl_device_id OpenClProgram::GetDevice() const
     return m_Device;
 }
 
+std::vector<uint8_t> OpenClProgram::GetBinary() const
+{
+    std::vector<uint8_t> binary(GetBinarySize());
+    unsigned char* binaryPointer = binary.data();
+    CheckError(clGetProgramInfo(m_Program, CL_PROGRAM_BINARIES, sizeof(unsigned char*), &binaryPointer, nullptr),
+        "clGetProgramInfo");
+
+    return binary;
+}
+
+size_t OpenClProgram::GetBinarySize() const
+{
+    size_t binarySize;
+    CheckError(clGetProgramInfo(m_Program, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &binarySize, nullptr), "clGetProgramInfo");
+    return binarySize;
+}
+
 std::string OpenClProgram::GetBuildLog() const
 {
     size_t infoSize;
@@ -2,7 +2,9 @@
 
 #ifdef KTT_API_OPENCL
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <CL/cl.h>
 
 namespace ktt
@@ -14,6 +16,7 @@ class OpenClProgram
 {
 public:
     explicit OpenClProgram(const OpenClContext& context, const std::string& source);
+    explicit OpenClProgram(const OpenClContext& context, const std::string& source, const std::vector<uint8_t>& binary);
     ~OpenClProgram();
 
     void Build(const std::string& compilerOptions) const;
@@ -21,6 +24,8 @@ public:
     const std::string& GetSource() const;
     cl_program GetProgram() const;
     cl_device_id GetDevice() const;
+    std::vector<uint8_t> GetBinary() const;
+    size_t GetBinarySize() const;
 
 private:
     std::string m_Source;
@@ -0,0 +1,485 @@
+#include <algorithm>
+#include <limits>
+
+#include <Api/Configuration/KernelConfiguration.h>
+#include <Api/KttException.h>
+#include <ComputeEngine/Replay/ReplayEngine.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/Logger/Logger.h>
+#include <Utility/StlHelpers.h>
+#include <Utility/StringUtility.h>
+
+namespace ktt
+{
+
+ReplayEngine::ReplayEngine(const TunerMetadata& metadata, const std::vector<KernelResult>& results, VirtualClock* virtualClock) :
+    m_Configuration(metadata.GetGlobalSizeType()),
+    m_Metadata(metadata),
+    m_VirtualClock(virtualClock),
+    m_RecordedResults(results),
+    m_ResultIndex(m_RecordedResults)
+{
+    const auto failedCount = std::count_if(m_RecordedResults.cbegin(), m_RecordedResults.cend(), [](const auto& result)
+    {
+        return !result.IsValid();
+    });
+
+    Logger::LogInfo("Replay engine loaded " + std::to_string(m_ResultIndex.GetComputationCount()) + " recorded kernel runs and "
+        + std::to_string(failedCount) + " failed configurations");
+}
+
+ComputeActionId ReplayEngine::RunKernelAsync(const KernelComputeData& data, const QueueId queueId,
+    [[maybe_unused]] const bool powerMeasurementAllowed)
+{
+    CheckQueue(queueId);
+
+    ReplayComputeAction action{queueId, data.GetUniqueIdentifier(), ReplayKernel(data)};
+    const auto id = m_ComputeIdGenerator.GenerateId();
+    m_ComputeActions.emplace(id, std::move(action));
+    return id;
+}
+
+ComputationResult ReplayEngine::WaitForComputeAction(const ComputeActionId id)
+{
+    if (!ContainsKey(m_ComputeActions, id))
+    {
+        throw KttException("Compute action with id " + std::to_string(id) + " was not found");
+    }
+
+    ComputationResult result = m_ComputeActions.find(id)->second.m_Result;
+    m_ComputeActions.erase(id);
+
+    if (m_VirtualClock != nullptr)
+    {
+        m_VirtualClock->Advance(result.GetDuration() + result.GetOverhead());
+    }
+
+    return result;
+}
+
+void ReplayEngine::ClearData(const KernelComputeId& id)
+{
+    EraseIf(m_ComputeActions, [&id](const auto& pair)
+    {
+        return pair.second.m_ComputeId == id;
+    });
+}
+
+void ReplayEngine::ClearKernelData(const std::string& kernelName)
+{
+    EraseIf(m_ComputeActions, [&kernelName](const auto& pair)
+    {
+        return StartsWith(pair.second.m_ComputeId, kernelName);
+    });
+
+    for (auto iterator = m_CompiledKernels.begin(); iterator != m_CompiledKernels.end();)
+    {
+        if (StartsWith(*iterator, kernelName))
+        {
+            iterator = m_CompiledKernels.erase(iterator);
+        }
+        else
+        {
+            ++iterator;
+        }
+    }
+}
+
+void ReplayEngine::CompileKernelAsync([[maybe_unused]] const KernelComputeData& data)
+{
+    // Recorded compilation overhead is replayed on the first launch
+}
+
+void ReplayEngine::PrecompileKernels([[maybe_unused]] const std::vector<KernelComputeData>& data)
+{
+    // Recorded compilation overhead is replayed on the first launch
+}
+
+ComputationResult ReplayEngine::RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId)
+{
+    CheckQueue(queueId);
+    ComputationResult result = ReplayKernel(data);
+
+    if (!result.HasProfilingData())
+    {
+        throw KttException("Recorded result for kernel " + data.GetName() + " with configuration "
+            + data.GetConfiguration().GetString() + " does not contain profiling data");
+    }
+
+    if (m_VirtualClock != nullptr)
+    {
+        m_VirtualClock->Advance(result.GetDuration() + result.GetOverhead());
+    }
+
+    return result;
+}
+
+void ReplayEngine::SetProfilingCounters([[maybe_unused]] const std::vector<std::string>& counters)
+{
+    Logger::LogWarning("Replay engine returns recorded profiling counters, the specified counters are ignored");
+}
+
+bool ReplayEngine::IsProfilingSessionActive([[maybe_unused]] const KernelComputeId& id)
+{
+    return false;
+}
+
+uint64_t ReplayEngine::GetRemainingProfilingRuns([[maybe_unused]] const KernelComputeId& id)
+{
+    return 0;
+}
+
+bool ReplayEngine::HasAccurateRemainingProfilingRuns() const
+{
+    return true;
+}
+
+bool ReplayEngine::SupportsMultiInstanceProfiling() const
+{
+    return true;
+}
+
+bool ReplayEngine::IsProfilingActive() const
+{
+    return m_Configuration.IsProfilingActive();
+}
+
+void ReplayEngine::SetProfiling(const bool profiling)
+{
+    m_Configuration.SetProfiling(profiling);
+}
+
+TransferActionId ReplayEngine::UploadArgument(KernelArgument& kernelArgument, const QueueId queueId)
+{
+    const auto id = kernelArgument.GetId();
+    Logger::LogDebug("Uploading buffer for argument with id " + id);
+    CheckQueue(queueId);
+
+    if (ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " already exists");
+    }
+
+    if (kernelArgument.GetMemoryType() != ArgumentMemoryType::Vector)
+    {
+        throw KttException("Argument with id " + id + " is not a vector and cannot be uploaded into buffer");
+    }
+
+    m_Buffers[id] = kernelArgument.GetDataSize();
+    const auto actionId = AddTransferAction();
+    m_TransferMonitor.AddUpload(actionId, kernelArgument.GetDataSize(), false);
+    return actionId;
+}
+
+TransferActionId ReplayEngine::UpdateArgument(const ArgumentId& id, const QueueId queueId, [[maybe_unused]] const void* data,
+    const size_t dataSize)
+{
+    Logger::LogDebug("Updating buffer for argument with id " + id);
+    CheckQueue(queueId);
+
+    if (dataSize > GetBufferSize(id))
+    {
+        throw KttException("Size of data exceeds size of buffer for argument with id " + id);
+    }
+
+    const auto actionId = AddTransferAction();
+    m_TransferMonitor.AddUpload(actionId, dataSize == 0 ? GetBufferSize(id) : dataSize, false);
+    return actionId;
+}
+
+TransferActionId ReplayEngine::DownloadArgument(const ArgumentId& id, const QueueId queueId, [[maybe_unused]] void* destination,
+    const size_t dataSize)
+{
+    Logger::LogDebug("Downloading buffer for argument with id " + id);
+    CheckQueue(queueId);
+
+    if (dataSize > GetBufferSize(id))
+    {
+        throw KttException("Requested data size exceeds size of buffer for argument with id " + id);
+    }
+
+    // Replayed kernels do not compute any output, destination memory is left unchanged
+    const auto actionId = AddTransferAction();
+    m_TransferMonitor.AddDownload(actionId, dataSize == 0 ? GetBufferSize(id) : dataSize, false);
+    return actionId;
+}
+
+TransferActionId ReplayEngine::CopyArgument(const ArgumentId& destination, const QueueId queueId, const ArgumentId& source,
+    const size_t dataSize)
+{
+    Logger::LogDebug("Copying buffer for argument with id " + source + " into buffer for argument with id " + destination);
+    CheckQueue(queueId);
+
+    if (dataSize > GetBufferSize(source) || dataSize > GetBufferSize(destination))
+    {
+        throw KttException("Size of copied data exceeds size of buffer for argument with id " + source + " or " + destination);
+    }
+
+    return AddTransferAction();
+}
+
+TransferResult ReplayEngine::WaitForTransferAction(const TransferActionId id)
+{
+    if (!ContainsKey(m_TransferActions, id))
+    {
+        throw KttException("Transfer action with id " + std::to_string(id) + " was not found");
+    }
+
+    const TransferResult result = m_TransferActions[id];
+    m_TransferMonitor.FinishTransfer(id, result);
+    m_TransferActions.erase(id);
+    return result;
+}
+
+void ReplayEngine::ResizeArgument(const ArgumentId& id, const size_t newSize, [[maybe_unused]] const bool preserveData)
+{
+    GetBufferSize(id);
+    m_Buffers[id] = newSize;
+}
+
+void ReplayEngine::GetUnifiedMemoryBufferHandle([[maybe_unused]] const ArgumentId& id, [[maybe_unused]] UnifiedBufferMemory& handle)
+{
+    throw KttException("Replay engine does not allocate buffer memory, unified memory buffers are not available");
+}
+
+void ReplayEngine::AddCustomBuffer(KernelArgument& kernelArgument, [[maybe_unused]] ComputeBuffer buffer)
+{
+    const auto id = kernelArgument.GetId();
+
+    if (ContainsKey(m_Buffers, id))
+    {
+        throw KttException("Buffer for argument with id " + id + " already exists");
+    }
+
+    m_Buffers[id] = kernelArgument.GetDataSize();
+}
+
+void ReplayEngine::ClearBuffer(const ArgumentId& id)
+{
+    m_Buffers.erase(id);
+}
+
+void ReplayEngine::ClearBuffers()
+{
+    m_Buffers.clear();
+}
+
+bool ReplayEngine::HasBuffer(const ArgumentId& id)
+{
+    return ContainsKey(m_Buffers, id);
+}
+
+bool ReplayEngine::ComputeBlockChecksums([[maybe_unused]] const ArgumentId& id, [[maybe_unused]] const ArgumentDataType dataType,
+    [[maybe_unused]] const size_t elementCount, [[maybe_unused]] const size_t blockSize, [[maybe_unused]] const QueueId queueId,
+    [[maybe_unused]] std::vector<BlockChecksum>& checksums)
+{
+    return false;
+}
+
+QueueId ReplayEngine::AddComputeQueue([[maybe_unused]] ComputeQueue queue)
+{
+    throw KttException("Support for compute queue addition is not available for replay engine");
+}
+
+void ReplayEngine::RemoveComputeQueue([[maybe_unused]] const QueueId id)
+{
+    throw KttException("Support for compute queue removal is not available for replay engine");
+}
+
+QueueId ReplayEngine::GetDefaultQueue() const
+{
+    return static_cast<QueueId>(0);
+}
+
+std::vector<QueueId> ReplayEngine::GetAllQueues() const
+{
+    return std::vector<QueueId>{GetDefaultQueue()};
+}
+
+void ReplayEngine::SynchronizeQueue(const QueueId queueId)
+{
+    CheckQueue(queueId);
+    ClearQueueActions(queueId);
+}
+
+void ReplayEngine::SynchronizeQueues()
+{
+    ClearQueueActions(GetDefaultQueue());
+}
+
+void ReplayEngine::SynchronizeDevice()
+{
+    m_ComputeActions.clear();
+    m_TransferActions.clear();
+}
+
+std::vector<PlatformInfo> ReplayEngine::GetPlatformInfo() const
+{
+    PlatformInfo info(0, m_Metadata.GetPlatformName());
+    info.SetVendor("N/A");
+    info.SetVersion("N/A");
+    info.SetExtensions("N/A");
+    return std::vector<PlatformInfo>{info};
+}
+
+std::vector<DeviceInfo> ReplayEngine::GetDeviceInfo(const PlatformIndex platformIndex) const
+{
+    if (platformIndex != 0)
+    {
+        throw KttException("Invalid platform index: " + std::to_string(platformIndex));
+    }
+
+    // Device limits were already applied when the results were recorded, failed configurations are replayed as failures
+    DeviceInfo info(0, m_Metadata.GetDeviceName());
+    info.SetVendor("N/A");
+    info.SetExtensions("N/A");
+    info.SetMaxWorkGroupSize(std::numeric_limits<uint64_t>::max());
+    return std::vector<DeviceInfo>{info};
+}
+
+PlatformInfo ReplayEngine::GetCurrentPlatformInfo() const
+{
+    return GetPlatformInfo()[0];
+}
+
+DeviceInfo ReplayEngine::GetCurrentDeviceInfo() const
+{
+    return GetDeviceInfo(0)[0];
+}
+
+ComputeApi ReplayEngine::GetComputeApi() const
+{
+    return m_Metadata.GetComputeApi();
+}
+
+GlobalSizeType ReplayEngine::GetGlobalSizeType() const
+{
+    return m_Configuration.GetGlobalSizeType();
+}
+
+KernelCacheStatistics ReplayEngine::GetKernelCacheStatistics() const
+{
+    KernelCacheStatistics statistics;
+    statistics.m_EntryCount = static_cast<uint64_t>(m_CompiledKernels.size());
+    return statistics;
+}
+
+TransferStatistics ReplayEngine::GetTransferStatistics() const
+{
+    return m_TransferMonitor.GetStatistics();
+}
+
+void ReplayEngine::SetCompilerOptions(const std::string& options, [[maybe_unused]] const bool overrideDefault)
+{
+    m_Configuration.SetCompilerOptions(options);
+}
+
+void ReplayEngine::SetGlobalSizeType(const GlobalSizeType type)
+{
+    m_Configuration.SetGlobalSizeType(type);
+}
+
+void ReplayEngine::SetAutomaticGlobalSizeCorrection(const bool flag)
+{
+    m_Configuration.SetGlobalSizeCorrection(flag);
+}
+
+void ReplayEngine::SetKernelCacheCapacity([[maybe_unused]] const uint64_t capacity)
+{}
+
+void ReplayEngine::SetKernelCacheMemoryLimit([[maybe_unused]] const uint64_t limit)
+{}
+
+void ReplayEngine::SetKernelCachePolicy([[maybe_unused]] const KernelCachePolicy policy)
+{}
+
+void ReplayEngine::ClearKernelCache()
+{
+    m_CompiledKernels.clear();
+}
+
+void ReplayEngine::SetKernelBinaryCache([[maybe_unused]] const std::string& directory, [[maybe_unused]] const uint64_t maximumSize)
+{}
+
+void ReplayEngine::SetStagingMemoryLimit([[maybe_unused]] const uint64_t limit)
+{}
+
+void ReplayEngine::EnsureThreadContext()
+{}
+
+ComputationResult ReplayEngine::ReplayKernel(const KernelComputeData& data)
+{
+    const auto& configuration = data.GetConfiguration();
+    const KernelResult* failure = m_ResultIndex.TryFind(configuration);
+
+    if (failure != nullptr && !failure->IsValid())
+    {
+        if (m_VirtualClock != nullptr)
+        {
+            m_VirtualClock->Advance(failure->GetTotalOverhead());
+        }
+
+        const ResultStatus status = failure->GetStatus();
+        const ExceptionReason reason = status == ResultStatus::CompilationFailed ? ExceptionReason::CompilerError
+            : status == ResultStatus::DeviceLimitsExceeded ? ExceptionReason::DeviceLimitsExceeded : ExceptionReason::General;
+        throw KttException("Recorded run of kernel " + data.GetName() + " with configuration " + configuration.GetString()
+            + " has failed", reason);
+    }
+
+    const ComputationResult* recorded = m_ResultIndex.TryFind(data.GetName(), configuration);
+
+    if (recorded == nullptr)
+    {
+        throw KttException("Recorded result for kernel " + data.GetName() + " with configuration " + configuration.GetString()
+            + " was not found");
+    }
+
+    ComputationResult result = *recorded;
+
+    // Compilation overhead is replayed only on the first launch, the same as with kernel cache of real engines
+    if (!m_CompiledKernels.insert(data.GetUniqueIdentifier()).second)
+    {
+        const Nanoseconds compilationOverhead = result.GetCompilationOverhead();
+        const Nanoseconds overhead = result.GetOverhead() - std::min(result.GetOverhead(), compilationOverhead);
+        result.SetDurationData(result.GetDuration(), overhead, 0);
+    }
+
+    return result;
+}
+
+size_t ReplayEngine::GetBufferSize(const ArgumentId& id) const
+{
+    const auto iterator = m_Buffers.find(id);
+
+    if (iterator == m_Buffers.cend())
+    {
+        throw KttException("Buffer for argument with id " + id + " was not found");
+    }
+
+    return iterator->second;
+}
+
+TransferActionId ReplayEngine::AddTransferAction()
+{
+    const auto id = m_TransferIdGenerator.GenerateId();
+    m_TransferActions[id] = TransferResult(0, 0);
+    return id;
+}
+
+void ReplayEngine::CheckQueue(const QueueId queueId) const
+{
+    if (queueId != GetDefaultQueue())
+    {
+        throw KttException("Invalid replay queue index: " + std::to_string(queueId));
+    }
+}
+
+void ReplayEngine::ClearQueueActions(const QueueId id)
+{
+    EraseIf(m_ComputeActions, [id](const auto& pair)
+    {
+        return pair.second.m_QueueId == id || pair.second.m_QueueId == InvalidQueueId;
+    });
+}
+
+} // namespace ktt
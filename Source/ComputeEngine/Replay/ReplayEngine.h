@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Api/Output/KernelResult.h>
+#include <ComputeEngine/ComputeEngine.h>
+#include <ComputeEngine/EngineConfiguration.h>
+#include <ComputeEngine/TransferMonitor.h>
+#include <Output/TunerMetadata.h>
+#include <TuningRunner/ResultIndex.h>
+#include <Utility/IdGenerator.h>
+#include <Utility/Timer/VirtualClock.h>
+
+namespace ktt
+{
+
+// Kernel runs return durations recorded in previously saved results instead of executing kernels, buffers only track sizes
+class ReplayEngine : public ComputeEngine
+{
+public:
+    explicit ReplayEngine(const TunerMetadata& metadata, const std::vector<KernelResult>& results, VirtualClock* virtualClock);
+
+    // Kernel methods
+    ComputeActionId RunKernelAsync(const KernelComputeData& data, const QueueId queueId, const bool powerMeasurementAllowed = false) override;
+    ComputationResult WaitForComputeAction(const ComputeActionId id) override;
+    void ClearData(const KernelComputeId& id) override;
+    void ClearKernelData(const std::string& kernelName) override;
+    void CompileKernelAsync(const KernelComputeData& data) override;
+    void PrecompileKernels(const std::vector<KernelComputeData>& data) override;
+
+    // Profiling methods
+    ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) override;
+    void SetProfilingCounters(const std::vector<std::string>& counters) override;
+    bool IsProfilingSessionActive(const KernelComputeId& id) override;
+    uint64_t GetRemainingProfilingRuns(const KernelComputeId& id) override;
+    bool HasAccurateRemainingProfilingRuns() const override;
+    bool SupportsMultiInstanceProfiling() const override;
+    bool IsProfilingActive() const override;
+    void SetProfiling(const bool profiling) override;
+
+    // Buffer methods
+    TransferActionId UploadArgument(KernelArgument& kernelArgument, const QueueId queueId) override;
+    TransferActionId UpdateArgument(const ArgumentId& id, const QueueId queueId, const void* data,
+        const size_t dataSize) override;
+    TransferActionId DownloadArgument(const ArgumentId& id, const QueueId queueId, void* destination,
+        const size_t dataSize) override;
+    TransferActionId CopyArgument(const ArgumentId& destination, const QueueId queueId, const ArgumentId& source,
+        const size_t dataSize) override;
+    TransferResult WaitForTransferAction(const TransferActionId id) override;
+    void ResizeArgument(const ArgumentId& id, const size_t newSize, const bool preserveData) override;
+    void GetUnifiedMemoryBufferHandle(const ArgumentId& id, UnifiedBufferMemory& handle) override;
+    void AddCustomBuffer(KernelArgument& kernelArgument, ComputeBuffer buffer) override;
+    void ClearBuffer(const ArgumentId& id) override;
+    void ClearBuffers() override;
+    bool HasBuffer(const ArgumentId& id) override;
+    bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) override;
+
+    // Queue methods
+    QueueId AddComputeQueue(ComputeQueue queue) override;
+    void RemoveComputeQueue(const QueueId id) override;
+    QueueId GetDefaultQueue() const override;
+    std::vector<QueueId> GetAllQueues() const override;
+    void SynchronizeQueue(const QueueId queueId) override;
+    void SynchronizeQueues() override;
+    void SynchronizeDevice() override;
+
+    // Information retrieval methods
+    std::vector<PlatformInfo> GetPlatformInfo() const override;
+    std::vector<DeviceInfo> GetDeviceInfo(const PlatformIndex platformIndex) const override;
+    PlatformInfo GetCurrentPlatformInfo() const override;
+    DeviceInfo GetCurrentDeviceInfo() const override;
+    ComputeApi GetComputeApi() const override;
+    GlobalSizeType GetGlobalSizeType() const override;
+    KernelCacheStatistics GetKernelCacheStatistics() const override;
+    TransferStatistics GetTransferStatistics() const override;
+
+    // Utility methods
+    void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) override;
+    void SetGlobalSizeType(const GlobalSizeType type) override;
+    void SetAutomaticGlobalSizeCorrection(const bool flag) override;
+    void SetKernelCacheCapacity(const uint64_t capacity) override;
+    void SetKernelCacheMemoryLimit(const uint64_t limit) override;
+    void SetKernelCachePolicy(const KernelCachePolicy policy) override;
+    void ClearKernelCache() override;
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) override;
+    void SetStagingMemoryLimit(const uint64_t limit) override;
+    void EnsureThreadContext() override;
+
+private:
+    struct ReplayComputeAction
+    {
+        QueueId m_QueueId;
+        KernelComputeId m_ComputeId;
+        ComputationResult m_Result;
+    };
+
+    EngineConfiguration m_Configuration;
+    TunerMetadata m_Metadata;
+    VirtualClock* m_VirtualClock;
+    IdGenerator<ComputeActionId> m_ComputeIdGenerator;
+    IdGenerator<TransferActionId> m_TransferIdGenerator;
+    std::vector<KernelResult> m_RecordedResults;
+    ResultIndex m_ResultIndex;
+    std::set<KernelComputeId> m_CompiledKernels;
+    std::map<ArgumentId, size_t> m_Buffers;
+    TransferMonitor m_TransferMonitor;
+    std::map<ComputeActionId, ReplayComputeAction> m_ComputeActions;
+    std::map<TransferActionId, TransferResult> m_TransferActions;
+
+    ComputationResult ReplayKernel(const KernelComputeData& data);
+    size_t GetBufferSize(const ArgumentId& id) const;
+    TransferActionId AddTransferAction();
+    void CheckQueue(const QueueId queueId) const;
+    void ClearQueueActions(const QueueId id);
+};
+
+} // namespace ktt
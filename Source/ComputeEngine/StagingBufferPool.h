@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ktt
+{
+
+template <typename BufferType>
+class StagingBufferPool
+{
+public:
+    using Allocator = std::function<std::unique_ptr<BufferType>(const size_t size)>;
+
+    class Lease
+    {
+    public:
+        Lease();
+        explicit Lease(StagingBufferPool& pool, std::unique_ptr<BufferType> buffer, const size_t size);
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&& other) = default;
+        Lease& operator=(Lease&& other);
+
+        bool IsValid() const;
+        size_t GetSize() const;
+        BufferType& GetBuffer() const;
+
+    private:
+        StagingBufferPool* m_Pool;
+        std::unique_ptr<BufferType> m_Buffer;
+        size_t m_Size;
+    };
+
+    explicit StagingBufferPool(Allocator allocator);
+
+    void SetMemoryLimit(const uint64_t limit);
+    bool IsEnabled() const;
+    Lease Acquire(const size_t size);
+
+    size_t GetChunkSize() const;
+    uint64_t GetAllocationCount() const;
+    uint64_t GetReuseCount() const;
+    uint64_t GetMemorySize() const;
+
+private:
+    Allocator m_Allocator;
+    std::map<size_t, std::vector<std::unique_ptr<BufferType>>> m_FreeBuffers;
+    uint64_t m_MemoryLimit;
+    uint64_t m_MemorySize;
+    uint64_t m_AllocationCount;
+    uint64_t m_ReuseCount;
+    mutable std::mutex m_Mutex;
+
+    void Release(std::unique_ptr<BufferType> buffer, const size_t size);
+    void ReleaseFreeBuffers(const uint64_t requiredSize);
+    static size_t GetSizeClass(const size_t size);
+
+    // Size classes are powers of two between minimum and maximum size, larger transfers are split into chunks of maximum size
+    inline static const size_t m_MinimumSize = 1 << 16;
+    inline static const size_t m_MaximumSize = 1 << 23;
+};
+
+} // namespace ktt
+
+#include <ComputeEngine/StagingBufferPool.inl>
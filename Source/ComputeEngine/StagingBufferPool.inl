@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <utility>
+
+#include <ComputeEngine/StagingBufferPool.h>
+
+namespace ktt
+{
+
+template <typename BufferType>
+StagingBufferPool<BufferType>::Lease::Lease() :
+    m_Pool(nullptr),
+    m_Size(0)
+{}
+
+template <typename BufferType>
+StagingBufferPool<BufferType>::Lease::Lease(StagingBufferPool& pool, std::unique_ptr<BufferType> buffer, const size_t size) :
+    m_Pool(&pool),
+    m_Buffer(std::move(buffer)),
+    m_Size(size)
+{}
+
+template <typename BufferType>
+StagingBufferPool<BufferType>::Lease::~Lease()
+{
+    if (m_Pool != nullptr && m_Buffer != nullptr)
+    {
+        m_Pool->Release(std::move(m_Buffer), m_Size);
+    }
+}
+
+template <typename BufferType>
+typename StagingBufferPool<BufferType>::Lease& StagingBufferPool<BufferType>::Lease::operator=(Lease&& other)
+{
+    if (this != &other)
+    {
+        if (m_Pool != nullptr && m_Buffer != nullptr)
+        {
+            m_Pool->Release(std::move(m_Buffer), m_Size);
+        }
+
+        m_Pool = other.m_Pool;
+        m_Buffer = std::move(other.m_Buffer);
+        m_Size = other.m_Size;
+    }
+
+    return *this;
+}
+
+template <typename BufferType>
+bool StagingBufferPool<BufferType>::Lease::IsValid() const
+{
+    return m_Buffer != nullptr;
+}
+
+template <typename BufferType>
+size_t StagingBufferPool<BufferType>::Lease::GetSize() const
+{
+    return m_Size;
+}
+
+template <typename BufferType>
+BufferType& StagingBufferPool<BufferType>::Lease::GetBuffer() const
+{
+    return *m_Buffer;
+}
+
+template <typename BufferType>
+StagingBufferPool<BufferType>::StagingBufferPool(Allocator allocator) :
+    m_Allocator(allocator),
+    m_MemoryLimit(0),
+    m_MemorySize(0),
+    m_AllocationCount(0),
+    m_ReuseCount(0)
+{}
+
+template <typename BufferType>
+void StagingBufferPool<BufferType>::SetMemoryLimit(const uint64_t limit)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MemoryLimit = limit;
+
+    if (m_MemorySize > m_MemoryLimit)
+    {
+        ReleaseFreeBuffers(m_MemorySize - m_MemoryLimit);
+    }
+}
+
+template <typename BufferType>
+bool StagingBufferPool<BufferType>::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_MemoryLimit > 0;
+}
+
+template <typename BufferType>
+typename StagingBufferPool<BufferType>::Lease StagingBufferPool<BufferType>::Acquire(const size_t size)
+{
+    const size_t sizeClass = GetSizeClass(size);
+    std::unique_ptr<BufferType> buffer;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto& freeBuffers = m_FreeBuffers[sizeClass];
+
+        if (!freeBuffers.empty())
+        {
+            buffer = std::move(freeBuffers.back());
+            freeBuffers.pop_back();
+            ++m_ReuseCount;
+            return Lease(*this, std::move(buffer), sizeClass);
+        }
+
+        if (m_MemorySize + sizeClass > m_MemoryLimit)
+        {
+            ReleaseFreeBuffers(m_MemorySize + sizeClass - m_MemoryLimit);
+        }
+
+        if (m_MemorySize + sizeClass > m_MemoryLimit)
+        {
+            return Lease();
+        }
+
+        m_MemorySize += sizeClass;
+        ++m_AllocationCount;
+    }
+
+    try
+    {
+        buffer = m_Allocator(sizeClass);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_MemorySize -= sizeClass;
+        --m_AllocationCount;
+        throw;
+    }
+
+    return Lease(*this, std::move(buffer), sizeClass);
+}
+
+template <typename BufferType>
+size_t StagingBufferPool<BufferType>::GetChunkSize() const
+{
+    return m_MaximumSize;
+}
+
+template <typename BufferType>
+uint64_t StagingBufferPool<BufferType>::GetAllocationCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_AllocationCount;
+}
+
+template <typename BufferType>
+uint64_t StagingBufferPool<BufferType>::GetReuseCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_ReuseCount;
+}
+
+template <typename BufferType>
+uint64_t StagingBufferPool<BufferType>::GetMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_MemorySize;
+}
+
+template <typename BufferType>
+void StagingBufferPool<BufferType>::Release(std::unique_ptr<BufferType> buffer, const size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (m_MemorySize > m_MemoryLimit)
+    {
+        // Limit was lowered while the buffer was leased
+        m_MemorySize -= size;
+        return;
+    }
+
+    m_FreeBuffers[size].push_back(std::move(buffer));
+}
+
+template <typename BufferType>
+void StagingBufferPool<BufferType>::ReleaseFreeBuffers(const uint64_t requiredSize)
+{
+    uint64_t releasedSize = 0;
+
+    // Buffers from the largest classes are released first, which frees the required memory with the fewest deallocations
+    for (auto iterator = m_FreeBuffers.rbegin(); iterator != m_FreeBuffers.rend(); ++iterator)
+    {
+        auto& freeBuffers = iterator->second;
+
+        while (!freeBuffers.empty() && releasedSize < requiredSize)
+        {
+            freeBuffers.pop_back();
+            m_MemorySize -= iterator->first;
+            releasedSize += iterator->first;
+        }
+    }
+}
+
+template <typename BufferType>
+size_t StagingBufferPool<BufferType>::GetSizeClass(const size_t size)
+{
+    size_t sizeClass = m_MinimumSize;
+
+    while (sizeClass < size && sizeClass < m_MaximumSize)
+    {
+        sizeClass <<= 1;
+    }
+
+    return sizeClass;
+}
+
+} // namespace ktt
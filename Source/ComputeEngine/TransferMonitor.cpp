@@ -0,0 +1,61 @@
+#include <ComputeEngine/TransferMonitor.h>
+
+namespace ktt
+{
+
+TransferMonitor::TransferMonitor()
+{}
+
+void TransferMonitor::AddUpload(const TransferActionId id, const uint64_t dataSize, const bool staged)
+{
+    m_PendingTransfers[id] = PendingTransfer{dataSize, true, staged};
+}
+
+void TransferMonitor::AddDownload(const TransferActionId id, const uint64_t dataSize, const bool staged)
+{
+    m_PendingTransfers[id] = PendingTransfer{dataSize, false, staged};
+}
+
+void TransferMonitor::FinishTransfer(const TransferActionId id, const TransferResult& result)
+{
+    const auto iterator = m_PendingTransfers.find(id);
+
+    if (iterator == m_PendingTransfers.cend())
+    {
+        return;
+    }
+
+    const PendingTransfer transfer = iterator->second;
+    m_PendingTransfers.erase(iterator);
+    const Nanoseconds duration = result.GetDuration();
+
+    if (duration == InvalidDuration)
+    {
+        return;
+    }
+
+    if (transfer.m_Upload)
+    {
+        ++m_Statistics.m_UploadCount;
+        m_Statistics.m_UploadedBytes += transfer.m_DataSize;
+        m_Statistics.m_UploadTime += duration;
+    }
+    else
+    {
+        ++m_Statistics.m_DownloadCount;
+        m_Statistics.m_DownloadedBytes += transfer.m_DataSize;
+        m_Statistics.m_DownloadTime += duration;
+    }
+
+    if (transfer.m_Staged)
+    {
+        ++m_Statistics.m_StagedTransferCount;
+    }
+}
+
+const TransferStatistics& TransferMonitor::GetStatistics() const
+{
+    return m_Statistics;
+}
+
+} // namespace ktt
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <utility>
+
+#include <Api/Info/TransferStatistics.h>
+#include <ComputeEngine/TransferResult.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+class TransferMonitor
+{
+public:
+    TransferMonitor();
+
+    void AddUpload(const TransferActionId id, const uint64_t dataSize, const bool staged);
+    void AddDownload(const TransferActionId id, const uint64_t dataSize, const bool staged);
+    void FinishTransfer(const TransferActionId id, const TransferResult& result);
+
+    const TransferStatistics& GetStatistics() const;
+
+private:
+    struct PendingTransfer
+    {
+        uint64_t m_DataSize;
+        bool m_Upload;
+        bool m_Staged;
+    };
+
+    std::map<TransferActionId, PendingTransfer> m_PendingTransfers;
+    TransferStatistics m_Statistics;
+};
+
+} // namespace ktt
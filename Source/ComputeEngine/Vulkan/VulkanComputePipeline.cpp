@@ -15,15 +15,14 @@ namespace ktt
 {
 
 VulkanComputePipeline::VulkanComputePipeline(const VulkanDevice& device, IdGenerator<ComputeActionId>& generator,
-    const ShadercCompiler& compiler, const std::string& name, const std::string& source, const DimensionVector& localSize,
-    const KernelConfiguration& configuration, const VulkanDescriptorPool& descriptorPool,
-    const std::vector<KernelArgument*>& arguments) :
+    std::unique_ptr<VulkanShaderModule> shaderModule, const DimensionVector& localSize, const VulkanDescriptorPool& descriptorPool,
+    const std::vector<KernelArgument*>& arguments, VkPipelineCache pipelineCache) :
     m_LocalSize(localSize),
     m_Device(device),
-    m_ShaderModule(std::make_unique<VulkanShaderModule>(compiler, device, name, source, localSize, configuration)),
+    m_ShaderModule(std::move(shaderModule)),
     m_Generator(generator)
 {
-    Logger::LogDebug("Initializing Vulkan compute pipeline with name " + name);
+    Logger::LogDebug("Initializing Vulkan compute pipeline with name " + GetName());
     std::vector<KernelArgument*> scalarArguments;
     uint32_t vectorArgumentCount = 0;
 
@@ -90,7 +89,7 @@ VulkanComputePipeline::VulkanComputePipeline(const VulkanDevice& device, IdGener
         0
     };
 
-    CheckError(vkCreateComputePipelines(m_Device.GetDevice(), nullptr, 1, &pipelineCreateInfo, nullptr, &m_Pipeline),
+    CheckError(vkCreateComputePipelines(m_Device.GetDevice(), pipelineCache, 1, &pipelineCreateInfo, nullptr, &m_Pipeline),
         "vkCreateComputePipelines");
 }
 
@@ -111,6 +110,11 @@ const std::string& VulkanComputePipeline::GetName() const
     return m_ShaderModule->GetName();
 }
 
+uint64_t VulkanComputePipeline::GetMemorySize() const
+{
+    return static_cast<uint64_t>(m_ShaderModule->GetSpirvSource().size() * sizeof(uint32_t));
+}
+
 void VulkanComputePipeline::BindArguments(const std::vector<VulkanBuffer*>& buffers)
 {
     m_DescriptorSets->BindBuffers(buffers, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0);
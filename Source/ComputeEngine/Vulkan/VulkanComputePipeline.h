@@ -2,13 +2,13 @@
 
 #ifdef KTT_API_VULKAN
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
 
 #include <Api/Configuration/DimensionVector.h>
-#include <Api/Configuration/KernelConfiguration.h>
 #include <ComputeEngine/Vulkan/VulkanBuffer.h>
 #include <ComputeEngine/Vulkan/VulkanDescriptorSetLayout.h>
 #include <ComputeEngine/Vulkan/VulkanDescriptorSets.h>
@@ -18,7 +18,6 @@
 namespace ktt
 {
 
-class ShadercCompiler;
 class VulkanCommandPool;
 class VulkanComputeAction;
 class VulkanDescriptorPool;
@@ -29,13 +28,14 @@ class VulkanQueue;
 class VulkanComputePipeline : public std::enable_shared_from_this<VulkanComputePipeline>
 {
 public:
-    explicit VulkanComputePipeline(const VulkanDevice& device, IdGenerator<ComputeActionId>& generator, const ShadercCompiler& compiler,
-        const std::string& name, const std::string& source, const DimensionVector& localSize, const KernelConfiguration& configuration,
-        const VulkanDescriptorPool& descriptorPool, const std::vector<KernelArgument*>& arguments);
+    explicit VulkanComputePipeline(const VulkanDevice& device, IdGenerator<ComputeActionId>& generator,
+        std::unique_ptr<VulkanShaderModule> shaderModule, const DimensionVector& localSize, const VulkanDescriptorPool& descriptorPool,
+        const std::vector<KernelArgument*>& arguments, VkPipelineCache pipelineCache);
     ~VulkanComputePipeline();
 
     VkPipeline GetPipeline() const;
     const std::string& GetName() const;
+    uint64_t GetMemorySize() const;
 
     void BindArguments(const std::vector<VulkanBuffer*>& buffers);
     std::unique_ptr<VulkanComputeAction> DispatchShader(const VulkanQueue& queue, const VulkanCommandPool& commandPool,
@@ -1,5 +1,7 @@
 #ifdef KTT_API_VULKAN
 
+#include <cstring>
+
 #include <Api/KttException.h>
 #include <ComputeEngine/Vulkan/VulkanEngine.h>
 #include <ComputeEngine/Vulkan/VulkanUtility.h>
@@ -49,6 +51,8 @@ VulkanEngine::VulkanEngine(const DeviceIndex deviceIndex, const uint32_t queueCo
     m_QueryPool = std::make_unique<VulkanQueryPool>(*m_Device);
     m_Compiler = std::make_unique<ShadercCompiler>();
     m_Allocator = std::make_unique<VulkanMemoryAllocator>(*m_Instance, *m_Device);
+    m_DriverPipelineCache = std::make_unique<VulkanPipelineCache>(*m_Device);
+    m_DriverVersion = std::to_string(m_Device->GetPhysicalDevice().GetProperties().driverVersion);
     m_DeviceInfo = GetDeviceInfo(0)[m_DeviceIndex];
 }
 
@@ -120,6 +124,16 @@ void VulkanEngine::ClearKernelData(const std::string& kernelName)
     });
 }
 
+void VulkanEngine::CompileKernelAsync([[maybe_unused]] const KernelComputeData& data)
+{
+    // Background compilation is not supported, kernel is compiled on its first launch
+}
+
+void VulkanEngine::PrecompileKernels([[maybe_unused]] const std::vector<KernelComputeData>& data)
+{
+    throw KttException("Kernel precompilation is not yet supported for Vulkan backend");
+}
+
 ComputationResult VulkanEngine::RunKernelWithProfiling([[maybe_unused]] const KernelComputeData& data,
     [[maybe_unused]] const QueueId queueId)
 {
@@ -196,6 +210,7 @@ TransferActionId VulkanEngine::UploadArgument(KernelArgument& kernelArgument, co
         kernelArgument.GetDataSize());
     action->IncreaseOverhead(timer.GetElapsedTime());
     const auto actionId = action->GetId();
+    m_TransferMonitor.AddUpload(actionId, kernelArgument.GetDataSize(), true);
 
     m_Buffers[id] = std::move(buffer);
     m_TransferActions[actionId] = std::move(action);
@@ -249,6 +264,7 @@ TransferActionId VulkanEngine::DownloadArgument(const ArgumentId& id, const Queu
     auto downloadAction = stagingBuffer->DownloadData(destination, actualDataSize);
 
     const auto actionId = downloadAction->GetId();
+    m_TransferMonitor.AddDownload(actionId, actualDataSize, true);
     m_TransferActions[actionId] = std::move(downloadAction);
     return actionId;
 }
@@ -270,6 +286,7 @@ TransferResult VulkanEngine::WaitForTransferAction(const TransferActionId id)
     action.WaitForFinish();
     auto result = action.GenerateResult();
 
+    m_TransferMonitor.FinishTransfer(id, result);
     m_TransferActions.erase(id);
     return result;
 }
@@ -305,6 +322,13 @@ bool VulkanEngine::HasBuffer(const ArgumentId& id)
     return ContainsKey(m_Buffers, id);
 }
 
+bool VulkanEngine::ComputeBlockChecksums([[maybe_unused]] const ArgumentId& id, [[maybe_unused]] const ArgumentDataType dataType,
+    [[maybe_unused]] const size_t elementCount, [[maybe_unused]] const size_t blockSize, [[maybe_unused]] const QueueId queueId,
+    [[maybe_unused]] std::vector<BlockChecksum>& checksums)
+{
+    return false;
+}
+
 QueueId VulkanEngine::AddComputeQueue([[maybe_unused]] ComputeQueue queue)
 {
     throw KttException("Support for compute queue addition is not yet available for Vulkan backend");
@@ -415,6 +439,22 @@ GlobalSizeType VulkanEngine::GetGlobalSizeType() const
     return m_Configuration.GetGlobalSizeType();
 }
 
+KernelCacheStatistics VulkanEngine::GetKernelCacheStatistics() const
+{
+    KernelCacheStatistics statistics;
+    statistics.m_HitCount = m_PipelineCache.GetHitCount();
+    statistics.m_MissCount = m_PipelineCache.GetMissCount();
+    statistics.m_EvictionCount = m_PipelineCache.GetEvictionCount();
+    statistics.m_EntryCount = static_cast<uint64_t>(m_PipelineCache.Size());
+    statistics.m_MemorySize = m_PipelineCache.GetMemorySize();
+    return statistics;
+}
+
+TransferStatistics VulkanEngine::GetTransferStatistics() const
+{
+    return m_TransferMonitor.GetStatistics();
+}
+
 void VulkanEngine::SetCompilerOptions(const std::string& options, [[maybe_unused]] const bool overrideDefault)
 {
     m_Configuration.SetCompilerOptions(options);
@@ -436,11 +476,39 @@ void VulkanEngine::SetKernelCacheCapacity(const uint64_t capacity)
     m_PipelineCache.SetMaxSize(static_cast<size_t>(capacity));
 }
 
+void VulkanEngine::SetKernelCacheMemoryLimit(const uint64_t limit)
+{
+    m_PipelineCache.SetMemoryLimit(limit);
+}
+
+void VulkanEngine::SetKernelCachePolicy(const KernelCachePolicy policy)
+{
+    m_PipelineCache.SetSegmented(policy == KernelCachePolicy::SegmentedLeastRecentlyUsed);
+}
+
 void VulkanEngine::ClearKernelCache()
 {
     m_PipelineCache.Clear();
 }
 
+void VulkanEngine::SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize)
+{
+    m_BinaryCache.SetDirectory(directory);
+    m_BinaryCache.SetMaximumSize(maximumSize);
+
+    std::vector<uint8_t> pipelineCacheData;
+    m_BinaryCache.Load(GetPipelineCacheKey(), pipelineCacheData);
+    m_DriverPipelineCache = std::make_unique<VulkanPipelineCache>(*m_Device, pipelineCacheData);
+}
+
+void VulkanEngine::SetStagingMemoryLimit(const uint64_t limit)
+{
+    if (limit > 0)
+    {
+        throw KttException("Staging buffer pool is not yet supported for Vulkan backend");
+    }
+}
+
 void VulkanEngine::EnsureThreadContext()
 {}
 
@@ -448,22 +516,67 @@ std::shared_ptr<VulkanComputePipeline> VulkanEngine::LoadPipeline(const KernelCo
 {
     const auto id = data.GetUniqueIdentifier();
 
-    if (m_PipelineCache.GetMaxSize() > 0 && m_PipelineCache.Exists(id))
+    if (m_PipelineCache.GetMaxSize() > 0)
     {
-        return m_PipelineCache.Get(id)->second;
+        const auto cachedItem = m_PipelineCache.Get(id);
+
+        if (cachedItem != m_PipelineCache.End())
+        {
+            return cachedItem->second;
+        }
     }
 
-    auto pipeline = std::make_shared<VulkanComputePipeline>(*m_Device, m_ComputeIdGenerator, *m_Compiler, data.GetName(),
-        data.GetDefaultSource(), data.GetLocalSize(), data.GetConfiguration(), *m_DescriptorPool, data.GetArguments());
+    auto pipeline = std::make_shared<VulkanComputePipeline>(*m_Device, m_ComputeIdGenerator, LoadShaderModule(data),
+        data.GetLocalSize(), *m_DescriptorPool, data.GetArguments(), m_DriverPipelineCache->GetCache());
+
+    if (m_BinaryCache.IsEnabled())
+    {
+        // Pipeline cache is stored after each creation, so that the driver compiled code survives abnormal termination
+        m_BinaryCache.Store(GetPipelineCacheKey(), m_DriverPipelineCache->GetData());
+    }
 
     if (m_PipelineCache.GetMaxSize() > 0)
     {
-        m_PipelineCache.Put(id, pipeline);
+        m_PipelineCache.Put(id, pipeline, pipeline->GetMemorySize());
     }
 
     return pipeline;
 }
 
+std::unique_ptr<VulkanShaderModule> VulkanEngine::LoadShaderModule(const KernelComputeData& data)
+{
+    if (!m_BinaryCache.IsEnabled())
+    {
+        return std::make_unique<VulkanShaderModule>(*m_Compiler, *m_Device, data.GetName(), data.GetDefaultSource(),
+            data.GetLocalSize(), data.GetConfiguration());
+    }
+
+    const std::string key = KernelBinaryCache::GenerateKey({data.GetSource(), data.GetLocalSize().GetString(),
+        m_Configuration.GetCompilerOptions(), m_DeviceInfo.GetName(), m_DriverVersion});
+    std::vector<uint8_t> binary;
+
+    if (m_BinaryCache.Load(key, binary) && binary.size() % sizeof(uint32_t) == 0)
+    {
+        std::vector<uint32_t> spirvSource(binary.size() / sizeof(uint32_t));
+        std::memcpy(spirvSource.data(), binary.data(), binary.size());
+        return std::make_unique<VulkanShaderModule>(*m_Device, data.GetName(), data.GetDefaultSource(), spirvSource);
+    }
+
+    auto shaderModule = std::make_unique<VulkanShaderModule>(*m_Compiler, *m_Device, data.GetName(), data.GetDefaultSource(),
+        data.GetLocalSize(), data.GetConfiguration());
+    const auto& spirvSource = shaderModule->GetSpirvSource();
+    binary.resize(spirvSource.size() * sizeof(uint32_t));
+    std::memcpy(binary.data(), spirvSource.data(), binary.size());
+    m_BinaryCache.Store(key, binary);
+
+    return shaderModule;
+}
+
+std::string VulkanEngine::GetPipelineCacheKey() const
+{
+    return KernelBinaryCache::GenerateKey({"VkPipelineCache", m_DeviceInfo.GetName(), m_DriverVersion});
+}
+
 VulkanBuffer* VulkanEngine::GetPipelineArgument(KernelArgument& argument)
 {
     switch (argument.GetMemoryType())
@@ -4,6 +4,7 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <Api/ComputeApiInitializer.h>
@@ -17,12 +18,15 @@
 #include <ComputeEngine/Vulkan/VulkanDevice.h>
 #include <ComputeEngine/Vulkan/VulkanInstance.h>
 #include <ComputeEngine/Vulkan/VulkanMemoryAllocator.h>
+#include <ComputeEngine/Vulkan/VulkanPipelineCache.h>
 #include <ComputeEngine/Vulkan/VulkanQueryPool.h>
 #include <ComputeEngine/Vulkan/VulkanQueue.h>
 #include <ComputeEngine/Cuda/CudaKernel.h>
 #include <ComputeEngine/Cuda/CudaStream.h>
 #include <ComputeEngine/ComputeEngine.h>
 #include <ComputeEngine/EngineConfiguration.h>
+#include <ComputeEngine/KernelBinaryCache.h>
+#include <ComputeEngine/TransferMonitor.h>
 #include <Utility/IdGenerator.h>
 #include <Utility/LruCache.h>
 
@@ -39,6 +43,8 @@ public:
     ComputationResult WaitForComputeAction(const ComputeActionId id) override;
     void ClearData(const KernelComputeId& id) override;
     void ClearKernelData(const std::string& kernelName) override;
+    void CompileKernelAsync(const KernelComputeData& data) override;
+    void PrecompileKernels(const std::vector<KernelComputeData>& data) override;
 
     // Profiling methods
     ComputationResult RunKernelWithProfiling(const KernelComputeData& data, const QueueId queueId) override;
@@ -65,6 +71,8 @@ public:
     void ClearBuffer(const ArgumentId& id) override;
     void ClearBuffers() override;
     bool HasBuffer(const ArgumentId& id) override;
+    bool ComputeBlockChecksums(const ArgumentId& id, const ArgumentDataType dataType, const size_t elementCount,
+        const size_t blockSize, const QueueId queueId, std::vector<BlockChecksum>& checksums) override;
 
     // Queue methods
     QueueId AddComputeQueue(ComputeQueue queue) override;
@@ -82,13 +90,19 @@ public:
     DeviceInfo GetCurrentDeviceInfo() const override;
     ComputeApi GetComputeApi() const override;
     GlobalSizeType GetGlobalSizeType() const override;
+    KernelCacheStatistics GetKernelCacheStatistics() const override;
+    TransferStatistics GetTransferStatistics() const override;
 
     // Utility methods
     void SetCompilerOptions(const std::string& options, const bool overrideDefault = false) override;
     void SetGlobalSizeType(const GlobalSizeType type) override;
     void SetAutomaticGlobalSizeCorrection(const bool flag) override;
     void SetKernelCacheCapacity(const uint64_t capacity) override;
+    void SetKernelCacheMemoryLimit(const uint64_t limit) override;
+    void SetKernelCachePolicy(const KernelCachePolicy policy) override;
     void ClearKernelCache() override;
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize) override;
+    void SetStagingMemoryLimit(const uint64_t limit) override;
     void EnsureThreadContext() override;
 
 private:
@@ -104,13 +118,19 @@ private:
     std::unique_ptr<VulkanQueryPool> m_QueryPool;
     std::unique_ptr<ShadercCompiler> m_Compiler;
     std::unique_ptr<VulkanMemoryAllocator> m_Allocator;
+    std::unique_ptr<VulkanPipelineCache> m_DriverPipelineCache;
     std::vector<std::unique_ptr<VulkanQueue>> m_Queues;
     std::map<ArgumentId, std::unique_ptr<VulkanBuffer>> m_Buffers;
+    TransferMonitor m_TransferMonitor;
     LruCache<KernelComputeId, std::shared_ptr<VulkanComputePipeline>> m_PipelineCache;
+    KernelBinaryCache m_BinaryCache;
+    std::string m_DriverVersion;
     std::map<ComputeActionId, std::unique_ptr<VulkanComputeAction>> m_ComputeActions;
     std::map<TransferActionId, std::unique_ptr<VulkanTransferAction>> m_TransferActions;
 
     std::shared_ptr<VulkanComputePipeline> LoadPipeline(const KernelComputeData& data);
+    std::unique_ptr<VulkanShaderModule> LoadShaderModule(const KernelComputeData& data);
+    std::string GetPipelineCacheKey() const;
     VulkanBuffer* GetPipelineArgument(KernelArgument& argument);
     std::vector<VulkanBuffer*> GetPipelineArguments(const std::vector<KernelArgument*>& arguments);
     std::unique_ptr<VulkanBuffer> CreateBuffer(KernelArgument& argument);
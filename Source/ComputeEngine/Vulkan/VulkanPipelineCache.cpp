@@ -0,0 +1,53 @@
+#ifdef KTT_API_VULKAN
+
+#include <ComputeEngine/Vulkan/VulkanDevice.h>
+#include <ComputeEngine/Vulkan/VulkanPipelineCache.h>
+#include <ComputeEngine/Vulkan/VulkanUtility.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+VulkanPipelineCache::VulkanPipelineCache(const VulkanDevice& device, const std::vector<uint8_t>& initialData) :
+    m_Device(device.GetDevice())
+{
+    Logger::LogDebug("Initializing Vulkan pipeline cache");
+
+    // Driver validates the cache header and ignores data created by incompatible device or driver
+    const VkPipelineCacheCreateInfo cacheInfo =
+    {
+        VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        nullptr,
+        0,
+        initialData.size(),
+        initialData.empty() ? nullptr : initialData.data()
+    };
+
+    CheckError(vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_Cache), "vkCreatePipelineCache");
+}
+
+VulkanPipelineCache::~VulkanPipelineCache()
+{
+    Logger::LogDebug("Releasing Vulkan pipeline cache");
+    vkDestroyPipelineCache(m_Device, m_Cache, nullptr);
+}
+
+VkPipelineCache VulkanPipelineCache::GetCache() const
+{
+    return m_Cache;
+}
+
+std::vector<uint8_t> VulkanPipelineCache::GetData() const
+{
+    size_t size = 0;
+    CheckError(vkGetPipelineCacheData(m_Device, m_Cache, &size, nullptr), "vkGetPipelineCacheData");
+
+    std::vector<uint8_t> data(size);
+    CheckError(vkGetPipelineCacheData(m_Device, m_Cache, &size, data.data()), "vkGetPipelineCacheData");
+    data.resize(size);
+    return data;
+}
+
+} // namespace ktt
+
+#endif // KTT_API_VULKAN
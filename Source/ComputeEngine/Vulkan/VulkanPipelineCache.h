@@ -0,0 +1,30 @@
+#pragma once
+
+#ifdef KTT_API_VULKAN
+
+#include <cstdint>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+namespace ktt
+{
+
+class VulkanDevice;
+
+class VulkanPipelineCache
+{
+public:
+    explicit VulkanPipelineCache(const VulkanDevice& device, const std::vector<uint8_t>& initialData = {});
+    ~VulkanPipelineCache();
+
+    VkPipelineCache GetCache() const;
+    std::vector<uint8_t> GetData() const;
+
+private:
+    VkDevice m_Device;
+    VkPipelineCache m_Cache;
+};
+
+} // namespace ktt
+
+#endif // KTT_API_VULKAN
@@ -16,17 +16,17 @@ VulkanShaderModule::VulkanShaderModule(const ShadercCompiler& compiler, const Vu
     m_Device(device.GetDevice())
 {
     m_SpirvSource = compiler.Compile(name, source, shaderc_compute_shader, localSize, configuration);
+    CreateModule();
+}
 
-    const VkShaderModuleCreateInfo createInfo =
-    {
-        VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-        nullptr,
-        0,
-        m_SpirvSource.size() * sizeof(uint32_t),
-        m_SpirvSource.data()
-    };
-
-    CheckError(vkCreateShaderModule(m_Device, &createInfo, nullptr, &m_Module), "vkCreateShaderModule");
+VulkanShaderModule::VulkanShaderModule(const VulkanDevice& device, const std::string& name, const std::string& source,
+    const std::vector<uint32_t>& spirvSource) :
+    m_Name(name),
+    m_Source(source),
+    m_SpirvSource(spirvSource),
+    m_Device(device.GetDevice())
+{
+    CreateModule();
 }
 
 VulkanShaderModule::~VulkanShaderModule()
@@ -44,11 +44,30 @@ const std::string& VulkanShaderModule::GetSource() const
     return m_Source;
 }
 
+const std::vector<uint32_t>& VulkanShaderModule::GetSpirvSource() const
+{
+    return m_SpirvSource;
+}
+
 VkShaderModule VulkanShaderModule::GetModule() const
 {
     return m_Module;
 }
 
+void VulkanShaderModule::CreateModule()
+{
+    const VkShaderModuleCreateInfo createInfo =
+    {
+        VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+        nullptr,
+        0,
+        m_SpirvSource.size() * sizeof(uint32_t),
+        m_SpirvSource.data()
+    };
+
+    CheckError(vkCreateShaderModule(m_Device, &createInfo, nullptr, &m_Module), "vkCreateShaderModule");
+}
+
 } // namespace ktt
 
 #endif // KTT_API_VULKAN
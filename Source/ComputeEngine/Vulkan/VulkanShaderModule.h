@@ -21,10 +21,13 @@ class VulkanShaderModule
 public:
     explicit VulkanShaderModule(const ShadercCompiler& compiler, const VulkanDevice& device, const std::string& name,
         const std::string& source, const DimensionVector& localSize, const KernelConfiguration& configuration);
+    explicit VulkanShaderModule(const VulkanDevice& device, const std::string& name, const std::string& source,
+        const std::vector<uint32_t>& spirvSource);
     ~VulkanShaderModule();
 
     const std::string& GetName() const;
     const std::string& GetSource() const;
+    const std::vector<uint32_t>& GetSpirvSource() const;
     VkShaderModule GetModule() const;
 
 private:
@@ -33,6 +36,8 @@ private:
     std::vector<uint32_t> m_SpirvSource;
     VkDevice m_Device;
     VkShaderModule m_Module;
+
+    void CreateModule();
 };
 
 } // namespace ktt
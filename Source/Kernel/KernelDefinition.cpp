@@ -25,6 +25,11 @@ void KernelDefinition::SetArguments(const std::vector<KernelArgument*>& argument
     m_Arguments = arguments;
 }
 
+void KernelDefinition::SetHostFunction(HostFunction function)
+{
+    m_HostFunction = function;
+}
+
 KernelDefinitionId KernelDefinition::GetId() const
 {
     return m_Id;
@@ -60,6 +65,11 @@ const std::vector<KernelArgument*>& KernelDefinition::GetArguments() const
     return m_Arguments;
 }
 
+const HostFunction& KernelDefinition::GetHostFunction() const
+{
+    return m_HostFunction;
+}
+
 std::vector<KernelArgument*> KernelDefinition::GetVectorArguments() const
 {
     return KernelArgument::GetArgumentsWithMemoryType(m_Arguments, ArgumentMemoryType::Vector);
@@ -17,6 +17,7 @@ public:
         const DimensionVector& globalSize, const DimensionVector& localSize, const std::vector<std::string>& typeNames = {});
 
     void SetArguments(const std::vector<KernelArgument*>& arguments);
+    void SetHostFunction(HostFunction function);
 
     KernelDefinitionId GetId() const;
     const std::string& GetName() const;
@@ -25,6 +26,7 @@ public:
     const DimensionVector& GetGlobalSize() const;
     const DimensionVector& GetLocalSize() const;
     const std::vector<KernelArgument*>& GetArguments() const;
+    const HostFunction& GetHostFunction() const;
     std::vector<KernelArgument*> GetVectorArguments() const;
     bool HasArgument(const ArgumentId& id) const;
 
@@ -38,6 +40,7 @@ private:
     DimensionVector m_GlobalSize;
     DimensionVector m_LocalSize;
     std::vector<KernelArgument*> m_Arguments;
+    HostFunction m_HostFunction;
 };
 
 } // namespace ktt
@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+
+#include <Api/KttException.h>
+#include <KernelRunner/BufferComparator.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/External/half.hpp>
+
+namespace ktt
+{
+
+using half_float::half;
+
+ComparisonSummary::ComparisonSummary() :
+    m_Valid(true),
+    m_ComparedCount(0),
+    m_MismatchIndex(std::numeric_limits<uint64_t>::max()),
+    m_MismatchResult(0.0),
+    m_MismatchReference(0.0),
+    m_WorstIndex(0),
+    m_WorstResult(0.0),
+    m_WorstReference(0.0),
+    m_WorstDifference(-1.0),
+    m_DifferenceSum(0.0),
+    m_Histogram{}
+{}
+
+void ComparisonSummary::Merge(const ComparisonSummary& other)
+{
+    m_Valid = m_Valid && other.m_Valid;
+    m_ComparedCount += other.m_ComparedCount;
+    m_DifferenceSum += other.m_DifferenceSum;
+
+    for (size_t i = 0; i < m_Histogram.size(); ++i)
+    {
+        m_Histogram[i] += other.m_Histogram[i];
+    }
+
+    if (IsWorseDifference(other.m_WorstDifference, m_WorstDifference))
+    {
+        m_WorstIndex = other.m_WorstIndex;
+        m_WorstResult = other.m_WorstResult;
+        m_WorstReference = other.m_WorstReference;
+        m_WorstDifference = other.m_WorstDifference;
+    }
+
+    if (other.HasMismatch() && other.m_MismatchIndex < m_MismatchIndex)
+    {
+        m_MismatchIndex = other.m_MismatchIndex;
+        m_MismatchResult = other.m_MismatchResult;
+        m_MismatchReference = other.m_MismatchReference;
+    }
+}
+
+bool ComparisonSummary::HasMismatch() const
+{
+    return m_MismatchIndex != std::numeric_limits<uint64_t>::max();
+}
+
+bool ComparisonSummary::IsWorseDifference(const double difference, const double current)
+{
+    if (std::isnan(difference))
+    {
+        return !std::isnan(current);
+    }
+
+    return difference > current;
+}
+
+std::string ComparisonSummary::GetHistogramString() const
+{
+    std::ostringstream stream;
+    stream << "0: " << m_Histogram[0];
+
+    for (size_t i = 1; i < m_HistogramEdges.size(); ++i)
+    {
+        stream << ", (" << m_HistogramEdges[i - 1] << ", " << m_HistogramEdges[i] << "]: " << m_Histogram[i];
+    }
+
+    stream << ", > " << m_HistogramEdges.back() << ": " << m_Histogram.back();
+    return stream.str();
+}
+
+BufferComparator::BufferComparator()
+{}
+
+std::vector<BlockChecksum> BufferComparator::ComputeChecksums(const void* data, const ArgumentDataType dataType,
+    const size_t range) const
+{
+    switch (dataType)
+    {
+    case ArgumentDataType::Char:
+        return ComputeChecksums(static_cast<const int8_t*>(data), range);
+    case ArgumentDataType::UnsignedChar:
+        return ComputeChecksums(static_cast<const uint8_t*>(data), range);
+    case ArgumentDataType::Short:
+        return ComputeChecksums(static_cast<const int16_t*>(data), range);
+    case ArgumentDataType::UnsignedShort:
+        return ComputeChecksums(static_cast<const uint16_t*>(data), range);
+    case ArgumentDataType::Int:
+        return ComputeChecksums(static_cast<const int32_t*>(data), range);
+    case ArgumentDataType::UnsignedInt:
+        return ComputeChecksums(static_cast<const uint32_t*>(data), range);
+    case ArgumentDataType::Long:
+        return ComputeChecksums(static_cast<const int64_t*>(data), range);
+    case ArgumentDataType::UnsignedLong:
+        return ComputeChecksums(static_cast<const uint64_t*>(data), range);
+    case ArgumentDataType::Half:
+        return ComputeChecksums(static_cast<const half*>(data), range);
+    case ArgumentDataType::Float:
+        return ComputeChecksums(static_cast<const float*>(data), range);
+    case ArgumentDataType::Double:
+        return ComputeChecksums(static_cast<const double*>(data), range);
+    case ArgumentDataType::Custom:
+        throw KttException("Checksums cannot be computed for kernel arguments with custom data type");
+    default:
+        KttError("Unhandled argument data type value");
+        return {};
+    }
+}
+
+std::vector<uint64_t> BufferComparator::GenerateSampleIndices(const size_t range, const size_t sampleCount)
+{
+    std::vector<uint64_t> indices;
+
+    if (range <= sampleCount + 2 * m_SampleEdgeCount)
+    {
+        for (uint64_t i = 0; i < range; ++i)
+        {
+            indices.push_back(i);
+        }
+
+        return indices;
+    }
+
+    // Buffer edges are always included, since they are the most common location of errors in boundary handling
+    for (uint64_t i = 0; i < m_SampleEdgeCount; ++i)
+    {
+        indices.push_back(i);
+        indices.push_back(range - m_SampleEdgeCount + i);
+    }
+
+    // Generator with fixed seed ensures that all configurations are validated on the same elements
+    std::mt19937_64 generator;
+    std::uniform_int_distribution<uint64_t> distribution(m_SampleEdgeCount, range - m_SampleEdgeCount - 1);
+
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        indices.push_back(distribution(generator));
+    }
+
+    // Sorted indices result in sequential memory access during comparison
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    return indices;
+}
+
+bool BufferComparator::MatchChecksums(const std::vector<BlockChecksum>& result, const std::vector<BlockChecksum>& reference,
+    const double toleranceThreshold)
+{
+    if (result.size() != reference.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        const auto& resultChecksum = result[i];
+        const auto& referenceChecksum = reference[i];
+
+        if (resultChecksum.m_ElementCount != referenceChecksum.m_ElementCount
+            || resultChecksum.m_IntegerSum != referenceChecksum.m_IntegerSum)
+        {
+            return false;
+        }
+
+        // If every element is within tolerance, sums cannot differ by more than the tolerance multiplied by element count,
+        // rounding error of the summation itself is bounded by the sums of absolute values
+        const auto count = static_cast<double>(resultChecksum.m_ElementCount);
+        const double roundingLimit = count * std::numeric_limits<double>::epsilon()
+            * (resultChecksum.m_AbsoluteSum + referenceChecksum.m_AbsoluteSum);
+        const double limit = count * toleranceThreshold + roundingLimit;
+
+        if (!(std::fabs(resultChecksum.m_Sum - referenceChecksum.m_Sum) <= limit))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+ctpl::thread_pool& BufferComparator::GetThreadPool() const
+{
+    if (m_ThreadPool == nullptr)
+    {
+        m_ThreadPool = std::make_unique<ctpl::thread_pool>();
+    }
+
+    return *m_ThreadPool;
+}
+
+void BufferComparator::AddToSum(std::atomic<double>& sum, const double value)
+{
+    double expected = sum.load();
+
+    while (!sum.compare_exchange_weak(expected, expected + value))
+    {}
+}
+
+void BufferComparator::LowerLimit(std::atomic<uint64_t>& limit, const uint64_t value)
+{
+    uint64_t expected = limit.load();
+
+    while (value < expected && !limit.compare_exchange_weak(expected, value))
+    {}
+}
+
+} // namespace ktt
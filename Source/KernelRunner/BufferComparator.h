@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctpl_stl.h>
+
+#include <ComputeEngine/BlockChecksum.h>
+#include <KernelArgument/ArgumentDataType.h>
+#include <KernelRunner/ValidationMethod.h>
+
+namespace ktt
+{
+
+struct ComparisonSummary
+{
+    ComparisonSummary();
+
+    void Merge(const ComparisonSummary& other);
+    bool HasMismatch() const;
+    std::string GetHistogramString() const;
+
+    // NaN differences are worse than any finite difference
+    static bool IsWorseDifference(const double difference, const double current);
+
+    inline static const std::array<double, 8> m_HistogramEdges = {0.0, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1.0};
+
+    bool m_Valid;
+    uint64_t m_ComparedCount;
+    uint64_t m_MismatchIndex;
+    double m_MismatchResult;
+    double m_MismatchReference;
+    uint64_t m_WorstIndex;
+    double m_WorstResult;
+    double m_WorstReference;
+    double m_WorstDifference;
+    double m_DifferenceSum;
+    std::array<uint64_t, m_HistogramEdges.size() + 1> m_Histogram;
+};
+
+class BufferComparator
+{
+public:
+    BufferComparator();
+
+    template <typename T>
+    ComparisonSummary Compare(const T* result, const T* reference, const size_t range, const ValidationMethod method,
+        const double toleranceThreshold) const;
+
+    template <typename T>
+    ComparisonSummary CompareSample(const T* result, const T* reference, const std::vector<uint64_t>& indices,
+        const double toleranceThreshold) const;
+
+    template <typename T>
+    std::vector<BlockChecksum> ComputeChecksums(const T* data, const size_t range) const;
+
+    std::vector<BlockChecksum> ComputeChecksums(const void* data, const ArgumentDataType dataType, const size_t range) const;
+
+    static std::vector<uint64_t> GenerateSampleIndices(const size_t range, const size_t sampleCount);
+    static bool MatchChecksums(const std::vector<BlockChecksum>& result, const std::vector<BlockChecksum>& reference,
+        const double toleranceThreshold);
+
+    // Smaller checksum blocks allow less accumulated tolerance per block, which makes detection of single wrong elements likelier
+    inline static const size_t m_ChecksumBlockSize = 1024;
+    inline static const size_t m_DefaultSampleCount = 1024;
+
+private:
+    mutable std::unique_ptr<ctpl::thread_pool> m_ThreadPool;
+
+    ctpl::thread_pool& GetThreadPool() const;
+
+    template <typename T, typename MismatchPredicate>
+    ComparisonSummary CompareParallel(const T* result, const T* reference, const size_t range, const bool sumLimited,
+        const double toleranceThreshold, MismatchPredicate isMismatch) const;
+
+    template <typename T, typename MismatchPredicate>
+    static void CompareChunk(const T* result, const T* reference, const size_t begin, const size_t end, const bool sumLimited,
+        const double toleranceThreshold, MismatchPredicate isMismatch, std::atomic<bool>& stop,
+        std::atomic<uint64_t>& mismatchLimit, std::atomic<double>& sum, ComparisonSummary& summary);
+
+    template <typename T, typename MismatchPredicate>
+    static void CompareBlock(const T* result, const T* reference, const size_t begin, const size_t end,
+        MismatchPredicate isMismatch, ComparisonSummary& summary);
+
+    template <typename T>
+    static void ComputeBlockChecksum(const T* data, const size_t begin, const size_t end, BlockChecksum& checksum);
+
+    static void AddToSum(std::atomic<double>& sum, const double value);
+    static void LowerLimit(std::atomic<uint64_t>& limit, const uint64_t value);
+
+    // Blocks are small enough to stay in cache and large enough for vectorized loops, chunks are distributed among threads
+    inline static const size_t m_BlockSize = 4096;
+    inline static const size_t m_ChunkSize = 1 << 20;
+
+    inline static const size_t m_SampleEdgeCount = 64;
+};
+
+} // namespace ktt
+
+#include <KernelRunner/BufferComparator.inl>
@@ -0,0 +1,387 @@
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <KernelRunner/BufferComparator.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/External/half.hpp>
+
+namespace ktt
+{
+
+template <typename T>
+inline constexpr bool IsFloatingPointValue = std::is_floating_point_v<T> || std::is_same_v<T, half_float::half>;
+
+// Single precision types are compared in single precision, which allows twice as many elements per vector instruction
+template <typename T>
+using ComparisonValueType = std::conditional_t<std::is_same_v<T, float> || std::is_same_v<T, half_float::half>, float, double>;
+
+template <typename T>
+ComparisonSummary BufferComparator::Compare(const T* result, const T* reference, const size_t range, const ValidationMethod method,
+    const double toleranceThreshold) const
+{
+    using ValueType = ComparisonValueType<T>;
+
+    if constexpr (!IsFloatingPointValue<T>)
+    {
+        return CompareParallel(result, reference, range, false, toleranceThreshold,
+            [](const T resultValue, const T referenceValue, const ValueType)
+        {
+            return resultValue != referenceValue;
+        });
+    }
+    else
+    {
+        const auto tolerance = static_cast<ValueType>(toleranceThreshold);
+
+        // Comparisons are written so that NaN differences are always reported as mismatches
+        switch (method)
+        {
+        case ValidationMethod::AbsoluteDifference:
+            return CompareParallel(result, reference, range, true, toleranceThreshold, [](const T, const T, const ValueType)
+            {
+                return false;
+            });
+        case ValidationMethod::SideBySideComparison:
+            return CompareParallel(result, reference, range, false, toleranceThreshold,
+                [tolerance](const T, const T, const ValueType difference)
+            {
+                return !(difference <= tolerance);
+            });
+        case ValidationMethod::SideBySideRelativeComparison:
+            return CompareParallel(result, reference, range, false, toleranceThreshold,
+                [tolerance](const T, const T referenceValue, const ValueType difference)
+            {
+                const auto minimumDifference = static_cast<ValueType>(1e-4);
+                const ValueType relativeTolerance = tolerance * std::fabs(static_cast<ValueType>(referenceValue));
+                return !(difference <= minimumDifference) && !(difference <= relativeTolerance);
+            });
+        default:
+            KttError("Unhandled validation method value");
+            return ComparisonSummary();
+        }
+    }
+}
+
+template <typename T>
+ComparisonSummary BufferComparator::CompareSample(const T* result, const T* reference, const std::vector<uint64_t>& indices,
+    const double toleranceThreshold) const
+{
+    using ValueType = ComparisonValueType<T>;
+    ComparisonSummary summary;
+
+    if (indices.empty())
+    {
+        return summary;
+    }
+
+    std::vector<T> resultSample;
+    std::vector<T> referenceSample;
+    resultSample.reserve(indices.size());
+    referenceSample.reserve(indices.size());
+
+    for (const auto index : indices)
+    {
+        resultSample.push_back(result[index]);
+        referenceSample.push_back(reference[index]);
+    }
+
+    if constexpr (!IsFloatingPointValue<T>)
+    {
+        CompareBlock(resultSample.data(), referenceSample.data(), 0, indices.size(),
+            [](const T resultValue, const T referenceValue, const ValueType)
+        {
+            return resultValue != referenceValue;
+        }, summary);
+    }
+    else
+    {
+        const auto tolerance = static_cast<ValueType>(toleranceThreshold);
+
+        CompareBlock(resultSample.data(), referenceSample.data(), 0, indices.size(),
+            [tolerance](const T, const T, const ValueType difference)
+        {
+            return !(difference <= tolerance);
+        }, summary);
+    }
+
+    // Positions inside the gathered sample are translated back to positions inside the buffer
+    summary.m_WorstIndex = indices[summary.m_WorstIndex];
+
+    if (summary.HasMismatch())
+    {
+        summary.m_MismatchIndex = indices[summary.m_MismatchIndex];
+    }
+
+    return summary;
+}
+
+template <typename T>
+std::vector<BlockChecksum> BufferComparator::ComputeChecksums(const T* data, const size_t range) const
+{
+    const size_t blockCount = (range + m_ChecksumBlockSize - 1) / m_ChecksumBlockSize;
+    const size_t blocksPerChunk = m_ChunkSize / m_ChecksumBlockSize;
+    const size_t chunkCount = (blockCount + blocksPerChunk - 1) / blocksPerChunk;
+    std::vector<BlockChecksum> checksums(blockCount);
+
+    const auto computeChunk = [&](const size_t chunk)
+    {
+        const size_t lastBlock = std::min((chunk + 1) * blocksPerChunk, blockCount);
+
+        for (size_t block = chunk * blocksPerChunk; block < lastBlock; ++block)
+        {
+            const size_t begin = block * m_ChecksumBlockSize;
+            ComputeBlockChecksum(data, begin, std::min(begin + m_ChecksumBlockSize, range), checksums[block]);
+        }
+    };
+
+    if (chunkCount <= 1)
+    {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            computeChunk(chunk);
+        }
+
+        return checksums;
+    }
+
+    std::vector<std::future<void>> futures;
+
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        futures.push_back(GetThreadPool().push([&computeChunk, chunk]()
+        {
+            computeChunk(chunk);
+        }));
+    }
+
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+
+    return checksums;
+}
+
+template <typename T, typename MismatchPredicate>
+ComparisonSummary BufferComparator::CompareParallel(const T* result, const T* reference, const size_t range, const bool sumLimited,
+    const double toleranceThreshold, MismatchPredicate isMismatch) const
+{
+    ComparisonSummary summary;
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> mismatchLimit(std::numeric_limits<uint64_t>::max());
+    std::atomic<double> sum(0.0);
+    const size_t chunkCount = (range + m_ChunkSize - 1) / m_ChunkSize;
+
+    const size_t workerCount = chunkCount > 1 ? std::min(GetThreadPool().size(), chunkCount) : 1;
+
+    if (workerCount <= 1)
+    {
+        CompareChunk(result, reference, 0, range, sumLimited, toleranceThreshold, isMismatch, stop, mismatchLimit, sum, summary);
+    }
+    else
+    {
+        std::vector<ComparisonSummary> summaries(workerCount);
+        std::vector<std::future<void>> futures;
+        std::atomic<size_t> nextChunk(0);
+
+        for (size_t worker = 0; worker < workerCount; ++worker)
+        {
+            futures.push_back(GetThreadPool().push([&, worker]()
+            {
+                // Chunks are assigned dynamically in increasing order, so that threads which finish early continue with the
+                // remaining chunks and chunks located after a known mismatch are skipped
+                for (size_t chunk = nextChunk++; chunk < chunkCount && !stop; chunk = nextChunk++)
+                {
+                    const size_t begin = chunk * m_ChunkSize;
+
+                    if (begin >= mismatchLimit)
+                    {
+                        break;
+                    }
+
+                    const size_t end = std::min(begin + m_ChunkSize, range);
+                    CompareChunk(result, reference, begin, end, sumLimited, toleranceThreshold, isMismatch, stop, mismatchLimit,
+                        sum, summaries[worker]);
+                }
+            }));
+        }
+
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+
+        for (const auto& partialSummary : summaries)
+        {
+            summary.Merge(partialSummary);
+        }
+    }
+
+    if (sumLimited)
+    {
+        summary.m_Valid = summary.m_DifferenceSum <= toleranceThreshold;
+    }
+
+    return summary;
+}
+
+template <typename T, typename MismatchPredicate>
+void BufferComparator::CompareChunk(const T* result, const T* reference, const size_t begin, const size_t end, const bool sumLimited,
+    const double toleranceThreshold, MismatchPredicate isMismatch, std::atomic<bool>& stop, std::atomic<uint64_t>& mismatchLimit,
+    std::atomic<double>& sum, ComparisonSummary& summary)
+{
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += m_BlockSize)
+    {
+        // Blocks preceding a mismatch found by another thread are still compared, so that the first mismatch is reported
+        if (stop.load(std::memory_order_relaxed) || blockBegin >= mismatchLimit.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const size_t blockEnd = std::min(blockBegin + m_BlockSize, end);
+        const double previousSum = summary.m_DifferenceSum;
+        CompareBlock(result, reference, blockBegin, blockEnd, isMismatch, summary);
+
+        if (summary.HasMismatch())
+        {
+            LowerLimit(mismatchLimit, summary.m_MismatchIndex);
+            return;
+        }
+
+        if (sumLimited)
+        {
+            // Sum of absolute differences only grows, validation fails as soon as a partial sum exceeds the threshold
+            AddToSum(sum, summary.m_DifferenceSum - previousSum);
+
+            if (!(sum.load() <= toleranceThreshold))
+            {
+                stop = true;
+                return;
+            }
+        }
+    }
+}
+
+template <typename T, typename MismatchPredicate>
+void BufferComparator::CompareBlock(const T* result, const T* reference, const size_t begin, const size_t end,
+    MismatchPredicate isMismatch, ComparisonSummary& summary)
+{
+    using ValueType = ComparisonValueType<T>;
+    constexpr size_t edgeCount = ComparisonSummary::m_HistogramEdges.size();
+
+    std::array<ValueType, edgeCount> edges;
+    std::array<uint64_t, edgeCount> exceededCounts{};
+
+    for (size_t k = 0; k < edgeCount; ++k)
+    {
+        edges[k] = static_cast<ValueType>(ComparisonSummary::m_HistogramEdges[k]);
+    }
+
+    ValueType maxDifference = 0;
+    double differenceSum = 0.0;
+    uint64_t mismatchCount = 0;
+    uint64_t nanCount = 0;
+
+    // The loop does not contain data-dependent branches, so that it can be vectorized by the compiler, NaN differences are
+    // counted separately since they are ignored by maximum and histogram comparisons
+    for (size_t i = begin; i < end; ++i)
+    {
+        const ValueType difference = std::fabs(static_cast<ValueType>(result[i]) - static_cast<ValueType>(reference[i]));
+        const bool isNan = difference != difference;
+        maxDifference = std::max(maxDifference, difference);
+        differenceSum += static_cast<double>(difference);
+        nanCount += static_cast<uint64_t>(isNan);
+        mismatchCount += static_cast<uint64_t>(isMismatch(result[i], reference[i], difference) | isNan);
+
+        for (size_t k = 0; k < edgeCount; ++k)
+        {
+            exceededCounts[k] += static_cast<uint64_t>(difference > edges[k]);
+        }
+    }
+
+    const auto elementCount = static_cast<uint64_t>(end - begin);
+    summary.m_ComparedCount += elementCount;
+    summary.m_DifferenceSum += differenceSum;
+    summary.m_Histogram[0] += elementCount - exceededCounts[0] - nanCount;
+
+    for (size_t k = 1; k < edgeCount; ++k)
+    {
+        summary.m_Histogram[k] += exceededCounts[k - 1] - exceededCounts[k];
+    }
+
+    summary.m_Histogram[edgeCount] += exceededCounts[edgeCount - 1] + nanCount;
+
+    if (nanCount > 0)
+    {
+        maxDifference = std::numeric_limits<ValueType>::quiet_NaN();
+    }
+
+    // Exact positions are searched for only in the rare blocks which contain new worst element or the first mismatch
+    if (ComparisonSummary::IsWorseDifference(static_cast<double>(maxDifference), summary.m_WorstDifference))
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const ValueType difference = std::fabs(static_cast<ValueType>(result[i]) - static_cast<ValueType>(reference[i]));
+
+            if (difference == maxDifference || (nanCount > 0 && difference != difference))
+            {
+                summary.m_WorstIndex = static_cast<uint64_t>(i);
+                summary.m_WorstResult = static_cast<double>(result[i]);
+                summary.m_WorstReference = static_cast<double>(reference[i]);
+                summary.m_WorstDifference = static_cast<double>(difference);
+                break;
+            }
+        }
+    }
+
+    if (mismatchCount == 0 || summary.HasMismatch())
+    {
+        return;
+    }
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const ValueType difference = std::fabs(static_cast<ValueType>(result[i]) - static_cast<ValueType>(reference[i]));
+
+        if (isMismatch(result[i], reference[i], difference) || difference != difference)
+        {
+            summary.m_Valid = false;
+            summary.m_MismatchIndex = static_cast<uint64_t>(i);
+            summary.m_MismatchResult = static_cast<double>(result[i]);
+            summary.m_MismatchReference = static_cast<double>(reference[i]);
+            break;
+        }
+    }
+}
+
+template <typename T>
+void BufferComparator::ComputeBlockChecksum(const T* data, const size_t begin, const size_t end, BlockChecksum& checksum)
+{
+    double sum = 0.0;
+    double absoluteSum = 0.0;
+    uint64_t integerSum = 0;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const auto value = static_cast<double>(data[i]);
+        sum += value;
+        absoluteSum += std::fabs(value);
+
+        if constexpr (!IsFloatingPointValue<T>)
+        {
+            // Odd position weights make the sum sensitive to swapped elements, while any single changed element is still detected
+            integerSum += static_cast<uint64_t>(data[i]) * static_cast<uint64_t>(2 * (i - begin) + 1);
+        }
+    }
+
+    checksum.m_ElementCount = static_cast<uint64_t>(end - begin);
+    checksum.m_Sum = sum;
+    checksum.m_AbsoluteSum = absoluteSum;
+    checksum.m_IntegerSum = integerSum;
+}
+
+} // namespace ktt
@@ -8,9 +8,10 @@
 namespace ktt
 {
 
-ComputeLayer::ComputeLayer(ComputeEngine& engine, KernelArgumentManager& argumentManager) :
+ComputeLayer::ComputeLayer(ComputeEngine& engine, KernelArgumentManager& argumentManager, const TimerCalibration& calibration) :
     m_ComputeEngine(engine),
     m_ArgumentManager(argumentManager),
+    m_Calibration(calibration),
     m_ActiveKernel(InvalidKernelId)
 {}
 
@@ -333,7 +334,7 @@ void ComputeLayer::ClearComputeEngineData()
 void ComputeLayer::AddData(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
     const KernelRunMode mode)
 {
-    m_Data[kernel.GetId()] = std::make_unique<ComputeLayerData>(kernel, configuration, dimensions, mode);
+    m_Data[kernel.GetId()] = std::make_unique<ComputeLayerData>(kernel, configuration, dimensions, mode, m_Calibration);
 }
 
 void ComputeLayer::ClearData(const KernelId id)
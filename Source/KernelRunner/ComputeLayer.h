@@ -8,6 +8,7 @@
 #include <ComputeEngine/ComputeEngine.h>
 #include <KernelArgument/KernelArgumentManager.h>
 #include <KernelRunner/ComputeLayerData.h>
+#include <Utility/Timer/TimerCalibration.h>
 #include <KttTypes.h>
 
 namespace ktt
@@ -19,7 +20,7 @@ class KernelConfiguration;
 class ComputeLayer : public ComputeInterface
 {
 public:
-    explicit ComputeLayer(ComputeEngine& engine, KernelArgumentManager& argumentManager);
+    explicit ComputeLayer(ComputeEngine& engine, KernelArgumentManager& argumentManager, const TimerCalibration& calibration);
 
     void RunKernel(const KernelDefinitionId id) override;
     void RunKernel(const KernelDefinitionId id, const DimensionVector& globalSize, const DimensionVector& localSize) override;
@@ -82,6 +83,7 @@ private:
     std::map<KernelId, std::unique_ptr<ComputeLayerData>> m_Data;
     ComputeEngine& m_ComputeEngine;
     KernelArgumentManager& m_ArgumentManager;
+    const TimerCalibration& m_Calibration;
     KernelId m_ActiveKernel;
 
     const ComputeLayerData& GetData() const;
@@ -1,19 +1,21 @@
+#include <algorithm>
 #include <string>
 
 #include <Api/KttException.h>
 #include <KernelRunner/ComputeLayerData.h>
 #include <Utility/StlHelpers.h>
-#include <Utility/ErrorHandling/Assert.h>
 
 namespace ktt
 {
 
 ComputeLayerData::ComputeLayerData(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
-    const KernelRunMode runMode) :
+    const KernelRunMode runMode, const TimerCalibration& calibration) :
     m_Kernel(kernel),
     m_Configuration(configuration),
+    m_Calibration(calibration),
     m_RunMode(runMode),
-    m_DataOverhead(0)
+    m_DataOverhead(0),
+    m_CalibrationBias(0)
 {
     for (const auto* definition : kernel.GetDefinitions())
     {
@@ -29,7 +31,14 @@ void ComputeLayerData::IncreaseOverhead(const Nanoseconds overhead)
 
 void ComputeLayerData::AddPartialResult(const ComputationResult& result)
 {
-    m_PartialResults.push_back(result);
+    const Nanoseconds duration = m_Calibration.CorrectKernelDuration(result.GetDuration());
+
+    // Bias removed from the duration still elapsed inside the launcher, it is needed to reconstruct the raw duration
+    m_CalibrationBias += result.GetDuration() - duration;
+
+    ComputationResult correctedResult(result);
+    correctedResult.SetDurationData(duration, result.GetOverhead(), result.GetCompilationOverhead());
+    m_PartialResults.push_back(correctedResult);
 }
 
 void ComputeLayerData::AddArgumentOverride(const ArgumentId& id, const KernelArgument& argument)
@@ -125,9 +134,11 @@ KernelResult ComputeLayerData::GenerateResult(const Nanoseconds launcherDuration
 {
     KernelResult result(m_Kernel.GetName(), m_Configuration, m_PartialResults);
     const Nanoseconds launcherOverhead = CalculateLauncherOverhead();
-    KttAssert(launcherDuration >= launcherOverhead, "Launcher overhead must be lower than its total duration");
-    const Nanoseconds actualLauncherDuration = launcherDuration - launcherOverhead;
-    
+    // Replayed kernel runs without virtual clock report longer durations than the launcher really took
+    const Nanoseconds measuredLauncherDuration = launcherDuration - std::min(launcherDuration, launcherOverhead);
+    const Nanoseconds actualLauncherDuration = m_Calibration.CorrectHostDuration(measuredLauncherDuration);
+    result.SetCalibrationOverhead(m_CalibrationBias + measuredLauncherDuration - actualLauncherDuration);
+
     if (m_Kernel.HasLauncher())
     {
         result.SetExtraDuration(actualLauncherDuration);
@@ -144,7 +155,8 @@ KernelResult ComputeLayerData::GenerateResult(const Nanoseconds launcherDuration
 
 Nanoseconds ComputeLayerData::CalculateLauncherOverhead() const
 {
-    Nanoseconds result = m_DataOverhead;
+    // Partial durations are counted before calibration, since the launcher measured them including the bias
+    Nanoseconds result = m_DataOverhead + m_CalibrationBias;
 
     for (const auto& partialResult : m_PartialResults)
     {
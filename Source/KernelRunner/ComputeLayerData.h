@@ -10,6 +10,7 @@
 #include <Kernel/Kernel.h>
 #include <KernelArgument/KernelArgument.h>
 #include <KernelRunner/KernelRunMode.h>
+#include <Utility/Timer/TimerCalibration.h>
 #include <KttTypes.h>
 
 namespace ktt
@@ -19,7 +20,7 @@ class ComputeLayerData
 {
 public:
     explicit ComputeLayerData(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
-        const KernelRunMode runMode);
+        const KernelRunMode runMode, const TimerCalibration& calibration);
 
     void IncreaseOverhead(const Nanoseconds overhead);
     void IncreaseCompilationOverhead(const Nanoseconds overhead);
@@ -41,9 +42,11 @@ private:
     std::vector<ComputationResult> m_PartialResults;
     const Kernel& m_Kernel;
     const KernelConfiguration& m_Configuration;
+    const TimerCalibration& m_Calibration;
     KernelRunMode m_RunMode;
     Nanoseconds m_DataOverhead;
     Nanoseconds m_CompilationOverhead;
+    Nanoseconds m_CalibrationBias;
 
     Nanoseconds CalculateLauncherOverhead() const;
 };
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <iterator>
 #include <string>
 
 #include <Api/KttException.h>
@@ -5,6 +7,7 @@
 #include <KernelRunner/KernelRunner.h>
 #include <Output/TimeConfiguration/TimeConfiguration.h>
 #include <Utility/Logger/Logger.h>
+#include <Utility/StlHelpers.h>
 #include <Utility/Timer/ScopeTimer.h>
 #include <Utility/Timer/Timer.h>
 
@@ -12,18 +15,41 @@ namespace ktt
 {
 
 KernelRunner::KernelRunner(ComputeEngine& engine, KernelArgumentManager& argumentManager) :
-    m_ComputeLayer(std::make_unique<ComputeLayer>(engine, argumentManager)),
+    m_ComputeLayer(std::make_unique<ComputeLayer>(engine, argumentManager, m_Calibration)),
     m_Validator(std::make_unique<ResultValidator>(*this)),
     m_Engine(engine),
     m_ArgumentManager(argumentManager),
-    m_ReadOnlyCacheFlag(true)
+    m_ReadOnlyCacheFlag(true),
+    m_SnapshotFlag(false)
     //m_ProfilingFlag(false)
 {}
 
+KernelRunner::~KernelRunner()
+{
+    WaitForOutputs();
+
+    // Compute engine buffers reference the snapshot arguments, so they have to be released first
+    SetReadWriteArgumentSnapshot(false);
+}
+
 KernelResult KernelRunner::RunKernel(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
     const KernelRunMode mode, const std::vector<BufferOutputDescriptor>& output, const bool manageBuffers)
+{
+    return RunKernelPrivate(kernel, configuration, dimensions, mode, output, manageBuffers, false, nullptr);
+}
+
+KernelResult KernelRunner::RunKernelAsync(const Kernel& kernel, const KernelConfiguration& configuration,
+    const KernelDimensions& dimensions, const std::vector<BufferOutputDescriptor>& output, OutputCallback callback)
+{
+    return RunKernelPrivate(kernel, configuration, dimensions, KernelRunMode::Running, output, true, true, callback);
+}
+
+KernelResult KernelRunner::RunKernelPrivate(const Kernel& kernel, const KernelConfiguration& configuration,
+    const KernelDimensions& dimensions, const KernelRunMode mode, const std::vector<BufferOutputDescriptor>& output,
+    const bool manageBuffers, const bool asyncOutput, OutputCallback callback)
 {
     m_Engine.EnsureThreadContext();
+    WaitForOutputs(kernel);
 
     if (!m_Validator->HasReferenceResult(kernel))
     {
@@ -45,7 +71,37 @@ KernelResult KernelRunner::RunKernel(const Kernel& kernel, const KernelConfigura
     else
         Logger::LogInfo("Running kernel " + kernel.GetName() + " with configuration: " + configuration.GetString());
     auto launcher = GetKernelLauncher(kernel);
-    KernelResult result = RunKernelInternal(kernel, configuration, dimensions, mode, launcher, output);
+    KernelResult result = IsRepeatedMeasurementEnabled(mode)
+        ? RunKernelRepeatedly(kernel, configuration, dimensions, mode, launcher, manageBuffers)
+        : RunKernelInternal(kernel, configuration, dimensions, mode, launcher);
+
+    if (asyncOutput && !output.empty())
+    {
+        // Downloads are only issued here, they proceed while the result is validated and until a kernel run which overwrites
+        // the downloaded buffers
+        PendingOutput pending;
+
+        dataOverhead += RunScopeTimer([this, &output, &pending]()
+        {
+            pending.m_Actions = DownloadBuffersAsync(output);
+        });
+
+        for (const auto& descriptor : output)
+        {
+            pending.m_Arguments.insert(descriptor.GetArgumentId());
+        }
+
+        pending.m_Callback = callback;
+        m_PendingOutputs.push_back(std::move(pending));
+    }
+    else
+    {
+        dataOverhead += RunScopeTimer([this, &output]()
+        {
+            DownloadBuffers(output);
+        });
+    }
+
     ValidateResult(kernel, result, mode);
 
     if (manageBuffers)
@@ -57,11 +113,53 @@ KernelResult KernelRunner::RunKernel(const Kernel& kernel, const KernelConfigura
     }
 
     result.SetDataMovementOverhead(result.GetDataMovementOverhead() + dataOverhead);
+
+    if (asyncOutput && !output.empty())
+    {
+        m_PendingOutputs.back().m_Result = result;
+    }
+    else if (asyncOutput && callback)
+    {
+        callback(result);
+    }
+
     return result;
 }
 
+void KernelRunner::CompileKernelsAsync(const Kernel& kernel, const std::vector<KernelConfiguration>& configurations,
+    const KernelDimensions& dimensions)
+{
+    m_Engine.EnsureThreadContext();
+
+    for (const auto& configuration : configurations)
+    {
+        for (const auto* definition : kernel.GetDefinitions())
+        {
+            const KernelComputeData data(kernel, *definition, configuration, dimensions);
+            m_Engine.CompileKernelAsync(data);
+        }
+    }
+}
+
+void KernelRunner::PrecompileKernels(const Kernel& kernel, const std::vector<KernelConfiguration>& configurations)
+{
+    m_Engine.EnsureThreadContext();
+    std::vector<KernelComputeData> data;
+
+    for (const auto& configuration : configurations)
+    {
+        for (const auto* definition : kernel.GetDefinitions())
+        {
+            data.emplace_back(kernel, *definition, configuration, KernelDimensions{});
+        }
+    }
+
+    m_Engine.PrecompileKernels(data);
+}
+
 void KernelRunner::SetupBuffers(const Kernel& kernel)
 {
+    WaitForOutputs(kernel);
     const auto vectorArguments = kernel.GetVectorArguments();
 
     for (auto* argument : vectorArguments)
@@ -84,6 +182,12 @@ void KernelRunner::SetupBuffers(const Kernel& kernel)
             continue;
         }
 
+        if (IsSnapshotUsed(*argument))
+        {
+            RestoreArgument(*argument);
+            continue;
+        }
+
         const auto actionId = m_Engine.UploadArgument(*argument, m_ComputeLayer->GetDefaultQueue());
         m_Engine.WaitForTransferAction(actionId);
     }
@@ -107,6 +211,24 @@ void KernelRunner::CleanupBuffers(const Kernel& kernel)
             continue;
         }
 
+        // Buffer is kept and restored from snapshot before the next run
+        if (IsSnapshotUsed(*argument))
+        {
+            continue;
+        }
+
+        const auto pending = std::find_if(m_PendingOutputs.rbegin(), m_PendingOutputs.rend(), [&id](const auto& output)
+        {
+            return ContainsKey(output.m_Arguments, id);
+        });
+
+        if (pending != m_PendingOutputs.rend())
+        {
+            // Buffer is still being downloaded, it is released once the download finishes
+            pending->m_DeferredBuffers.push_back(id);
+            continue;
+        }
+
         m_Engine.ClearBuffer(id);
     }
 }
@@ -114,20 +236,70 @@ void KernelRunner::CleanupBuffers(const Kernel& kernel)
 void KernelRunner::DownloadBuffers(const std::vector<BufferOutputDescriptor>& output)
 {
     m_Engine.EnsureThreadContext();
+    std::vector<TransferActionId> actions;
 
+    // All downloads are issued before waiting, so that transfers of multiple buffers overlap
     for (const auto& descriptor : output)
     {
-        const auto id = m_Engine.DownloadArgument(descriptor.GetArgumentId(), m_Engine.GetDefaultQueue(),
-            descriptor.GetOutputDestination(), descriptor.GetOutputSize());
+        actions.push_back(m_Engine.DownloadArgument(descriptor.GetArgumentId(), m_Engine.GetDefaultQueue(),
+            descriptor.GetOutputDestination(), descriptor.GetOutputSize()));
+    }
+
+    for (const auto id : actions)
+    {
         m_Engine.WaitForTransferAction(id);
     }
 }
 
+bool KernelRunner::ComputeBlockChecksums(const KernelArgument& argument, const size_t range, const size_t blockSize,
+    std::vector<BlockChecksum>& checksums)
+{
+    m_Engine.EnsureThreadContext();
+    return m_Engine.ComputeBlockChecksums(argument.GetId(), argument.GetDataType(), range, blockSize, m_Engine.GetDefaultQueue(),
+        checksums);
+}
+
+void KernelRunner::WaitForOutputs()
+{
+    FinishPendingOutputs(m_PendingOutputs.size());
+}
+
 void KernelRunner::SetReadOnlyArgumentCache(const bool flag)
 {
     m_ReadOnlyCacheFlag = flag;
 }
 
+void KernelRunner::SetReadWriteArgumentSnapshot(const bool flag)
+{
+    if (flag && m_Engine.GetComputeApi() == ComputeApi::Vulkan)
+    {
+        throw KttException("Support for argument snapshots is not yet available for Vulkan backend");
+    }
+
+    if (!flag)
+    {
+        while (!m_Snapshots.empty())
+        {
+            ClearArgumentSnapshot(m_Snapshots.cbegin()->first);
+        }
+    }
+
+    m_SnapshotFlag = flag;
+}
+
+void KernelRunner::ClearArgumentSnapshot(const ArgumentId& id)
+{
+    if (!ContainsKey(m_Snapshots, id))
+    {
+        return;
+    }
+
+    // Working buffer is no longer released after runs, it has to be released together with the snapshot
+    m_Engine.ClearBuffer(id);
+    m_Engine.ClearBuffer(id + m_SnapshotIdSuffix);
+    m_Snapshots.erase(id);
+}
+
 void KernelRunner::SetProfiling(const bool flag)
 {
     //m_ProfilingFlag = flag;
@@ -140,6 +312,75 @@ bool KernelRunner::IsProfilingActive() const
     return m_Engine.IsProfilingActive();
 }
 
+void KernelRunner::SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+    const double targetRelativeWidth)
+{
+    m_MeasurementPolicy.SetRepetitions(warmupRuns, minimumRuns, maximumRuns, targetRelativeWidth);
+}
+
+void KernelRunner::SetRacing(const bool flag, const uint64_t minimumRuns)
+{
+    m_MeasurementPolicy.SetRacing(flag, minimumRuns);
+}
+
+void KernelRunner::SetRacingIncumbent(const std::optional<MeasurementStatistics>& statistics)
+{
+    m_RacingIncumbent = statistics;
+}
+
+void KernelRunner::CalibrateTimer(const Kernel& kernel)
+{
+    m_Engine.EnsureThreadContext();
+    WaitForOutputs();
+    m_Calibration.Reset();
+
+    const auto definitionId = kernel.GetPrimaryDefinition().GetId();
+    const KernelConfiguration configuration;
+    std::vector<Nanoseconds> durations;
+    std::vector<Nanoseconds> overheads;
+
+    const KernelLauncher launcher = [definitionId](ComputeInterface& interface)
+    {
+        interface.RunKernel(definitionId);
+    };
+
+    // The first run includes kernel compilation and initialization of compute API, so it is not used
+    for (uint64_t i = 0; i <= m_CalibrationRunCount; ++i)
+    {
+        const KernelResult result = RunKernelInternal(kernel, configuration, {}, KernelRunMode::Running, launcher);
+
+        if (!result.IsValid())
+        {
+            throw KttException("Timer calibration failed because the calibration kernel could not be run");
+        }
+
+        if (i > 0)
+        {
+            durations.push_back(result.GetKernelDuration());
+            overheads.push_back(result.GetKernelOverhead());
+        }
+    }
+
+    // Minimum empty kernel duration is used, so that the correction never exceeds the actual timing bias
+    const Nanoseconds eventOverhead = *std::min_element(durations.cbegin(), durations.cend());
+    const Nanoseconds launchOverhead = overheads[MeasurementPolicy::GetMedianIndex(overheads)];
+
+    m_Calibration.MeasureHostTimer();
+    m_Calibration.SetEventTimingOverhead(eventOverhead);
+    m_Calibration.SetLaunchOverhead(launchOverhead);
+    m_Calibration.SetValid(true);
+
+    const auto& time = TimeConfiguration::GetInstance();
+    Logger::LogInfo("Timer calibration finished, empty kernel duration is " + std::to_string(time.ConvertFromNanoseconds(eventOverhead))
+        + time.GetUnitTag() + ", launch overhead is " + std::to_string(time.ConvertFromNanoseconds(launchOverhead))
+        + time.GetUnitTag() + ", host timer overhead is " + std::to_string(m_Calibration.GetTimerOverhead()) + "ns");
+}
+
+const TimerCalibration& KernelRunner::GetTimerCalibration() const
+{
+    return m_Calibration;
+}
+
 void KernelRunner::SetValidationMethod(const ValidationMethod method, const double toleranceThreshold)
 {
     m_Validator->SetValidationMethod(method, toleranceThreshold);
@@ -150,6 +391,16 @@ void KernelRunner::SetValidationMode(const ValidationMode mode)
     m_Validator->SetValidationMode(mode);
 }
 
+void KernelRunner::SetValidationSampleCount(const size_t count)
+{
+    m_Validator->SetValidationSampleCount(count);
+}
+
+void KernelRunner::SetReferenceResultCache(const std::string& directory, const std::string& version)
+{
+    m_Validator->SetReferenceResultCache(directory, version);
+}
+
 void KernelRunner::SetValidationRange(const ArgumentId& id, const size_t range)
 {
     PrepareValidationData(id);
@@ -230,9 +481,68 @@ KernelLauncher KernelRunner::GetKernelLauncher(const Kernel& kernel)
     return result;
 }
 
+void KernelRunner::WaitForOutputs(const Kernel& kernel)
+{
+    size_t count = 0;
+
+    // Downloads of buffers which are not overwritten by the kernel keep running, earlier downloads are finished as well, so that
+    // callbacks are invoked in the order of runs
+    for (size_t i = 0; i < m_PendingOutputs.size(); ++i)
+    {
+        const auto& arguments = m_PendingOutputs[i].m_Arguments;
+
+        for (const auto* argument : kernel.GetVectorArguments())
+        {
+            if (ContainsKey(arguments, argument->GetId()) && IsArgumentOverwritten(*argument))
+            {
+                count = i + 1;
+                break;
+            }
+        }
+    }
+
+    FinishPendingOutputs(count);
+}
+
+void KernelRunner::FinishPendingOutputs(const size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    m_Engine.EnsureThreadContext();
+    std::vector<PendingOutput> finished(std::make_move_iterator(m_PendingOutputs.begin()),
+        std::make_move_iterator(m_PendingOutputs.begin() + count));
+    m_PendingOutputs.erase(m_PendingOutputs.begin(), m_PendingOutputs.begin() + count);
+
+    for (auto& pending : finished)
+    {
+        for (const auto id : pending.m_Actions)
+        {
+            m_Engine.WaitForTransferAction(id);
+        }
+
+        for (const auto& id : pending.m_DeferredBuffers)
+        {
+            m_Engine.ClearBuffer(id);
+        }
+
+        if (pending.m_Callback)
+        {
+            pending.m_Callback(pending.m_Result);
+        }
+    }
+}
+
+bool KernelRunner::IsArgumentOverwritten(const KernelArgument& argument) const
+{
+    // Read-only buffers are uploaded again when they are not cached, which replaces the buffer being downloaded
+    return argument.GetAccessType() != ArgumentAccessType::ReadOnly || !m_ReadOnlyCacheFlag;
+}
+
 KernelResult KernelRunner::RunKernelInternal(const Kernel& kernel, const KernelConfiguration& configuration,
-    const KernelDimensions& dimensions, const KernelRunMode mode, KernelLauncher launcher,
-    const std::vector<BufferOutputDescriptor>& output)
+    const KernelDimensions& dimensions, const KernelRunMode mode, KernelLauncher launcher)
 {
     m_ComputeLayer->AddData(kernel, configuration, dimensions, mode);
     const KernelId id = kernel.GetId();
@@ -263,17 +573,122 @@ KernelResult KernelRunner::RunKernelInternal(const Kernel& kernel, const KernelC
         result.SetStatus(GetStatusFromException(reason));
     }
 
-    const Nanoseconds dataOverhead = RunScopeTimer([this, &output]()
+    m_ComputeLayer->ClearData(id);
+
+    return result;
+}
+
+KernelResult KernelRunner::RunKernelRepeatedly(const Kernel& kernel, const KernelConfiguration& configuration,
+    const KernelDimensions& dimensions, const KernelRunMode mode, KernelLauncher launcher, const bool manageBuffers)
+{
+    Nanoseconds repetitionOverhead = 0;
+
+    for (uint64_t i = 0; i < m_MeasurementPolicy.GetWarmupRuns(); ++i)
     {
-        DownloadBuffers(output);
-    });
+        KernelResult warmupResult = RunKernelInternal(kernel, configuration, dimensions, mode, launcher);
 
-    result.SetDataMovementOverhead(result.GetDataMovementOverhead() + dataOverhead);
-    m_ComputeLayer->ClearData(id);
+        if (!warmupResult.IsValid())
+        {
+            return warmupResult;
+        }
+
+        repetitionOverhead += warmupResult.GetTotalDuration() + warmupResult.GetTotalOverhead();
+        repetitionOverhead += RefreshBuffers(kernel, manageBuffers);
+    }
+
+    std::vector<KernelResult> results;
+    std::vector<Nanoseconds> durations;
+    bool earlyAborted = false;
+
+    do
+    {
+        if (!results.empty())
+        {
+            repetitionOverhead += RefreshBuffers(kernel, manageBuffers);
+        }
+
+        KernelResult result = RunKernelInternal(kernel, configuration, dimensions, mode, launcher);
+
+        if (!result.IsValid())
+        {
+            result.SetFailedKernelOverhead(result.GetFailedKernelOverhead() + repetitionOverhead);
+            return result;
+        }
 
+        durations.push_back(result.GetTotalDuration());
+        results.push_back(result);
+
+        if (m_RacingIncumbent.has_value() && m_MeasurementPolicy.IsInferior(durations, *m_RacingIncumbent))
+        {
+            Logger::LogInfo("Measurement was aborted after " + std::to_string(durations.size())
+                + " runs, configuration is slower than the best one");
+            earlyAborted = true;
+            break;
+        }
+    }
+    while (!m_MeasurementPolicy.IsMeasurementFinished(durations));
+
+    // The run with median duration represents the configuration, remaining runs are accounted as overhead
+    const size_t medianIndex = MeasurementPolicy::GetMedianIndex(durations);
+    KernelResult result = results[medianIndex];
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (i != medianIndex)
+        {
+            repetitionOverhead += results[i].GetTotalDuration() + results[i].GetTotalOverhead();
+        }
+    }
+
+    MeasurementStatistics statistics = MeasurementPolicy::ComputeStatistics(durations);
+    statistics.m_WarmupRunCount = m_MeasurementPolicy.GetWarmupRuns();
+    statistics.m_EarlyAborted = earlyAborted;
+    statistics.m_RepetitionOverhead = repetitionOverhead;
+    result.SetMeasurementStatistics(statistics);
+
+    const auto& time = TimeConfiguration::GetInstance();
+    Logger::LogDebug("Kernel was measured " + std::to_string(statistics.m_RunCount) + " times, median duration is "
+        + std::to_string(time.ConvertFromNanoseconds(statistics.m_Median)) + time.GetUnitTag() + " with relative confidence interval width "
+        + std::to_string(statistics.GetRelativeConfidenceIntervalWidth()));
     return result;
 }
 
+std::vector<TransferActionId> KernelRunner::DownloadBuffersAsync(const std::vector<BufferOutputDescriptor>& output)
+{
+    const QueueId queue = GetOutputQueue();
+
+    if (queue != m_Engine.GetDefaultQueue())
+    {
+        // Secondary queue is not ordered with kernels launched in the default queue
+        m_Engine.SynchronizeQueue(m_Engine.GetDefaultQueue());
+    }
+
+    std::vector<TransferActionId> actions;
+
+    for (const auto& descriptor : output)
+    {
+        actions.push_back(m_Engine.DownloadArgument(descriptor.GetArgumentId(), queue, descriptor.GetOutputDestination(),
+            descriptor.GetOutputSize()));
+    }
+
+    return actions;
+}
+
+QueueId KernelRunner::GetOutputQueue() const
+{
+    const QueueId defaultQueue = m_Engine.GetDefaultQueue();
+
+    for (const auto queue : m_Engine.GetAllQueues())
+    {
+        if (queue != defaultQueue)
+        {
+            return queue;
+        }
+    }
+
+    return defaultQueue;
+}
+
 Nanoseconds KernelRunner::RunLauncher(KernelLauncher launcher)
 {
     Timer timer;
@@ -285,6 +700,67 @@ Nanoseconds KernelRunner::RunLauncher(KernelLauncher launcher)
     return timer.GetElapsedTime();
 }
 
+Nanoseconds KernelRunner::RefreshBuffers(const Kernel& kernel, const bool manageBuffers)
+{
+    if (!manageBuffers)
+    {
+        return 0;
+    }
+
+    // Kernel may have modified its input, the arguments are restored so that every run starts from the same data
+    return RunScopeTimer([this, &kernel]()
+    {
+        CleanupBuffers(kernel);
+        SetupBuffers(kernel);
+    });
+}
+
+bool KernelRunner::IsSnapshotUsed(const KernelArgument& argument) const
+{
+    return m_SnapshotFlag && argument.GetAccessType() != ArgumentAccessType::ReadOnly
+        && argument.GetMemoryLocation() == ArgumentMemoryLocation::Device && argument.GetOwnership() != ArgumentOwnership::User;
+}
+
+void KernelRunner::RestoreArgument(KernelArgument& argument)
+{
+    const auto& id = argument.GetId();
+    const auto snapshotId = id + m_SnapshotIdSuffix;
+    const QueueId queue = m_ComputeLayer->GetDefaultQueue();
+
+    if (ContainsKey(m_Snapshots, id) && m_Engine.HasBuffer(id) && m_Engine.HasBuffer(snapshotId))
+    {
+        const auto actionId = m_Engine.CopyArgument(id, queue, snapshotId, argument.GetDataSize());
+        m_Engine.WaitForTransferAction(actionId);
+        return;
+    }
+
+    ClearArgumentSnapshot(id);
+    m_Engine.ClearBuffer(id);
+
+    // Snapshot references host data of the original argument, the data are uploaded from host only when snapshot is created
+    auto snapshot = std::make_unique<KernelArgument>(snapshotId, argument.GetElementSize(), argument.GetDataType(),
+        argument.GetMemoryLocation(), ArgumentAccessType::ReadOnly, ArgumentMemoryType::Vector, ArgumentManagementType::Framework);
+    snapshot->SetReferencedData(argument.GetData(), argument.GetDataSize());
+
+    auto& snapshotArgument = *snapshot;
+    m_Snapshots[id] = std::move(snapshot);
+
+    const auto snapshotActionId = m_Engine.UploadArgument(snapshotArgument, queue);
+    const auto actionId = m_Engine.UploadArgument(argument, queue);
+    m_Engine.WaitForTransferAction(snapshotActionId);
+    m_Engine.WaitForTransferAction(actionId);
+}
+
+bool KernelRunner::IsRepeatedMeasurementEnabled(const KernelRunMode mode) const
+{
+    if (!m_MeasurementPolicy.IsRepeated() || IsProfilingActive())
+    {
+        return false;
+    }
+
+    return mode == KernelRunMode::OfflineTuning || mode == KernelRunMode::OnlineTuning;
+}
+
 void KernelRunner::PrepareValidationData(const ArgumentId& id)
 {
     if (!m_Validator->HasValidationData(id))
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <Api/Configuration/KernelConfiguration.h>
 #include <Api/Output/BufferOutputDescriptor.h>
@@ -11,7 +16,9 @@
 #include <KernelArgument/KernelArgumentManager.h>
 #include <KernelRunner/ComputeLayer.h>
 #include <KernelRunner/KernelRunMode.h>
+#include <KernelRunner/MeasurementPolicy.h>
 #include <KernelRunner/ResultValidator.h>
+#include <Utility/Timer/TimerCalibration.h>
 #include <KttTypes.h>
 
 namespace ktt
@@ -21,19 +28,38 @@ class KernelRunner
 {
 public:
     explicit KernelRunner(ComputeEngine& engine, KernelArgumentManager& argumentManager);
+    ~KernelRunner();
 
     KernelResult RunKernel(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
         const KernelRunMode mode, const std::vector<BufferOutputDescriptor>& output, const bool manageBuffers = true);
+    KernelResult RunKernelAsync(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+        const std::vector<BufferOutputDescriptor>& output, OutputCallback callback);
+    void CompileKernelsAsync(const Kernel& kernel, const std::vector<KernelConfiguration>& configurations,
+        const KernelDimensions& dimensions);
+    void PrecompileKernels(const Kernel& kernel, const std::vector<KernelConfiguration>& configurations);
     void SetupBuffers(const Kernel& kernel);
     void CleanupBuffers(const Kernel& kernel);
     void DownloadBuffers(const std::vector<BufferOutputDescriptor>& output);
+    bool ComputeBlockChecksums(const KernelArgument& argument, const size_t range, const size_t blockSize,
+        std::vector<BlockChecksum>& checksums);
+    void WaitForOutputs();
 
     void SetReadOnlyArgumentCache(const bool flag);
+    void SetReadWriteArgumentSnapshot(const bool flag);
+    void ClearArgumentSnapshot(const ArgumentId& id);
     void SetProfiling(const bool flag);
     bool IsProfilingActive() const;
+    void SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+        const double targetRelativeWidth);
+    void SetRacing(const bool flag, const uint64_t minimumRuns);
+    void SetRacingIncumbent(const std::optional<MeasurementStatistics>& statistics);
+    void CalibrateTimer(const Kernel& kernel);
+    const TimerCalibration& GetTimerCalibration() const;
 
     void SetValidationMethod(const ValidationMethod method, const double toleranceThreshold);
     void SetValidationMode(const ValidationMode mode);
+    void SetValidationSampleCount(const size_t count);
+    void SetReferenceResultCache(const std::string& directory, const std::string& version);
     void SetValidationRange(const ArgumentId& id, const size_t range);
     void SetValueComparator(const ArgumentId& id, ValueComparator comparator);
     void SetReferenceComputation(const ArgumentId& id, ReferenceComputation computation);
@@ -45,21 +71,53 @@ public:
     void RemoveValidationData(const ArgumentId& id);
 
 private:
+    struct PendingOutput
+    {
+        std::vector<TransferActionId> m_Actions;
+        std::set<ArgumentId> m_Arguments;
+        std::vector<ArgumentId> m_DeferredBuffers;
+        KernelResult m_Result;
+        OutputCallback m_Callback;
+    };
+
+    TimerCalibration m_Calibration;
     std::unique_ptr<ComputeLayer> m_ComputeLayer;
     std::unique_ptr<ResultValidator> m_Validator;
+    MeasurementPolicy m_MeasurementPolicy;
+    std::optional<MeasurementStatistics> m_RacingIncumbent;
     ComputeEngine& m_Engine;
     KernelArgumentManager& m_ArgumentManager;
     bool m_ReadOnlyCacheFlag;
+    bool m_SnapshotFlag;
+    std::map<ArgumentId, std::unique_ptr<KernelArgument>> m_Snapshots;
+    std::vector<PendingOutput> m_PendingOutputs;
     //bool m_ProfilingFlag;
 
+    KernelResult RunKernelPrivate(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+        const KernelRunMode mode, const std::vector<BufferOutputDescriptor>& output, const bool manageBuffers, const bool asyncOutput,
+        OutputCallback callback);
     KernelLauncher GetKernelLauncher(const Kernel& kernel);
+    void WaitForOutputs(const Kernel& kernel);
+    void FinishPendingOutputs(const size_t count);
+    bool IsArgumentOverwritten(const KernelArgument& argument) const;
     KernelResult RunKernelInternal(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
-        const KernelRunMode mode, KernelLauncher launcher, const std::vector<BufferOutputDescriptor>& output);
+        const KernelRunMode mode, KernelLauncher launcher);
+    KernelResult RunKernelRepeatedly(const Kernel& kernel, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+        const KernelRunMode mode, KernelLauncher launcher, const bool manageBuffers);
+    std::vector<TransferActionId> DownloadBuffersAsync(const std::vector<BufferOutputDescriptor>& output);
+    QueueId GetOutputQueue() const;
     Nanoseconds RunLauncher(KernelLauncher launcher);
+    Nanoseconds RefreshBuffers(const Kernel& kernel, const bool manageBuffers);
+    bool IsRepeatedMeasurementEnabled(const KernelRunMode mode) const;
+    bool IsSnapshotUsed(const KernelArgument& argument) const;
+    void RestoreArgument(KernelArgument& argument);
 
     void PrepareValidationData(const ArgumentId& id);
     void ValidateResult(const Kernel& kernel, KernelResult& result, const KernelRunMode mode);
     static ResultStatus GetStatusFromException(const ExceptionReason reason);
+
+    inline static const std::string m_SnapshotIdSuffix = "_KttSnapshot";
+    inline static const uint64_t m_CalibrationRunCount = 20;
 };
 
 } // namespace ktt
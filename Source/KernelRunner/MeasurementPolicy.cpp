@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <Api/KttException.h>
+#include <KernelRunner/MeasurementPolicy.h>
+
+namespace ktt
+{
+
+MeasurementPolicy::MeasurementPolicy() :
+    m_WarmupRuns(0),
+    m_MinimumRuns(1),
+    m_MaximumRuns(1),
+    m_TargetRelativeWidth(0.0),
+    m_RacingMinimumRuns(0)
+{}
+
+void MeasurementPolicy::SetRepetitions(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+    const double targetRelativeWidth)
+{
+    if (minimumRuns == 0)
+    {
+        throw KttException("Minimum number of measured runs must be at least one");
+    }
+
+    if (maximumRuns < minimumRuns)
+    {
+        throw KttException("Maximum number of measured runs cannot be lower than the minimum number of runs");
+    }
+
+    if (targetRelativeWidth < 0.0)
+    {
+        throw KttException("Target relative width of the confidence interval cannot be negative");
+    }
+
+    m_WarmupRuns = warmupRuns;
+    m_MinimumRuns = minimumRuns;
+    m_MaximumRuns = maximumRuns;
+    m_TargetRelativeWidth = targetRelativeWidth;
+}
+
+void MeasurementPolicy::SetRacing(const bool flag, const uint64_t minimumRuns)
+{
+    if (!flag)
+    {
+        m_RacingMinimumRuns = 0;
+        return;
+    }
+
+    if (minimumRuns < 2)
+    {
+        throw KttException("Racing requires at least two measured runs before a configuration can be discarded");
+    }
+
+    m_RacingMinimumRuns = minimumRuns;
+}
+
+bool MeasurementPolicy::IsRepeated() const
+{
+    return m_WarmupRuns > 0 || m_MaximumRuns > 1;
+}
+
+uint64_t MeasurementPolicy::GetWarmupRuns() const
+{
+    return m_WarmupRuns;
+}
+
+bool MeasurementPolicy::IsMeasurementFinished(const std::vector<Nanoseconds>& durations) const
+{
+    const uint64_t count = static_cast<uint64_t>(durations.size());
+
+    if (count < m_MinimumRuns)
+    {
+        return false;
+    }
+
+    if (count >= m_MaximumRuns)
+    {
+        return true;
+    }
+
+    // Confidence interval of a single run has zero width, but its real width is unknown
+    if (count < 2)
+    {
+        return false;
+    }
+
+    const MeasurementStatistics statistics = ComputeStatistics(durations);
+    return statistics.GetRelativeConfidenceIntervalWidth() <= m_TargetRelativeWidth;
+}
+
+bool MeasurementPolicy::IsInferior(const std::vector<Nanoseconds>& durations, const MeasurementStatistics& incumbent) const
+{
+    if (m_RacingMinimumRuns == 0 || static_cast<uint64_t>(durations.size()) < m_RacingMinimumRuns)
+    {
+        return false;
+    }
+
+    // Candidate is worse with high confidence when the confidence intervals of both medians do not overlap
+    const MeasurementStatistics statistics = ComputeStatistics(durations);
+    return statistics.m_ConfidenceIntervalLower > incumbent.m_ConfidenceIntervalUpper;
+}
+
+MeasurementStatistics MeasurementPolicy::ComputeStatistics(const std::vector<Nanoseconds>& durations)
+{
+    MeasurementStatistics statistics;
+
+    if (durations.empty())
+    {
+        return statistics;
+    }
+
+    std::vector<Nanoseconds> sorted = durations;
+    std::sort(sorted.begin(), sorted.end());
+
+    const size_t count = sorted.size();
+    statistics.m_RunCount = static_cast<uint64_t>(count);
+    statistics.m_Minimum = sorted[0];
+    statistics.m_Median = count % 2 == 1 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+
+    const double mean = std::accumulate(sorted.cbegin(), sorted.cend(), 0.0) / static_cast<double>(count);
+    double squaredDeviations = 0.0;
+
+    for (const auto duration : sorted)
+    {
+        const double deviation = static_cast<double>(duration) - mean;
+        squaredDeviations += deviation * deviation;
+    }
+
+    statistics.m_StandardDeviation = count > 1 ? std::sqrt(squaredDeviations / static_cast<double>(count - 1)) : 0.0;
+
+    // Distribution-free confidence interval of the median based on order statistics, ranks are one-based
+    const double spread = m_ConfidenceQuantile * std::sqrt(static_cast<double>(count));
+    const double lowerRank = std::floor((static_cast<double>(count) - spread) / 2.0);
+    const double upperRank = std::ceil(1.0 + (static_cast<double>(count) + spread) / 2.0);
+    const size_t lowerIndex = static_cast<size_t>(std::max(lowerRank, 1.0)) - 1;
+    const size_t upperIndex = static_cast<size_t>(std::min(upperRank, static_cast<double>(count))) - 1;
+
+    statistics.m_ConfidenceIntervalLower = sorted[lowerIndex];
+    statistics.m_ConfidenceIntervalUpper = sorted[upperIndex];
+    return statistics;
+}
+
+size_t MeasurementPolicy::GetMedianIndex(const std::vector<Nanoseconds>& durations)
+{
+    std::vector<size_t> indices(durations.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    const auto middle = indices.begin() + (indices.size() - 1) / 2;
+    std::nth_element(indices.begin(), middle, indices.end(), [&durations](const size_t first, const size_t second)
+    {
+        return durations[first] < durations[second];
+    });
+
+    return *middle;
+}
+
+} // namespace ktt
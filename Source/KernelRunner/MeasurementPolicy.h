@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Api/Output/MeasurementStatistics.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+class MeasurementPolicy
+{
+public:
+    MeasurementPolicy();
+
+    void SetRepetitions(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+        const double targetRelativeWidth);
+    void SetRacing(const bool flag, const uint64_t minimumRuns);
+
+    bool IsRepeated() const;
+    uint64_t GetWarmupRuns() const;
+    bool IsMeasurementFinished(const std::vector<Nanoseconds>& durations) const;
+    bool IsInferior(const std::vector<Nanoseconds>& durations, const MeasurementStatistics& incumbent) const;
+
+    static MeasurementStatistics ComputeStatistics(const std::vector<Nanoseconds>& durations);
+    static size_t GetMedianIndex(const std::vector<Nanoseconds>& durations);
+
+private:
+    uint64_t m_WarmupRuns;
+    uint64_t m_MinimumRuns;
+    uint64_t m_MaximumRuns;
+    double m_TargetRelativeWidth;
+    uint64_t m_RacingMinimumRuns;
+
+    // Two-sided 95% quantile of the standard normal distribution
+    inline static const double m_ConfidenceQuantile = 1.96;
+};
+
+} // namespace ktt
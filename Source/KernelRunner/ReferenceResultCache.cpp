@@ -0,0 +1,188 @@
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include <Api/KttException.h>
+#include <KernelArgument/KernelArgument.h>
+#include <KernelRunner/ReferenceResultCache.h>
+#include <Utility/FileSystem.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+ReferenceResultCache::ReferenceResultCache()
+{}
+
+void ReferenceResultCache::SetDirectory(const std::string& directory)
+{
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        if (error)
+        {
+            throw KttException("Unable to create reference result cache directory " + directory + ": " + error.message());
+        }
+    }
+
+    m_Directory = directory;
+}
+
+void ReferenceResultCache::SetVersion(const std::string& version)
+{
+    m_Version = version;
+}
+
+bool ReferenceResultCache::IsEnabled() const
+{
+    return !m_Directory.empty();
+}
+
+std::unique_ptr<MappedFile> ReferenceResultCache::Load(const std::string& key, const size_t size) const
+{
+    const std::string path = GetFilePath(key);
+    std::error_code error;
+
+    if (!IsEnabled() || !std::filesystem::exists(path, error))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> file;
+
+    try
+    {
+        file = std::make_unique<MappedFile>(path);
+    }
+    catch (const KttException& exception)
+    {
+        Logger::LogWarning(std::string("Unable to load reference result from cache: ") + exception.what());
+        return nullptr;
+    }
+
+    if (file->GetSize() != size)
+    {
+        Logger::LogWarning("Cached reference result " + key + " has unexpected size and will be recomputed");
+        return nullptr;
+    }
+
+    return file;
+}
+
+void ReferenceResultCache::Store(const std::string& key, const void* data, const size_t size) const
+{
+    if (!IsEnabled() || size == 0)
+    {
+        return;
+    }
+
+    // Result is written under a temporary name first, so that other sessions never map a partially written file
+    std::stringstream temporaryPath;
+    temporaryPath << GetFilePath(key) << ".tmp" << std::this_thread::get_id();
+
+    try
+    {
+        SaveBinaryToFile(temporaryPath.str(), data, size);
+    }
+    catch (const KttException& exception)
+    {
+        Logger::LogWarning(std::string("Unable to store reference result in cache: ") + exception.what());
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath.str(), GetFilePath(key), error);
+
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath.str(), error);
+    }
+}
+
+std::string ReferenceResultCache::GenerateKey(const std::vector<std::string>& components) const
+{
+    uint64_t hash = HashData(m_Version.data(), m_Version.size(), 0);
+
+    for (const auto& component : components)
+    {
+        hash = HashData(component.data(), component.size(), hash);
+    }
+
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+std::string ReferenceResultCache::HashArguments(const std::vector<KernelArgument*>& arguments)
+{
+    uint64_t hash = 0;
+
+    for (const auto* argument : arguments)
+    {
+        // Contents of user-owned buffers are not accessible from host, so the inputs cannot be identified
+        if (argument->GetOwnership() == ArgumentOwnership::User)
+        {
+            return "";
+        }
+
+        const std::string& id = argument->GetId();
+        const uint64_t dataSize = static_cast<uint64_t>(argument->GetDataSize());
+        hash = HashData(id.data(), id.size(), hash);
+        hash = HashData(&dataSize, sizeof(dataSize), hash);
+
+        if (argument->GetMemoryType() != ArgumentMemoryType::Local)
+        {
+            hash = HashData(argument->GetData(), argument->GetDataSize(), hash);
+        }
+    }
+
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+std::string ReferenceResultCache::GetFilePath(const std::string& key) const
+{
+    return (std::filesystem::path(m_Directory) / (key + m_FileExtension)).string();
+}
+
+uint64_t ReferenceResultCache::HashData(const void* data, const size_t size, const uint64_t seed)
+{
+    // Input buffers can be large, data are therefore processed in 64-bit words rather than individual bytes
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    uint64_t hash = seed ^ (static_cast<uint64_t>(size) * multiplier);
+    size_t offset = 0;
+
+    const auto mix = [&hash, multiplier](const uint64_t word)
+    {
+        hash ^= word * multiplier;
+        hash ^= hash >> 29;
+        hash *= 0xBF58476D1CE4E5B9ull;
+        hash ^= hash >> 32;
+    };
+
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(uint64_t));
+        mix(word);
+    }
+
+    uint64_t tail = 0;
+
+    if (offset < size)
+    {
+        std::memcpy(&tail, bytes + offset, size - offset);
+    }
+
+    mix(tail + 1);
+
+    return hash;
+}
+
+} // namespace ktt
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Utility/MappedFile.h>
+
+namespace ktt
+{
+
+class KernelArgument;
+
+class ReferenceResultCache
+{
+public:
+    ReferenceResultCache();
+
+    void SetDirectory(const std::string& directory);
+    void SetVersion(const std::string& version);
+    bool IsEnabled() const;
+
+    std::unique_ptr<MappedFile> Load(const std::string& key, const size_t size) const;
+    void Store(const std::string& key, const void* data, const size_t size) const;
+    std::string GenerateKey(const std::vector<std::string>& components) const;
+
+    static std::string HashArguments(const std::vector<KernelArgument*>& arguments);
+
+private:
+    std::string m_Directory;
+    std::string m_Version;
+
+    std::string GetFilePath(const std::string& key) const;
+    static uint64_t HashData(const void* data, const size_t size, const uint64_t seed);
+
+    inline static const std::string m_FileExtension = ".ref";
+};
+
+} // namespace ktt
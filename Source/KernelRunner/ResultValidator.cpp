@@ -1,6 +1,8 @@
+#include <cmath>
 #include <string>
 
 #include <Api/KttException.h>
+#include <Kernel/KernelDefinition.h>
 #include <KernelRunner/KernelRunner.h>
 #include <KernelRunner/ResultValidator.h>
 #include <Utility/ErrorHandling/Assert.h>
@@ -17,7 +19,8 @@ ResultValidator::ResultValidator(KernelRunner& kernelRunner) :
     m_KernelRunner(kernelRunner),
     m_ToleranceThreshold(1e-4),
     m_ValidationMethod(ValidationMethod::SideBySideComparison),
-    m_ValidationMode(ValidationMode::OfflineTuning | ValidationMode::OnlineTuning)
+    m_ValidationMode(ValidationMode::OfflineTuning | ValidationMode::OnlineTuning),
+    m_SampleCount(BufferComparator::m_DefaultSampleCount)
 {}
 
 void ResultValidator::SetValidationMethod(const ValidationMethod method, const double toleranceThreshold)
@@ -36,15 +39,33 @@ void ResultValidator::SetValidationMode(const ValidationMode mode)
     m_ValidationMode = mode;
 }
 
+void ResultValidator::SetValidationSampleCount(const size_t count)
+{
+    if (count == 0)
+    {
+        throw KttException("Validation sample count must be greater than zero");
+    }
+
+    m_SampleCount = count;
+}
+
+void ResultValidator::SetReferenceResultCache(const std::string& directory, const std::string& version)
+{
+    m_ReferenceCache.SetDirectory(directory);
+    m_ReferenceCache.SetVersion(version);
+}
+
 void ResultValidator::InitializeValidationData(const KernelArgument& argument)
 {
     m_ValidationData[argument.GetId()] = std::make_unique<ValidationData>(m_KernelRunner, argument);
+    m_ReferenceChecksums.erase(argument.GetId());
 }
 
 void ResultValidator::SetValidationRange(const ArgumentId& id, const size_t range)
 {
     KttAssert(HasValidationData(id), "Validation data not found");
     m_ValidationData[id]->SetValidationRange(range);
+    m_ReferenceChecksums.erase(id);
 }
 
 void ResultValidator::SetValueComparator(const ArgumentId& id, ValueComparator comparator)
@@ -80,6 +101,7 @@ bool ResultValidator::HasValidationData(const ArgumentId& id) const
 void ResultValidator::RemoveValidationData(const ArgumentId& id)
 {
     m_ValidationData.erase(id);
+    m_ReferenceChecksums.erase(id);
 }
 
 void ResultValidator::RemoveDataWithReferenceKernel(const KernelId id)
@@ -88,6 +110,11 @@ void ResultValidator::RemoveDataWithReferenceKernel(const KernelId id)
     {
         return pair.second->HasReferenceKernel() && pair.second->GetReferenceKernelId() == id;
     });
+
+    EraseIf(m_ReferenceChecksums, [this](const auto& pair)
+    {
+        return !HasValidationData(pair.first);
+    });
 }
 
 void ResultValidator::ComputeReferenceResult(const Kernel& kernel, const KernelRunMode runMode)
@@ -97,21 +124,37 @@ void ResultValidator::ComputeReferenceResult(const Kernel& kernel, const KernelR
         return;
     }
 
+    std::string inputHash;
+
+    if (m_ReferenceCache.IsEnabled())
+    {
+        std::vector<KernelArgument*> arguments;
+
+        for (const auto* definition : kernel.GetDefinitions())
+        {
+            const auto& definitionArguments = definition->GetArguments();
+            arguments.insert(arguments.end(), definitionArguments.cbegin(), definitionArguments.cend());
+        }
+
+        inputHash = ReferenceResultCache::HashArguments(arguments);
+    }
+
     for (const auto* argument : kernel.GetVectorArguments())
     {
         const auto id = argument->GetId();
 
         if (HasValidationData(id))
         {
-            ComputeReferenceResult(id);
+            ComputeReferenceResult(id, inputHash);
         }
     }
 }
 
-void ResultValidator::ComputeReferenceResult(const ArgumentId& id)
+void ResultValidator::ComputeReferenceResult(const ArgumentId& id, const std::string& inputHash)
 {
     KttAssert(HasValidationData(id), "Validation data not found");
-    m_ValidationData[id]->ComputeReferenceResults();
+    m_ValidationData[id]->ComputeReferenceResults(m_ReferenceCache, inputHash);
+    m_ReferenceChecksums.erase(id);
 }
 
 void ResultValidator::ClearReferenceResult(const Kernel& kernel)
@@ -131,6 +174,7 @@ void ResultValidator::ClearReferenceResult(const ArgumentId& id)
 {
     KttAssert(HasValidationData(id), "Validation data not found");
     m_ValidationData[id]->ClearReferenceResults();
+    m_ReferenceChecksums.erase(id);
 }
 
 bool ResultValidator::HasReferenceResult(const Kernel& kernel) const
@@ -201,6 +245,28 @@ bool ResultValidator::ValidateArgument(const KernelArgument& argument) const
     const auto& validationData = *m_ValidationData.find(argument.GetId())->second;
     const size_t validationRange = validationData.GetValidationRange();
     const size_t bufferSize = validationRange * argument.GetElementSize();
+    bool mismatchSuspected = false;
+
+    if (m_ValidationMethod == ValidationMethod::BlockChecksumComparison && !validationData.HasValueComparator())
+    {
+        // Buffer is downloaded only when the checksums computed on the device do not match, backends which cannot compute
+        // them fall back to checksums computed on the host from the downloaded buffer
+        std::vector<BlockChecksum> checksums;
+
+        if (m_KernelRunner.ComputeBlockChecksums(argument, validationRange, BufferComparator::m_ChecksumBlockSize, checksums))
+        {
+            const auto& referenceChecksums = GetReferenceChecksums(argument, validationData.GetReferenceResult<void>(),
+                validationRange);
+
+            if (BufferComparator::MatchChecksums(checksums, referenceChecksums, m_ToleranceThreshold))
+            {
+                Logger::LogDebug("Block checksums computed on device match for argument with id " + argument.GetId());
+                return true;
+            }
+
+            mismatchSuspected = true;
+        }
+    }
 
     std::vector<uint8_t> argumentData(bufferSize);
     BufferOutputDescriptor descriptor(argument.GetId(), argumentData.data(), bufferSize);
@@ -212,36 +278,48 @@ bool ResultValidator::ValidateArgument(const KernelArgument& argument) const
             validationRange, validationData.GetValueComparator());
     }
 
-    return ValidateResultWithMethod(argument, argumentData.data(), validationData.GetReferenceResult<void>(), validationRange);
+    return ValidateResultWithMethod(argument, argumentData.data(), validationData.GetReferenceResult<void>(), validationRange,
+        mismatchSuspected);
 }
 
 bool ResultValidator::ValidateResultWithMethod(const KernelArgument& argument, const void* result, const void* reference,
-    const size_t range) const
+    const size_t range, const bool mismatchSuspected) const
 {
     switch (argument.GetDataType())
     {
     case ArgumentDataType::Char:
-        return ValidateResult<int8_t>(argument, static_cast<const int8_t*>(result), static_cast<const int8_t*>(reference), range);
+        return ValidateResult<int8_t>(argument, static_cast<const int8_t*>(result), static_cast<const int8_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::UnsignedChar:
-        return ValidateResult<uint8_t>(argument, static_cast<const uint8_t*>(result), static_cast<const uint8_t*>(reference), range);
+        return ValidateResult<uint8_t>(argument, static_cast<const uint8_t*>(result), static_cast<const uint8_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Short:
-        return ValidateResult<int16_t>(argument, static_cast<const int16_t*>(result), static_cast<const int16_t*>(reference), range);
+        return ValidateResult<int16_t>(argument, static_cast<const int16_t*>(result), static_cast<const int16_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::UnsignedShort:
-        return ValidateResult<uint16_t>(argument, static_cast<const uint16_t*>(result), static_cast<const uint16_t*>(reference), range);
+        return ValidateResult<uint16_t>(argument, static_cast<const uint16_t*>(result), static_cast<const uint16_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Int:
-        return ValidateResult<int32_t>(argument, static_cast<const int32_t*>(result), static_cast<const int32_t*>(reference), range);
+        return ValidateResult<int32_t>(argument, static_cast<const int32_t*>(result), static_cast<const int32_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::UnsignedInt:
-        return ValidateResult<uint32_t>(argument, static_cast<const uint32_t*>(result), static_cast<const uint32_t*>(reference), range);
+        return ValidateResult<uint32_t>(argument, static_cast<const uint32_t*>(result), static_cast<const uint32_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Long:
-        return ValidateResult<int64_t>(argument, static_cast<const int64_t*>(result), static_cast<const int64_t*>(reference), range);
+        return ValidateResult<int64_t>(argument, static_cast<const int64_t*>(result), static_cast<const int64_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::UnsignedLong:
-        return ValidateResult<uint64_t>(argument, static_cast<const uint64_t*>(result), static_cast<const uint64_t*>(reference), range);
+        return ValidateResult<uint64_t>(argument, static_cast<const uint64_t*>(result), static_cast<const uint64_t*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Half:
-        return ValidateResult<half>(argument, static_cast<const half*>(result), static_cast<const half*>(reference), range);
+        return ValidateResult<half>(argument, static_cast<const half*>(result), static_cast<const half*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Float:
-        return ValidateResult<float>(argument, static_cast<const float*>(result), static_cast<const float*>(reference), range);
+        return ValidateResult<float>(argument, static_cast<const float*>(result), static_cast<const float*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Double:
-        return ValidateResult<double>(argument, static_cast<const double*>(result), static_cast<const double*>(reference), range);
+        return ValidateResult<double>(argument, static_cast<const double*>(result), static_cast<const double*>(reference), range,
+            mismatchSuspected);
     case ArgumentDataType::Custom:
         throw KttException("Validation of kernel arguments with custom data type requires usage of value comparator");
     default:
@@ -250,6 +328,66 @@ bool ResultValidator::ValidateResultWithMethod(const KernelArgument& argument, c
     }
 }
 
+void ResultValidator::LogComparisonSummary(const KernelArgument& argument, const ComparisonSummary& summary, const size_t range) const
+{
+    const std::string& id = argument.GetId();
+
+    if (!summary.m_Valid)
+    {
+        if (summary.HasMismatch())
+        {
+            Logger::LogWarning("Results differ for argument with id " + id + " at index " + std::to_string(summary.m_MismatchIndex)
+                + ", reference value: " + std::to_string(summary.m_MismatchReference) + ", result value: "
+                + std::to_string(summary.m_MismatchResult) + ", difference: "
+                + std::to_string(std::fabs(summary.m_MismatchResult - summary.m_MismatchReference)));
+        }
+        else
+        {
+            Logger::LogWarning("Results differ for argument with id " + id + ", absolute difference is "
+                + std::to_string(summary.m_DifferenceSum));
+        }
+    }
+
+    if (summary.m_ComparedCount == 0)
+    {
+        return;
+    }
+
+    const std::string message = "Largest difference for argument with id " + id + " is " + std::to_string(summary.m_WorstDifference)
+        + " at index " + std::to_string(summary.m_WorstIndex) + ", reference value: " + std::to_string(summary.m_WorstReference)
+        + ", result value: " + std::to_string(summary.m_WorstResult) + ", compared elements: "
+        + std::to_string(summary.m_ComparedCount) + " / " + std::to_string(range) + ", difference histogram: "
+        + summary.GetHistogramString();
+
+    if (summary.m_Valid)
+    {
+        Logger::LogDebug(message);
+    }
+    else
+    {
+        Logger::LogWarning(message);
+    }
+}
+
+const std::vector<BlockChecksum>& ResultValidator::GetReferenceChecksums(const KernelArgument& argument, const void* reference,
+    const size_t range) const
+{
+    auto& checksums = m_ReferenceChecksums[argument.GetId()];
+
+    if (checksums.empty())
+    {
+        checksums = m_Comparator.ComputeChecksums(reference, argument.GetDataType(), range);
+    }
+
+    return checksums;
+}
+
+bool ResultValidator::IsFastValidationMethod() const
+{
+    return m_ValidationMethod == ValidationMethod::SampledComparison
+        || m_ValidationMethod == ValidationMethod::BlockChecksumComparison;
+}
+
 bool ResultValidator::ValidateResultWithComparator(const KernelArgument& argument, const void* result, const void* referenceResult,
     const size_t range, ValueComparator comparator) const
 {
@@ -2,10 +2,13 @@
 
 #include <map>
 #include <memory>
-#include <type_traits>
+#include <string>
+#include <vector>
 
 #include <Kernel/Kernel.h>
+#include <KernelRunner/BufferComparator.h>
 #include <KernelRunner/KernelRunMode.h>
+#include <KernelRunner/ReferenceResultCache.h>
 #include <KernelRunner/ValidationData.h>
 #include <KernelRunner/ValidationMethod.h>
 #include <KernelRunner/ValidationMode.h>
@@ -23,6 +26,8 @@ public:
 
     void SetValidationMethod(const ValidationMethod method, const double toleranceThreshold);
     void SetValidationMode(const ValidationMode mode);
+    void SetValidationSampleCount(const size_t count);
+    void SetReferenceResultCache(const std::string& directory, const std::string& version);
 
     void InitializeValidationData(const KernelArgument& argument);
     void SetValidationRange(const ArgumentId& id, const size_t range);
@@ -36,7 +41,7 @@ public:
     void RemoveDataWithReferenceKernel(const KernelId id);
 
     void ComputeReferenceResult(const Kernel& kernel, const KernelRunMode runMode);
-    void ComputeReferenceResult(const ArgumentId& id);
+    void ComputeReferenceResult(const ArgumentId& id, const std::string& inputHash);
     void ClearReferenceResult(const Kernel& kernel);
     void ClearReferenceResult(const ArgumentId& id);
     bool HasReferenceResult(const Kernel& kernel) const;
@@ -49,34 +54,30 @@ private:
     double m_ToleranceThreshold;
     ValidationMethod m_ValidationMethod;
     ValidationMode m_ValidationMode;
+    size_t m_SampleCount;
     std::map<ArgumentId, std::unique_ptr<ValidationData>> m_ValidationData;
+    BufferComparator m_Comparator;
+    ReferenceResultCache m_ReferenceCache;
+    mutable std::map<ArgumentId, std::vector<BlockChecksum>> m_ReferenceChecksums;
 
     bool IsRunModeValidated(const KernelRunMode mode) const;
     bool ValidateArgument(const KernelArgument& argument) const;
     bool ValidateResultWithMethod(const KernelArgument& argument, const void* result, const void* reference,
-        const size_t range) const;
+        const size_t range, const bool mismatchSuspected) const;
     bool ValidateResultWithComparator(const KernelArgument& argument, const void* result, const void* reference,
         const size_t range, ValueComparator comparator) const;
 
-    template <typename T>
-    bool ValidateResult(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const;
-
-    template <typename T>
-    bool ValidateResultInner(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
-        std::true_type) const;
-
-    template <typename T>
-    bool ValidateResultInner(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
-        std::false_type) const;
-
-    template <typename T>
-    bool ValidateAbsoluteDifference(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const;
+    void LogComparisonSummary(const KernelArgument& argument, const ComparisonSummary& summary, const size_t range) const;
+    const std::vector<BlockChecksum>& GetReferenceChecksums(const KernelArgument& argument, const void* reference,
+        const size_t range) const;
+    bool IsFastValidationMethod() const;
 
     template <typename T>
-    bool ValidateSideBySide(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const;
+    bool ValidateResult(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
+        const bool mismatchSuspected) const;
 
     template <typename T>
-    bool ValidateSideBySideRelative(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const;
+    bool IsMismatchSuspected(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const;
 };
 
 } // namespace ktt
@@ -1,110 +1,61 @@
-#include <cmath>
+#include <string>
 
 #include <KernelRunner/ResultValidator.h>
-#include <Utility/ErrorHandling/Assert.h>
 #include <Utility/Logger/Logger.h>
 
 namespace ktt
 {
 
 template <typename T>
-bool ResultValidator::ValidateResult(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const
+bool ResultValidator::ValidateResult(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
+    const bool mismatchSuspected) const
 {
-    return ValidateResultInner(argument, result, reference, range, std::is_floating_point<T>());
-}
-
-template <typename T>
-bool ResultValidator::ValidateResultInner(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
-    std::true_type) const
-{
-    switch (m_ValidationMethod)
-    {
-    case ValidationMethod::AbsoluteDifference:
-        return ValidateAbsoluteDifference(argument, result, reference, range);
-    case ValidationMethod::SideBySideComparison:
-        return ValidateSideBySide(argument, result, reference, range);
-    case ValidationMethod::SideBySideRelativeComparison:
-        return ValidateSideBySideRelative(argument, result, reference, range);
-    default:
-        KttError("Unhandled validation method value");
-        return false;
-    }
-}
+    ValidationMethod method = m_ValidationMethod;
 
-template <typename T>
-bool ResultValidator::ValidateResultInner(const KernelArgument& argument, const T* result, const T* reference, const size_t range,
-    std::false_type) const
-{
-    for (size_t i = 0; i < range; ++i)
+    if (IsFastValidationMethod())
     {
-        if (result[i] != reference[i])
+        if (!mismatchSuspected && !IsMismatchSuspected(argument, result, reference, range))
         {
-            Logger::LogWarning("Results differ for argument with id " + argument.GetId() + " at index " + std::to_string(i)
-                + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i])
-                + ", difference: " + std::to_string(std::fabs(result[i] - reference[i])));
-            return false;
+            return true;
         }
-    }
 
-    return true;
-}
-
-template <typename T>
-bool ResultValidator::ValidateAbsoluteDifference(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const
-{
-    double difference = 0.0;
-
-    for (size_t i = 0; i < range; ++i)
-    {
-        difference += std::fabs(result[i] - reference[i]);
+        Logger::LogDebug("Fast validation suspects mismatch for argument with id " + argument.GetId()
+            + ", validating the whole buffer");
+        method = ValidationMethod::SideBySideComparison;
     }
 
-    if (difference > m_ToleranceThreshold)
-    {
-        Logger::LogWarning("Results differ for argument with id " + argument.GetId() + ", absolute difference is "
-            + std::to_string(difference));
-        return false;
-    }
-
-    return true;
+    const ComparisonSummary summary = m_Comparator.Compare(result, reference, range, method, m_ToleranceThreshold);
+    LogComparisonSummary(argument, summary, range);
+    return summary.m_Valid;
 }
 
 template <typename T>
-bool ResultValidator::ValidateSideBySide(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const
+bool ResultValidator::IsMismatchSuspected(const KernelArgument& argument, const T* result, const T* reference,
+    const size_t range) const
 {
-    for (size_t i = 0; i < range; ++i)
+    if (m_ValidationMethod == ValidationMethod::SampledComparison)
     {
-        const T difference = std::fabs(result[i] - reference[i]);
+        const auto indices = BufferComparator::GenerateSampleIndices(range, m_SampleCount);
+        const ComparisonSummary summary = m_Comparator.CompareSample(result, reference, indices, m_ToleranceThreshold);
 
-        if (difference > m_ToleranceThreshold)
+        if (summary.m_Valid)
         {
-            Logger::LogWarning("Results differ for argument with id " + argument.GetId() + " at index " + std::to_string(i)
-                + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i])
-                + ", difference: " + std::to_string(difference));
-            return false;
+            LogComparisonSummary(argument, summary, range);
         }
+
+        return !summary.m_Valid;
     }
 
-    return true;
-}
+    const auto& referenceChecksums = GetReferenceChecksums(argument, reference, range);
+    const bool match = BufferComparator::MatchChecksums(m_Comparator.ComputeChecksums(result, range), referenceChecksums,
+        m_ToleranceThreshold);
 
-template <typename T>
-bool ResultValidator::ValidateSideBySideRelative(const KernelArgument& argument, const T* result, const T* reference, const size_t range) const
-{
-    for (size_t i = 0; i < range; ++i)
+    if (match)
     {
-        const T difference = std::fabs(result[i] - reference[i]);
-        const T relativeDifference = difference / reference[i];
-
-        if (difference > 1e-4 && relativeDifference > m_ToleranceThreshold)
-        {
-            Logger::LogWarning("Results differ for argument with id " + argument.GetId() + " at index " + std::to_string(i)
-                + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i])
-                + ", relative difference: " + std::to_string(relativeDifference));
-            return false;
-        }
+        Logger::LogDebug("Block checksums match for argument with id " + argument.GetId());
     }
-    return true;
+
+    return !match;
 }
 
 } // namespace ktt
@@ -3,6 +3,7 @@
 #include <Api/Output/BufferOutputDescriptor.h>
 #include <Api/KttException.h>
 #include <Kernel/Kernel.h>
+#include <Kernel/KernelDefinition.h>
 #include <KernelArgument/KernelArgument.h>
 #include <KernelRunner/KernelRunner.h>
 #include <KernelRunner/ValidationData.h>
@@ -120,8 +121,23 @@ KernelId ValidationData::GetReferenceKernelId() const
     return m_ReferenceKernel->GetId();
 }
 
-void ValidationData::ComputeReferenceResults()
+void ValidationData::ComputeReferenceResults(const ReferenceResultCache& cache, const std::string& inputHash)
 {
+    const std::string key = GetCacheKey(cache, inputHash);
+    const size_t referenceSize = m_ValidationRange * m_Argument.GetElementSize();
+
+    if (!key.empty())
+    {
+        // Cached result is mapped into memory, its pages are loaded only once they are accessed during validation
+        m_CachedResult = cache.Load(key, referenceSize);
+
+        if (m_CachedResult != nullptr)
+        {
+            Logger::LogInfo("Reference result for argument with id " + m_Argument.GetId() + " was loaded from cache");
+            return;
+        }
+    }
+
     const Nanoseconds referenceComputationTime = RunScopeTimer([this]()
     {
         if (HasReferenceComputation())
@@ -139,18 +155,77 @@ void ValidationData::ComputeReferenceResults()
     const uint64_t elapsedTime = time.ConvertFromNanoseconds(referenceComputationTime);
     Logger::LogInfo("Reference result for argument with id " + m_Argument.GetId() + " was computed in "
         + std::to_string(elapsedTime) + time.GetUnitTag());
+
+    if (!key.empty())
+    {
+        const auto& result = HasReferenceComputation() ? m_ReferenceResult : m_ReferenceKernelResult;
+        cache.Store(key, result.data(), result.size());
+    }
 }
 
 void ValidationData::ClearReferenceResults()
 {
     m_ReferenceResult.clear();
     m_ReferenceKernelResult.clear();
+    m_CachedResult.reset();
 }
 
 bool ValidationData::HasReferenceResults() const
 {
-    return (HasReferenceComputation() && !m_ReferenceResult.empty()) || (HasReferenceKernel() && !m_ReferenceKernelResult.empty())
-        || HasReferenceArgument();
+    const bool cached = m_CachedResult != nullptr;
+    return (HasReferenceComputation() && (cached || !m_ReferenceResult.empty()))
+        || (HasReferenceKernel() && (cached || !m_ReferenceKernelResult.empty())) || HasReferenceArgument();
+}
+
+std::string ValidationData::GetCacheKey(const ReferenceResultCache& cache, const std::string& inputHash) const
+{
+    if (!cache.IsEnabled() || inputHash.empty() || m_ValidationRange == 0
+        || (!HasReferenceComputation() && !HasReferenceKernel()))
+    {
+        return "";
+    }
+
+    std::vector<std::string> components
+    {
+        inputHash,
+        m_Argument.GetId(),
+        std::to_string(static_cast<int>(m_Argument.GetDataType())),
+        std::to_string(m_Argument.GetElementSize()),
+        std::to_string(m_ValidationRange)
+    };
+
+    if (HasReferenceComputation())
+    {
+        components.push_back("Computation");
+        return cache.GenerateKey(components);
+    }
+
+    std::vector<KernelArgument*> referenceArguments;
+
+    for (const auto* definition : m_ReferenceKernel->GetDefinitions())
+    {
+        const auto& arguments = definition->GetArguments();
+        referenceArguments.insert(referenceArguments.end(), arguments.cbegin(), arguments.cend());
+    }
+
+    const std::string referenceHash = ReferenceResultCache::HashArguments(referenceArguments);
+
+    if (referenceHash.empty())
+    {
+        return "";
+    }
+
+    components.push_back("Kernel");
+    components.push_back(m_ReferenceKernel->GetName());
+    components.push_back(m_ReferenceConfiguration.GetString());
+    components.push_back(referenceHash);
+
+    for (const auto& [definitionId, sizes] : m_ReferenceDimensions)
+    {
+        components.push_back(std::to_string(definitionId) + ":" + sizes.first.GetString() + ":" + sizes.second.GetString());
+    }
+
+    return cache.GenerateKey(components);
 }
 
 void ValidationData::ComputeReferenceWithFunction()
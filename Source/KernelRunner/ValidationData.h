@@ -2,9 +2,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <Api/Configuration/KernelConfiguration.h>
+#include <KernelRunner/ReferenceResultCache.h>
+#include <Utility/MappedFile.h>
 #include <KttTypes.h>
 
 namespace ktt
@@ -33,7 +37,7 @@ public:
     bool HasReferenceArgument() const;
     KernelId GetReferenceKernelId() const;
 
-    void ComputeReferenceResults();
+    void ComputeReferenceResults(const ReferenceResultCache& cache, const std::string& inputHash);
     void ClearReferenceResults();
     bool HasReferenceResults() const;
 
@@ -52,7 +56,9 @@ private:
     KernelDimensions m_ReferenceDimensions;
     std::vector<uint8_t> m_ReferenceKernelResult;
     const KernelArgument* m_ReferenceArgument;
+    std::unique_ptr<MappedFile> m_CachedResult;
 
+    std::string GetCacheKey(const ReferenceResultCache& cache, const std::string& inputHash) const;
     void ComputeReferenceWithFunction();
     void ComputeReferenceWithKernel();
     void ResetReferenceData();
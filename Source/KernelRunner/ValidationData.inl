@@ -29,12 +29,22 @@ const T* ValidationData::GetReferenceResult() const
 template <typename T>
 const T* ValidationData::GetReferenceComputationResult() const
 {
+    if (m_CachedResult != nullptr)
+    {
+        return static_cast<const T*>(m_CachedResult->GetData());
+    }
+
     return reinterpret_cast<const T*>(m_ReferenceResult.data());
 }
 
 template <typename T>
 const T* ValidationData::GetReferenceKernelResult() const
 {
+    if (m_CachedResult != nullptr)
+    {
+        return static_cast<const T*>(m_CachedResult->GetData());
+    }
+
     return reinterpret_cast<const T*>(m_ReferenceKernelResult.data());
 }
 
@@ -22,7 +22,24 @@ enum class ValidationMethod
     /** Calculates difference for each pair of elements, then compares the difference divided by reference value to the specified
       * threshold.
       */
-    SideBySideRelativeComparison
+    SideBySideRelativeComparison,
+
+    /** Compares elements at the beginning and end of the buffer together with a deterministic random sample of the remaining
+      * elements, each of them to the specified threshold. The sample size can be changed with Tuner::SetValidationSampleCount().
+      * If a mismatch is found, the whole buffer is validated with side by side comparison. Significantly faster for large buffers,
+      * but errors which affect only a few elements may remain undetected. The whole buffer is still downloaded from the device,
+      * only the host-side comparison is shortened.
+      */
+    SampledComparison,
+
+    /** Splits the buffer into blocks and compares sum of each block to the corresponding reference sum. The difference is allowed
+      * to be up to the specified threshold multiplied by the number of elements in block. OpenCL backend computes the sums of
+      * floating-point buffers on the device with a reduction kernel, so only the sums are downloaded, provided that the device
+      * supports double precision. Other backends and data types download the buffer and compute the sums on the host. If any
+      * block exceeds the limit, the whole buffer is downloaded and validated with side by side comparison. Errors which cancel
+      * each other out within a block remain undetected.
+      */
+    BlockChecksumComparison
 };
 
 } // namespace ktt
@@ -7,11 +7,15 @@
 
 #include <Api/Searcher/DeterministicSearcher.h>
 #include <Api/Searcher/McmcSearcher.h>
+#include <Api/Searcher/NativeProfileBasedSearcher.h>
+#include <Api/Searcher/ParetoSearcher.h>
 #include <Api/Searcher/RandomSearcher.h>
 
 #include <Api/StopCondition/ConfigurationCount.h>
 #include <Api/StopCondition/ConfigurationDuration.h>
 #include <Api/StopCondition/ConfigurationFraction.h>
+#include <Api/StopCondition/ConvergenceCondition.h>
+#include <Api/StopCondition/PredictiveTuningDuration.h>
 #include <Api/StopCondition/TuningDuration.h>
 #include <Api/StopCondition/UnionCondition.h>
 
@@ -18,6 +18,8 @@ namespace ktt
 {
 
 class ComputeInterface;
+class KernelConfiguration;
+class KernelResult;
 
 /** @typedef PlatformIndex
   * Data type for referencing platforms in KTT.
@@ -109,6 +111,12 @@ using GenericConstraintFunction = std::function<bool(const std::vector<const Par
   */
 using KernelLauncher = std::function<void(ComputeInterface& /*interface*/)>;
 
+/** @typedef HostFunction
+  * Definition of kernel function executed on the host processor. Receives pointers to kernel arguments in the order in which
+  * they were assigned to kernel definition. Vector arguments point to buffer data, scalar arguments to their value.
+  */
+using HostFunction = std::function<void(const KernelConfiguration& /*configuration*/, const std::vector<void*>& /*arguments*/)>;
+
 /** @typedef ReferenceComputation
   * Function for computing reference kernel argument output. Used during validation.
   */
@@ -119,6 +127,17 @@ using ReferenceComputation = std::function<void(void* /*buffer*/)>;
   */
 using ValueComparator = std::function<bool(const void* /*result*/, const void* /*reference*/)>;
 
+/** @typedef ObjectiveScalarization
+  * Function which converts values of tuning objectives into a single score. Configuration with the lowest score is considered
+  * to be the best.
+  */
+using ObjectiveScalarization = std::function<double(const std::vector<double>& /*objectiveValues*/)>;
+
+/** @typedef OutputCallback
+  * Function which is invoked once output of asynchronously run kernel is downloaded into user-provided memory.
+  */
+using OutputCallback = std::function<void(const KernelResult& /*result*/)>;
+
 /** @typedef UnifiedBufferMemory
   * Data type for accessing unified memory buffers in KTT.
   */
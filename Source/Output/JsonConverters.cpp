@@ -17,6 +17,11 @@ void to_json(json& j, const TunerMetadata& metadata)
         {"Timestamp", metadata.GetTimestamp()},
         {"TimeUnit", metadata.GetTimeUnit()},
     };
+
+    if (metadata.GetTimerCalibration().IsValid())
+    {
+        j["TimerCalibration"] = metadata.GetTimerCalibration();
+    }
 }
 
 void from_json(const json& j, TunerMetadata& metadata)
@@ -28,6 +33,37 @@ void from_json(const json& j, TunerMetadata& metadata)
     metadata.SetKttVersion(j.at("KttVersion").get<std::string>());
     metadata.SetTimestamp(j.at("Timestamp").get<std::string>());
     metadata.SetTimeUnit(j.at("TimeUnit").get<TimeUnit>());
+
+    if (j.contains("TimerCalibration"))
+    {
+        TimerCalibration calibration;
+        j.at("TimerCalibration").get_to(calibration);
+        metadata.SetTimerCalibration(calibration);
+    }
+}
+
+void to_json(json& j, const TimerCalibration& calibration)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    j = json
+    {
+        {"LaunchOverhead", time.ConvertFromNanosecondsDouble(calibration.GetLaunchOverhead())},
+        {"EventTimingOverhead", time.ConvertFromNanosecondsDouble(calibration.GetEventTimingOverhead())},
+        {"TimerOverhead", time.ConvertFromNanosecondsDouble(calibration.GetTimerOverhead())},
+        {"TimerResolution", time.ConvertFromNanosecondsDouble(calibration.GetTimerResolution())}
+    };
+}
+
+void from_json(const json& j, TimerCalibration& calibration)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    calibration.SetLaunchOverhead(time.ConvertToNanosecondsDouble(j.at("LaunchOverhead").get<double>()));
+    calibration.SetEventTimingOverhead(time.ConvertToNanosecondsDouble(j.at("EventTimingOverhead").get<double>()));
+    calibration.SetTimerOverhead(time.ConvertToNanosecondsDouble(j.at("TimerOverhead").get<double>()));
+    calibration.SetTimerResolution(time.ConvertToNanosecondsDouble(j.at("TimerResolution").get<double>()));
+    calibration.SetValid(true);
 }
 
 void to_json(json& j, const DimensionVector& vector)
@@ -243,6 +279,39 @@ void from_json(const json& j, KernelProfilingData& data)
     }
 }
 
+void to_json(json& j, const MeasurementStatistics& statistics)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    j = json
+    {
+        {"Median", time.ConvertFromNanosecondsDouble(statistics.m_Median)},
+        {"Minimum", time.ConvertFromNanosecondsDouble(statistics.m_Minimum)},
+        {"StandardDeviation", time.ConvertFromNanosecondsDouble(static_cast<Nanoseconds>(statistics.m_StandardDeviation))},
+        {"ConfidenceIntervalLower", time.ConvertFromNanosecondsDouble(statistics.m_ConfidenceIntervalLower)},
+        {"ConfidenceIntervalUpper", time.ConvertFromNanosecondsDouble(statistics.m_ConfidenceIntervalUpper)},
+        {"RunCount", statistics.m_RunCount},
+        {"WarmupRunCount", statistics.m_WarmupRunCount},
+        {"EarlyAborted", statistics.m_EarlyAborted},
+        {"RepetitionOverhead", time.ConvertFromNanosecondsDouble(statistics.m_RepetitionOverhead)}
+    };
+}
+
+void from_json(const json& j, MeasurementStatistics& statistics)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    statistics.m_Median = time.ConvertToNanosecondsDouble(j.at("Median").get<double>());
+    statistics.m_Minimum = time.ConvertToNanosecondsDouble(j.at("Minimum").get<double>());
+    statistics.m_StandardDeviation = static_cast<double>(time.ConvertToNanosecondsDouble(j.at("StandardDeviation").get<double>()));
+    statistics.m_ConfidenceIntervalLower = time.ConvertToNanosecondsDouble(j.at("ConfidenceIntervalLower").get<double>());
+    statistics.m_ConfidenceIntervalUpper = time.ConvertToNanosecondsDouble(j.at("ConfidenceIntervalUpper").get<double>());
+    j.at("RunCount").get_to(statistics.m_RunCount);
+    j.at("WarmupRunCount").get_to(statistics.m_WarmupRunCount);
+    j.at("EarlyAborted").get_to(statistics.m_EarlyAborted);
+    statistics.m_RepetitionOverhead = time.ConvertToNanosecondsDouble(j.at("RepetitionOverhead").get<double>());
+}
+
 void to_json(json& j, const ComputationResult& result)
 {
     const auto& time = TimeConfiguration::GetInstance();
@@ -290,8 +359,14 @@ void from_json(const json& j, ComputationResult& result)
     j.at("Overhead").get_to(overhead);
     const Nanoseconds overheadNs = time.ConvertToNanosecondsDouble(overhead);
 
-    double compilationOverhead;
-    j.at("CompilationOverhead").get_to(compilationOverhead);
+    // Results saved by older versions of KTT do not contain compilation overhead
+    double compilationOverhead = 0.0;
+
+    if (j.contains("CompilationOverhead"))
+    {
+        j.at("CompilationOverhead").get_to(compilationOverhead);
+    }
+
     const Nanoseconds overheadCompNs = time.ConvertToNanosecondsDouble(compilationOverhead);
 
     result.SetDurationData(durationNs, overheadNs, overheadCompNs);
@@ -349,6 +424,26 @@ void to_json(json& j, const KernelResult& result)
         {"Configuration", result.GetConfiguration()},
         {"ComputationResults", result.GetResults()}
     };
+
+    if (result.HasMeasurementStatistics())
+    {
+        j["MeasurementStatistics"] = result.GetMeasurementStatistics();
+    }
+
+    if (result.HasTuningDevice())
+    {
+        j["TuningDevice"] = result.GetTuningDevice();
+    }
+
+    if (result.GetCalibrationOverhead() != 0)
+    {
+        j["CalibrationOverhead"] = time.ConvertFromNanosecondsDouble(result.GetCalibrationOverhead());
+    }
+
+    if (result.GetDriftCorrection() != 1.0)
+    {
+        j["DriftCorrection"] = result.GetDriftCorrection();
+    }
 }
 
 void from_json(const json& j, KernelResult& result)
@@ -389,6 +484,34 @@ void from_json(const json& j, KernelResult& result)
     j.at("SearcherOverhead").get_to(searcherOverhead);
     const Nanoseconds searcherOverheadNs = time.ConvertToNanosecondsDouble(searcherOverhead);
     result.SetSearcherOverhead(searcherOverheadNs);
+
+    if (j.contains("MeasurementStatistics"))
+    {
+        MeasurementStatistics statistics;
+        j.at("MeasurementStatistics").get_to(statistics);
+        result.SetMeasurementStatistics(statistics);
+    }
+
+    if (j.contains("TuningDevice"))
+    {
+        DeviceIndex device;
+        j.at("TuningDevice").get_to(device);
+        result.SetTuningDevice(device);
+    }
+
+    if (j.contains("CalibrationOverhead"))
+    {
+        double calibrationOverhead;
+        j.at("CalibrationOverhead").get_to(calibrationOverhead);
+        result.SetCalibrationOverhead(time.ConvertToNanosecondsDouble(calibrationOverhead));
+    }
+
+    if (j.contains("DriftCorrection"))
+    {
+        double factor;
+        j.at("DriftCorrection").get_to(factor);
+        result.SetDriftCorrection(factor);
+    }
 }
 
 } // namespace ktt
@@ -16,7 +16,8 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ComputeApi,
 {
     {ComputeApi::OpenCL, "OpenCL"},
     {ComputeApi::CUDA, "CUDA"},
-    {ComputeApi::Vulkan, "Vulkan"}
+    {ComputeApi::Vulkan, "Vulkan"},
+    {ComputeApi::Host, "Host"}
 });
 
 NLOHMANN_JSON_SERIALIZE_ENUM(GlobalSizeType,
@@ -40,7 +41,8 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ResultStatus,
     {ResultStatus::ComputationFailed, "ComputationFailed"},
     {ResultStatus::ValidationFailed, "ValidationFailed"},
     {ResultStatus::CompilationFailed, "CompilationFailed"},
-    {ResultStatus::DeviceLimitsExceeded, "DeviceLimitsExceeded"}
+    {ResultStatus::DeviceLimitsExceeded, "DeviceLimitsExceeded"},
+    {ResultStatus::Timeout, "Timeout"}
 });
 
 NLOHMANN_JSON_SERIALIZE_ENUM(ParameterValueType,
@@ -66,6 +68,9 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ProfilingCounterType,
 void to_json(json& j, const TunerMetadata& metadata);
 void from_json(const json& j, TunerMetadata& metadata);
 
+void to_json(json& j, const TimerCalibration& calibration);
+void from_json(const json& j, TimerCalibration& calibration);
+
 void to_json(json& j, const ParameterPair& pair);
 void from_json(const json& j, ParameterPair& pair);
 
@@ -84,6 +89,9 @@ void from_json(const json& j, KernelCompilationData& data);
 void to_json(json& j, const KernelProfilingData& data);
 void from_json(const json& j, KernelProfilingData& data);
 
+void to_json(json& j, const MeasurementStatistics& statistics);
+void from_json(const json& j, MeasurementStatistics& statistics);
+
 void to_json(json& j, const ComputationResult& result);
 void from_json(const json& j, ComputationResult& result);
 
@@ -66,6 +66,11 @@ void TunerMetadata::SetTimeUnit(const TimeUnit unit)
     m_TimeUnit = unit;
 }
 
+void TunerMetadata::SetTimerCalibration(const TimerCalibration& calibration)
+{
+    m_TimerCalibration = calibration;
+}
+
 ComputeApi TunerMetadata::GetComputeApi() const
 {
     return m_ComputeApi;
@@ -101,4 +106,9 @@ TimeUnit TunerMetadata::GetTimeUnit() const
     return m_TimeUnit;
 }
 
+const TimerCalibration& TunerMetadata::GetTimerCalibration() const
+{
+    return m_TimerCalibration;
+}
+
 } // namespace ktt
@@ -5,6 +5,7 @@
 #include <ComputeEngine/ComputeApi.h>
 #include <ComputeEngine/GlobalSizeType.h>
 #include <Output/TimeConfiguration/TimeUnit.h>
+#include <Utility/Timer/TimerCalibration.h>
 
 namespace ktt
 {
@@ -24,6 +25,7 @@ public:
     void SetKttVersion(const std::string& version);
     void SetTimestamp(const std::string& timestamp);
     void SetTimeUnit(const TimeUnit unit);
+    void SetTimerCalibration(const TimerCalibration& calibration);
 
     ComputeApi GetComputeApi() const;
     GlobalSizeType GetGlobalSizeType() const;
@@ -32,6 +34,7 @@ public:
     const std::string& GetKttVersion() const;
     const std::string& GetTimestamp() const;
     TimeUnit GetTimeUnit() const;
+    const TimerCalibration& GetTimerCalibration() const;
 
 private:
     ComputeApi m_ComputeApi;
@@ -41,6 +44,7 @@ private:
     std::string m_KttVersion;
     std::string m_Timestamp;
     TimeUnit m_TimeUnit;
+    TimerCalibration m_TimerCalibration;
 };
 
 } // namespace ktt
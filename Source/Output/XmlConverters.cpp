@@ -17,6 +17,8 @@ std::string ComputeApiToString(const ComputeApi api)
         return "CUDA";
     case ComputeApi::Vulkan:
         return "Vulkan";
+    case ComputeApi::Host:
+        return "Host";
     default:
         KttError("Unhandled value");
         return "";
@@ -71,6 +73,8 @@ std::string ResultStatusToString(const ResultStatus status)
         return "CompilationFailed";
     case ResultStatus::DeviceLimitsExceeded:
         return "DeviceLimitsExceeded";
+    case ResultStatus::Timeout:
+        return "Timeout";
     default:
         KttError("Unhandled value");
         return "";
@@ -133,6 +137,10 @@ ComputeApi ComputeApiFromString(const std::string& string)
     {
         return ComputeApi::Vulkan;
     }
+    else if (string == "Host")
+    {
+        return ComputeApi::Host;
+    }
 
     KttError("Invalid string value");
     return ComputeApi::OpenCL;
@@ -202,6 +210,10 @@ ResultStatus ResultStatusFromString(const std::string& string)
     {
         return ResultStatus::DeviceLimitsExceeded;
     }
+    else if (string == "Timeout")
+    {
+        return ResultStatus::Timeout;
+    }
 
     KttError("Invalid string value");
     return ResultStatus::Ok;
@@ -279,6 +291,11 @@ void AppendMetadata(pugi::xml_node parent, const TunerMetadata& metadata)
     node.append_attribute("KttVersion").set_value(metadata.GetKttVersion().c_str());
     node.append_attribute("Timestamp").set_value(metadata.GetTimestamp().c_str());
     node.append_attribute("TimeUnit").set_value(TimeUnitToString(metadata.GetTimeUnit()).c_str());
+
+    if (metadata.GetTimerCalibration().IsValid())
+    {
+        AppendTimerCalibration(node, metadata.GetTimerCalibration());
+    }
 }
 
 TunerMetadata ParseMetadata(const pugi::xml_node node)
@@ -293,9 +310,43 @@ TunerMetadata ParseMetadata(const pugi::xml_node node)
     metadata.SetTimestamp(node.attribute("Timestamp").value());
     metadata.SetTimeUnit(TimeUnitFromString(node.attribute("TimeUnit").value()));
 
+    if (const auto calibrationNode = node.child("TimerCalibration"); calibrationNode)
+    {
+        metadata.SetTimerCalibration(ParseTimerCalibration(calibrationNode));
+    }
+
     return metadata;
 }
 
+void AppendTimerCalibration(pugi::xml_node parent, const TimerCalibration& calibration)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    pugi::xml_node node = parent.append_child("TimerCalibration");
+    node.append_attribute("LaunchOverhead").set_value(time.ConvertFromNanosecondsDouble(calibration.GetLaunchOverhead()),
+        xmlFloatingPointPrecision);
+    node.append_attribute("EventTimingOverhead").set_value(time.ConvertFromNanosecondsDouble(calibration.GetEventTimingOverhead()),
+        xmlFloatingPointPrecision);
+    node.append_attribute("TimerOverhead").set_value(time.ConvertFromNanosecondsDouble(calibration.GetTimerOverhead()),
+        xmlFloatingPointPrecision);
+    node.append_attribute("TimerResolution").set_value(time.ConvertFromNanosecondsDouble(calibration.GetTimerResolution()),
+        xmlFloatingPointPrecision);
+}
+
+TimerCalibration ParseTimerCalibration(const pugi::xml_node node)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+    TimerCalibration calibration;
+
+    calibration.SetLaunchOverhead(time.ConvertToNanosecondsDouble(node.attribute("LaunchOverhead").as_double()));
+    calibration.SetEventTimingOverhead(time.ConvertToNanosecondsDouble(node.attribute("EventTimingOverhead").as_double()));
+    calibration.SetTimerOverhead(time.ConvertToNanosecondsDouble(node.attribute("TimerOverhead").as_double()));
+    calibration.SetTimerResolution(time.ConvertToNanosecondsDouble(node.attribute("TimerResolution").as_double()));
+    calibration.SetValid(true);
+
+    return calibration;
+}
+
 void AppendUserData(pugi::xml_node parent, const UserData& data)
 {
     pugi::xml_node node = parent.append_child("UserData");
@@ -553,6 +604,44 @@ KernelProfilingData ParseProfilingData(const pugi::xml_node node)
     return KernelProfilingData(remainingRuns);
 }
 
+void AppendMeasurementStatistics(pugi::xml_node parent, const MeasurementStatistics& statistics)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+
+    pugi::xml_node node = parent.append_child("MeasurementStatistics");
+    node.append_attribute("Median").set_value(time.ConvertFromNanosecondsDouble(statistics.m_Median), xmlFloatingPointPrecision);
+    node.append_attribute("Minimum").set_value(time.ConvertFromNanosecondsDouble(statistics.m_Minimum), xmlFloatingPointPrecision);
+    node.append_attribute("StandardDeviation").set_value(time.ConvertFromNanosecondsDouble(
+        static_cast<Nanoseconds>(statistics.m_StandardDeviation)), xmlFloatingPointPrecision);
+    node.append_attribute("ConfidenceIntervalLower").set_value(time.ConvertFromNanosecondsDouble(statistics.m_ConfidenceIntervalLower),
+        xmlFloatingPointPrecision);
+    node.append_attribute("ConfidenceIntervalUpper").set_value(time.ConvertFromNanosecondsDouble(statistics.m_ConfidenceIntervalUpper),
+        xmlFloatingPointPrecision);
+    node.append_attribute("RunCount").set_value(statistics.m_RunCount);
+    node.append_attribute("WarmupRunCount").set_value(statistics.m_WarmupRunCount);
+    node.append_attribute("EarlyAborted").set_value(statistics.m_EarlyAborted);
+    node.append_attribute("RepetitionOverhead").set_value(time.ConvertFromNanosecondsDouble(statistics.m_RepetitionOverhead),
+        xmlFloatingPointPrecision);
+}
+
+MeasurementStatistics ParseMeasurementStatistics(const pugi::xml_node node)
+{
+    const auto& time = TimeConfiguration::GetInstance();
+    MeasurementStatistics statistics;
+
+    statistics.m_Median = time.ConvertToNanosecondsDouble(node.attribute("Median").as_double());
+    statistics.m_Minimum = time.ConvertToNanosecondsDouble(node.attribute("Minimum").as_double());
+    statistics.m_StandardDeviation = static_cast<double>(time.ConvertToNanosecondsDouble(node.attribute("StandardDeviation").as_double()));
+    statistics.m_ConfidenceIntervalLower = time.ConvertToNanosecondsDouble(node.attribute("ConfidenceIntervalLower").as_double());
+    statistics.m_ConfidenceIntervalUpper = time.ConvertToNanosecondsDouble(node.attribute("ConfidenceIntervalUpper").as_double());
+    statistics.m_RunCount = node.attribute("RunCount").as_ullong();
+    statistics.m_WarmupRunCount = node.attribute("WarmupRunCount").as_ullong();
+    statistics.m_EarlyAborted = node.attribute("EarlyAborted").as_bool();
+    statistics.m_RepetitionOverhead = time.ConvertToNanosecondsDouble(node.attribute("RepetitionOverhead").as_double());
+
+    return statistics;
+}
+
 void AppendComputationResult(pugi::xml_node parent, const ComputationResult& result)
 {
     const auto& time = TimeConfiguration::GetInstance();
@@ -652,6 +741,23 @@ void AppendKernelResult(pugi::xml_node parent, const KernelResult& result)
         xmlFloatingPointPrecision);
     node.append_attribute("ProfilingOverhead").set_value(time.ConvertFromNanosecondsDouble(result.GetProfilingTotalOverhead()),
         xmlFloatingPointPrecision);
+
+    if (result.HasTuningDevice())
+    {
+        node.append_attribute("TuningDevice").set_value(result.GetTuningDevice());
+    }
+
+    if (result.GetCalibrationOverhead() != 0)
+    {
+        node.append_attribute("CalibrationOverhead").set_value(time.ConvertFromNanosecondsDouble(result.GetCalibrationOverhead()),
+            xmlFloatingPointPrecision);
+    }
+
+    if (result.GetDriftCorrection() != 1.0)
+    {
+        node.append_attribute("DriftCorrection").set_value(result.GetDriftCorrection(), xmlFloatingPointPrecision);
+    }
+
     AppendConfiguration(node, result.GetConfiguration());
 
     pugi::xml_node computationResults = node.append_child("ComputationResults");
@@ -660,6 +766,11 @@ void AppendKernelResult(pugi::xml_node parent, const KernelResult& result)
     {
         AppendComputationResult(computationResults, computationResult);
     }
+
+    if (result.HasMeasurementStatistics())
+    {
+        AppendMeasurementStatistics(node, result.GetMeasurementStatistics());
+    }
 }
 
 KernelResult ParseKernelResult(const pugi::xml_node node)
@@ -697,6 +808,34 @@ KernelResult ParseKernelResult(const pugi::xml_node node)
     const Nanoseconds searcherOverheadNs = time.ConvertToNanosecondsDouble(searcherOverhead);
     result.SetSearcherOverhead(searcherOverheadNs);
 
+    const auto statisticsNode = node.child("MeasurementStatistics");
+
+    if (!statisticsNode.empty())
+    {
+        result.SetMeasurementStatistics(ParseMeasurementStatistics(statisticsNode));
+    }
+
+    const auto tuningDevice = node.attribute("TuningDevice");
+
+    if (!tuningDevice.empty())
+    {
+        result.SetTuningDevice(static_cast<DeviceIndex>(tuningDevice.as_uint()));
+    }
+
+    const auto calibrationOverhead = node.attribute("CalibrationOverhead");
+
+    if (!calibrationOverhead.empty())
+    {
+        result.SetCalibrationOverhead(time.ConvertToNanosecondsDouble(calibrationOverhead.as_double()));
+    }
+
+    const auto driftCorrection = node.attribute("DriftCorrection");
+
+    if (!driftCorrection.empty())
+    {
+        result.SetDriftCorrection(driftCorrection.as_double());
+    }
+
     return result;
 }
 
@@ -29,6 +29,9 @@ ProfilingCounterType ProfilingCounterTypeFromString(const std::string& string);
 void AppendMetadata(pugi::xml_node parent, const TunerMetadata& metadata);
 TunerMetadata ParseMetadata(const pugi::xml_node node);
 
+void AppendTimerCalibration(pugi::xml_node parent, const TimerCalibration& calibration);
+TimerCalibration ParseTimerCalibration(const pugi::xml_node node);
+
 void AppendUserData(pugi::xml_node parent, const UserData& data);
 UserData ParseUserData(const pugi::xml_node node);
 
@@ -50,6 +53,9 @@ KernelCompilationData ParseCompilationData(const pugi::xml_node node);
 void AppendProfilingData(pugi::xml_node parent, const KernelProfilingData& data);
 KernelProfilingData ParseProfilingData(const pugi::xml_node node);
 
+void AppendMeasurementStatistics(pugi::xml_node parent, const MeasurementStatistics& statistics);
+MeasurementStatistics ParseMeasurementStatistics(const pugi::xml_node node);
+
 void AppendComputationResult(pugi::xml_node parent, const ComputationResult& result);
 ComputationResult ParseComputationResult(const pugi::xml_node node);
 
@@ -145,6 +145,45 @@ void InitializePythonDataHolders(py::module_& module)
         .def_readwrite("m_ConstantMemorySize", &ktt::KernelCompilationData::m_ConstantMemorySize)
         .def_readwrite("m_RegistersCount", &ktt::KernelCompilationData::m_RegistersCount);
 
+    py::class_<ktt::KernelCacheStatistics>(module, "KernelCacheStatistics")
+        .def(py::init<>())
+        .def("GetHitRate", &ktt::KernelCacheStatistics::GetHitRate)
+        .def("Merge", &ktt::KernelCacheStatistics::Merge)
+        .def_readwrite("m_HitCount", &ktt::KernelCacheStatistics::m_HitCount)
+        .def_readwrite("m_MissCount", &ktt::KernelCacheStatistics::m_MissCount)
+        .def_readwrite("m_EvictionCount", &ktt::KernelCacheStatistics::m_EvictionCount)
+        .def_readwrite("m_EntryCount", &ktt::KernelCacheStatistics::m_EntryCount)
+        .def_readwrite("m_MemorySize", &ktt::KernelCacheStatistics::m_MemorySize);
+
+    py::class_<ktt::TransferStatistics>(module, "TransferStatistics")
+        .def(py::init<>())
+        .def("GetUploadThroughput", &ktt::TransferStatistics::GetUploadThroughput)
+        .def("GetDownloadThroughput", &ktt::TransferStatistics::GetDownloadThroughput)
+        .def("Merge", &ktt::TransferStatistics::Merge)
+        .def_readwrite("m_UploadCount", &ktt::TransferStatistics::m_UploadCount)
+        .def_readwrite("m_UploadedBytes", &ktt::TransferStatistics::m_UploadedBytes)
+        .def_readwrite("m_UploadTime", &ktt::TransferStatistics::m_UploadTime)
+        .def_readwrite("m_DownloadCount", &ktt::TransferStatistics::m_DownloadCount)
+        .def_readwrite("m_DownloadedBytes", &ktt::TransferStatistics::m_DownloadedBytes)
+        .def_readwrite("m_DownloadTime", &ktt::TransferStatistics::m_DownloadTime)
+        .def_readwrite("m_StagedTransferCount", &ktt::TransferStatistics::m_StagedTransferCount)
+        .def_readwrite("m_StagingAllocationCount", &ktt::TransferStatistics::m_StagingAllocationCount)
+        .def_readwrite("m_StagingReuseCount", &ktt::TransferStatistics::m_StagingReuseCount)
+        .def_readwrite("m_StagingMemorySize", &ktt::TransferStatistics::m_StagingMemorySize);
+
+    py::class_<ktt::MeasurementStatistics>(module, "MeasurementStatistics")
+        .def(py::init<>())
+        .def("GetRelativeConfidenceIntervalWidth", &ktt::MeasurementStatistics::GetRelativeConfidenceIntervalWidth)
+        .def_readwrite("m_Median", &ktt::MeasurementStatistics::m_Median)
+        .def_readwrite("m_Minimum", &ktt::MeasurementStatistics::m_Minimum)
+        .def_readwrite("m_StandardDeviation", &ktt::MeasurementStatistics::m_StandardDeviation)
+        .def_readwrite("m_ConfidenceIntervalLower", &ktt::MeasurementStatistics::m_ConfidenceIntervalLower)
+        .def_readwrite("m_ConfidenceIntervalUpper", &ktt::MeasurementStatistics::m_ConfidenceIntervalUpper)
+        .def_readwrite("m_RunCount", &ktt::MeasurementStatistics::m_RunCount)
+        .def_readwrite("m_WarmupRunCount", &ktt::MeasurementStatistics::m_WarmupRunCount)
+        .def_readwrite("m_EarlyAborted", &ktt::MeasurementStatistics::m_EarlyAborted)
+        .def_readwrite("m_RepetitionOverhead", &ktt::MeasurementStatistics::m_RepetitionOverhead);
+
     py::class_<ktt::KernelProfilingCounter>(module, "KernelProfilingCounter")
         .def(py::init<>())
         .def(py::init<const std::string&, const ktt::ProfilingCounterType, const int64_t>())
@@ -205,6 +244,11 @@ void InitializePythonDataHolders(py::module_& module)
         .def("SetDataMovementOverhead", &ktt::KernelResult::SetDataMovementOverhead)
         .def("SetValidationOverhead", &ktt::KernelResult::SetValidationOverhead)
         .def("SetSearcherOverhead", &ktt::KernelResult::SetSearcherOverhead)
+        .def("SetCalibrationOverhead", &ktt::KernelResult::SetCalibrationOverhead)
+        .def("SetMeasurementStatistics", &ktt::KernelResult::SetMeasurementStatistics)
+        .def("SetTuningDevice", &ktt::KernelResult::SetTuningDevice)
+        .def("SetDriftCorrection", &ktt::KernelResult::SetDriftCorrection)
+        .def("ApplyDriftCorrection", &ktt::KernelResult::ApplyDriftCorrection)
         .def("GetKernelName", &ktt::KernelResult::GetKernelName, py::return_value_policy::reference)
         .def("GetResults", &ktt::KernelResult::GetResults, py::return_value_policy::reference)
         .def("GetConfiguration", &ktt::KernelResult::GetConfiguration, py::return_value_policy::reference)
@@ -215,8 +259,14 @@ void InitializePythonDataHolders(py::module_& module)
         .def("GetDataMovementOverhead", &ktt::KernelResult::GetDataMovementOverhead)
         .def("GetValidationOverhead", &ktt::KernelResult::GetValidationOverhead)
         .def("GetSearcherOverhead", &ktt::KernelResult::GetSearcherOverhead)
+        .def("GetCalibrationOverhead", &ktt::KernelResult::GetCalibrationOverhead)
         .def("GetTotalDuration", &ktt::KernelResult::GetTotalDuration)
         .def("GetTotalOverhead", &ktt::KernelResult::GetTotalOverhead)
+        .def("HasMeasurementStatistics", &ktt::KernelResult::HasMeasurementStatistics)
+        .def("GetMeasurementStatistics", &ktt::KernelResult::GetMeasurementStatistics, py::return_value_policy::reference)
+        .def("HasTuningDevice", &ktt::KernelResult::HasTuningDevice)
+        .def("GetTuningDevice", &ktt::KernelResult::GetTuningDevice)
+        .def("GetDriftCorrection", &ktt::KernelResult::GetDriftCorrection)
         .def("IsValid", &ktt::KernelResult::IsValid)
         .def("HasRemainingProfilingRuns", &ktt::KernelResult::HasRemainingProfilingRuns);
 }
@@ -48,7 +48,8 @@ void InitializePythonEnums(py::module_& module)
     py::enum_<ktt::ComputeApi>(module, "ComputeApi")
         .value("OpenCL", ktt::ComputeApi::OpenCL)
         .value("CUDA", ktt::ComputeApi::CUDA)
-        .value("Vulkan", ktt::ComputeApi::Vulkan);
+        .value("Vulkan", ktt::ComputeApi::Vulkan)
+        .value("Host", ktt::ComputeApi::Host);
 
     py::enum_<ktt::DeviceType>(module, "DeviceType")
         .value("CPU", ktt::DeviceType::CPU)
@@ -65,6 +66,10 @@ void InitializePythonEnums(py::module_& module)
         .value("CUDA", ktt::GlobalSizeType::CUDA)
         .value("Vulkan", ktt::GlobalSizeType::Vulkan);
 
+    py::enum_<ktt::KernelCachePolicy>(module, "KernelCachePolicy")
+        .value("LeastRecentlyUsed", ktt::KernelCachePolicy::LeastRecentlyUsed)
+        .value("SegmentedLeastRecentlyUsed", ktt::KernelCachePolicy::SegmentedLeastRecentlyUsed);
+
     py::enum_<ktt::KernelRunMode>(module, "KernelRunMode")
         .value("Running", ktt::KernelRunMode::Running)
         .value("OfflineTuning", ktt::KernelRunMode::OfflineTuning)
@@ -119,7 +124,8 @@ void InitializePythonEnums(py::module_& module)
         .value("ComputationFailed", ktt::ResultStatus::ComputationFailed)
         .value("ValidationFailed", ktt::ResultStatus::ValidationFailed)
         .value("CompilationFailed", ktt::ResultStatus::CompilationFailed)
-        .value("DeviceLimitsExceeded", ktt::ResultStatus::DeviceLimitsExceeded);
+        .value("DeviceLimitsExceeded", ktt::ResultStatus::DeviceLimitsExceeded)
+        .value("Timeout", ktt::ResultStatus::Timeout);
 
     py::enum_<ktt::TimeUnit>(module, "TimeUnit")
         .value("Nanoseconds", ktt::TimeUnit::Nanoseconds)
@@ -127,10 +133,18 @@ void InitializePythonEnums(py::module_& module)
         .value("Milliseconds", ktt::TimeUnit::Milliseconds)
         .value("Seconds", ktt::TimeUnit::Seconds);
 
+    py::enum_<ktt::TuningObjective>(module, "TuningObjective")
+        .value("TotalDuration", ktt::TuningObjective::TotalDuration)
+        .value("KernelDuration", ktt::TuningObjective::KernelDuration)
+        .value("CompilationOverhead", ktt::TuningObjective::CompilationOverhead)
+        .value("EnergyConsumption", ktt::TuningObjective::EnergyConsumption);
+
     py::enum_<ktt::ValidationMethod>(module, "ValidationMethod")
         .value("AbsoluteDifference", ktt::ValidationMethod::AbsoluteDifference)
         .value("SideBySideComparison", ktt::ValidationMethod::SideBySideComparison)
-        .value("SideBySideRelativeComparison", ktt::ValidationMethod::SideBySideRelativeComparison);
+        .value("SideBySideRelativeComparison", ktt::ValidationMethod::SideBySideRelativeComparison)
+        .value("SampledComparison", ktt::ValidationMethod::SampledComparison)
+        .value("BlockChecksumComparison", ktt::ValidationMethod::BlockChecksumComparison);
 
     py::enum_<ktt::ValidationMode>(module, "ValidationMode", py::arithmetic())
         .value("None", ktt::ValidationMode::None)
@@ -31,6 +31,11 @@ public:
     {
         PYBIND11_OVERRIDE_PURE(ktt::KernelConfiguration, ktt::Searcher, GetCurrentConfiguration);
     }
+
+    std::vector<ktt::KernelConfiguration> GetUpcomingConfigurations(const size_t count) const override
+    {
+        PYBIND11_OVERRIDE(std::vector<ktt::KernelConfiguration>, ktt::Searcher, GetUpcomingConfigurations, count);
+    }
 };
 
 void InitializePythonSearchers(py::module_& module)
@@ -41,6 +46,7 @@ void InitializePythonSearchers(py::module_& module)
         .def("OnReset", &ktt::Searcher::OnReset)
         .def("CalculateNextConfiguration", &ktt::Searcher::CalculateNextConfiguration)
         .def("GetCurrentConfiguration", &ktt::Searcher::GetCurrentConfiguration)
+        .def("GetUpcomingConfigurations", &ktt::Searcher::GetUpcomingConfigurations)
         .def("GetIndex", &ktt::Searcher::GetIndex)
         .def("GetConfiguration", &ktt::Searcher::GetConfiguration)
         .def("GetRandomConfiguration", &ktt::Searcher::GetRandomConfiguration)
@@ -55,6 +61,8 @@ void InitializePythonSearchers(py::module_& module)
         .def("GetConfigurationsCount", &ktt::Searcher::GetConfigurationsCount)
         .def("GetUnexploredConfigurationsCount", &ktt::Searcher::GetUnexploredConfigurationsCount)
         .def("GetExploredIndices", &ktt::Searcher::GetExploredIndices, py::return_value_policy::reference)
+        .def("GetObjectiveValues", &ktt::Searcher::GetObjectiveValues)
+        .def("GetParetoFront", &ktt::Searcher::GetParetoFront)
         .def("IsInitialized", &ktt::Searcher::IsInitialized);
 
     py::class_<ktt::DeterministicSearcher, ktt::Searcher>(module, "DeterministicSearcher")
@@ -65,6 +73,9 @@ void InitializePythonSearchers(py::module_& module)
 
     py::class_<ktt::RandomSearcher, ktt::Searcher>(module, "RandomSearcher")
         .def(py::init<>());
+
+    py::class_<ktt::ParetoSearcher, ktt::Searcher>(module, "ParetoSearcher")
+        .def(py::init<const size_t, const double>(), py::arg("populationSize") = 20, py::arg("mutationProbability") = 0.1);
 }
 
 #endif // KTT_PYTHON
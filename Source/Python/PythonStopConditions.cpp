@@ -53,6 +53,15 @@ void InitializePythonStopConditions(py::module_& module)
 
     py::class_<ktt::TuningDuration, ktt::StopCondition>(module, "TuningDuration")
         .def(py::init<const double>());
+
+    py::class_<ktt::ConvergenceCondition, ktt::StopCondition>(module, "ConvergenceCondition")
+        .def(py::init<const double, const uint64_t, const double, const uint64_t>(), py::arg("improvementThreshold"),
+            py::arg("configurationWindow"), py::arg("timeWindow") = 0.0, py::arg("minimumEvaluations") = 0);
+
+    py::class_<ktt::PredictiveTuningDuration, ktt::StopCondition>(module, "PredictiveTuningDuration")
+        .def(py::init<const double, const double>(), py::arg("duration"), py::arg("safetyFactor") = 1.0)
+        .def("GetPredictedEvaluationTime", &ktt::PredictiveTuningDuration::GetPredictedEvaluationTime)
+        .def("GetPredictedRemainingCount", &ktt::PredictiveTuningDuration::GetPredictedRemainingCount);
 }
 
 #endif // KTT_PYTHON
@@ -15,6 +15,10 @@ void InitializePythonTuner(py::module_& module)
     py::class_<ktt::Tuner>(module, "Tuner")
         .def(py::init<const ktt::PlatformIndex, const ktt::DeviceIndex, const ktt::ComputeApi>())
         .def(py::init<const ktt::PlatformIndex, const ktt::DeviceIndex, const ktt::ComputeApi, const uint32_t>())
+        .def(py::init<const ktt::PlatformIndex, const std::vector<ktt::DeviceIndex>&, const ktt::ComputeApi, const uint32_t>(),
+            py::arg("platform"), py::arg("devices"), py::arg("api"), py::arg("subDeviceCount") = 0)
+        .def(py::init<const std::string&, const ktt::OutputFormat, const bool>(), py::arg("resultsFile"), py::arg("format"),
+            py::arg("virtualClock") = true)
         .def
         (
             "AddKernelDefinition",
@@ -439,14 +443,29 @@ void InitializePythonTuner(py::module_& module)
         )
         .def("RemoveArgument", &ktt::Tuner::RemoveArgument)
         .def("SetReadOnlyArgumentCache", &ktt::Tuner::SetReadOnlyArgumentCache)
+        .def("SetReadWriteArgumentSnapshot", &ktt::Tuner::SetReadWriteArgumentSnapshot)
         .def("Run", py::overload_cast<const ktt::KernelId, const ktt::KernelConfiguration&,
             const std::vector<ktt::BufferOutputDescriptor>&>(&ktt::Tuner::Run))
         .def("Run", py::overload_cast<const ktt::KernelId, const ktt::KernelConfiguration&, const ktt::KernelDimensions&,
             const std::vector<ktt::BufferOutputDescriptor>&>(&ktt::Tuner::Run))
+        .def("RunAsync", py::overload_cast<const ktt::KernelId, const ktt::KernelConfiguration&,
+            const std::vector<ktt::BufferOutputDescriptor>&, ktt::OutputCallback>(&ktt::Tuner::RunAsync), py::arg("id"),
+            py::arg("configuration"), py::arg("output"), py::arg("callback") = nullptr)
+        .def("RunAsync", py::overload_cast<const ktt::KernelId, const ktt::KernelConfiguration&, const ktt::KernelDimensions&,
+            const std::vector<ktt::BufferOutputDescriptor>&, ktt::OutputCallback>(&ktt::Tuner::RunAsync), py::arg("id"),
+            py::arg("configuration"), py::arg("dimensions"), py::arg("output"), py::arg("callback") = nullptr)
+        .def("WaitForOutputs", &ktt::Tuner::WaitForOutputs)
         .def("SetProfiling", &ktt::Tuner::SetProfiling)
+        .def("SetMeasurementPolicy", &ktt::Tuner::SetMeasurementPolicy, py::arg("warmupRuns"), py::arg("minimumRuns"),
+            py::arg("maximumRuns"), py::arg("targetRelativeWidth"))
+        .def("SetRacing", &ktt::Tuner::SetRacing, py::arg("flag"), py::arg("minimumRuns") = 3)
+        .def("CalibrateTimer", &ktt::Tuner::CalibrateTimer)
         .def("SetProfilingCounters", &ktt::Tuner::SetProfilingCounters)
         .def("SetValidationMethod", &ktt::Tuner::SetValidationMethod)
         .def("SetValidationMode", &ktt::Tuner::SetValidationMode)
+        .def("SetValidationSampleCount", &ktt::Tuner::SetValidationSampleCount)
+        .def("SetReferenceResultCache", &ktt::Tuner::SetReferenceResultCache, py::arg("directory"),
+            py::arg("referenceVersion") = "")
         .def("SetValidationRange", &ktt::Tuner::SetValidationRange)
         .def("SetValueComparator", &ktt::Tuner::SetValueComparator)
         .def
@@ -491,6 +510,51 @@ void InitializePythonTuner(py::module_& module)
             py::arg("stopCondition") = nullptr
         )
         .def
+        (
+            "TuneDistributed",
+            &ktt::Tuner::TuneDistributed,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id"),
+            py::arg("port"),
+            py::arg("leaseTimeout"),
+            py::arg("stopCondition") = nullptr
+        )
+        .def
+        (
+            "RunTuningWorker",
+            py::overload_cast<const ktt::KernelId, const std::string&, const uint16_t>(&ktt::Tuner::RunTuningWorker),
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id"),
+            py::arg("host"),
+            py::arg("port")
+        )
+        .def
+        (
+            "RunTuningWorker",
+            py::overload_cast<const ktt::KernelId, const ktt::KernelDimensions&, const std::string&, const uint16_t>(
+                &ktt::Tuner::RunTuningWorker),
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id"),
+            py::arg("dimensions"),
+            py::arg("host"),
+            py::arg("port")
+        )
+        .def
+        (
+            "RunSandboxWorker",
+            py::overload_cast<const ktt::KernelId>(&ktt::Tuner::RunSandboxWorker),
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id")
+        )
+        .def
+        (
+            "RunSandboxWorker",
+            py::overload_cast<const ktt::KernelId, const ktt::KernelDimensions&>(&ktt::Tuner::RunSandboxWorker),
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id"),
+            py::arg("dimensions")
+        )
+        .def
         (
             "TuneIteration",
             py::overload_cast<const ktt::KernelId, const std::vector<ktt::BufferOutputDescriptor>&, const bool>(&ktt::Tuner::TuneIteration),
@@ -519,9 +583,26 @@ void InitializePythonTuner(py::module_& module)
             py::arg("results"),
             py::arg("stopCondition") = nullptr
         )
+        .def
+        (
+            "Precompile",
+            &ktt::Tuner::Precompile,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("id"),
+            py::arg("startIndex") = 0,
+            py::arg("endIndex") = std::numeric_limits<uint64_t>::max()
+        )
         .def("SetSearcher", &ktt::Tuner::SetSearcher)
         .def("SetProfileBasedSearcher", &ktt::Tuner::SetProfileBasedSearcher)
         .def
+        (
+            "SetTuningObjectives",
+            &ktt::Tuner::SetTuningObjectives,
+            py::arg("id"),
+            py::arg("objectives"),
+            py::arg("scalarization") = nullptr
+        )
+        .def
         (
             "InitializeConfigurationData",
             &ktt::Tuner::InitializeConfigurationData,
@@ -531,6 +612,7 @@ void InitializePythonTuner(py::module_& module)
         .def("ClearData", &ktt::Tuner::ClearConfigurationData)
         .def("GetConfigurationsCount", &ktt::Tuner::GetConfigurationsCount)
         .def("GetBestConfiguration", &ktt::Tuner::GetBestConfiguration)
+        .def("GetParetoFront", &ktt::Tuner::GetParetoFront)
         .def("CreateConfiguration", &ktt::Tuner::CreateConfiguration)
         .def("GetKernelSource", &ktt::Tuner::GetKernelSource)
         .def("GetKernelDefinitionSource", &ktt::Tuner::GetKernelDefinitionSource)
@@ -572,6 +654,29 @@ void InitializePythonTuner(py::module_& module)
         .def("SetGlobalSizeType", &ktt::Tuner::SetGlobalSizeType)
         .def("SetAutomaticGlobalSizeCorrection", &ktt::Tuner::SetAutomaticGlobalSizeCorrection)
         .def("SetKernelCacheCapacity", &ktt::Tuner::SetKernelCacheCapacity)
+        .def("SetKernelCacheMemoryLimit", &ktt::Tuner::SetKernelCacheMemoryLimit)
+        .def("SetKernelCachePolicy", &ktt::Tuner::SetKernelCachePolicy)
+        .def("GetKernelCacheStatistics", &ktt::Tuner::GetKernelCacheStatistics)
+        .def("SetCompilationLookahead", &ktt::Tuner::SetCompilationLookahead)
+        .def
+        (
+            "SetSandboxedExecution",
+            &ktt::Tuner::SetSandboxedExecution,
+            py::arg("flag"),
+            py::arg("timeoutFactor") = 10.0,
+            py::arg("minimumTimeout") = 10,
+            py::arg("workerArguments") = std::vector<std::string>{}
+        )
+        .def("SetOutlierDetection", &ktt::Tuner::SetOutlierDetection)
+        .def
+        (
+            "SetKernelBinaryCache",
+            &ktt::Tuner::SetKernelBinaryCache,
+            py::arg("directory"),
+            py::arg("maximumSize") = 0
+        )
+        .def("SetStagingMemoryLimit", &ktt::Tuner::SetStagingMemoryLimit)
+        .def("GetTransferStatistics", &ktt::Tuner::GetTransferStatistics)
         .def("GetPlatformInfo", &ktt::Tuner::GetPlatformInfo)
         .def("GetDeviceInfo", &ktt::Tuner::GetDeviceInfo)
         .def("GetCurrentDeviceInfo", &ktt::Tuner::GetCurrentDeviceInfo)
@@ -8,6 +8,7 @@
 #include <Utility/FileSystem.h>
 #include <Tuner.h>
 #include <TunerCore.h>
+#include <Api/Searcher/NativeProfileBasedSearcher.h>
 
 #ifdef KTT_PYTHON
 #include <Api/Searcher/ProfileBasedSearcher.h>
@@ -35,6 +36,15 @@ Tuner::Tuner(const ComputeApi api, const ComputeApiInitializer& initializer, std
     m_Tuner(std::make_unique<TunerCore>(api, initializer, assignedQueueIds))
 {}
 
+Tuner::Tuner(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+    const uint32_t subDeviceCount) :
+    m_Tuner(std::make_unique<TunerCore>(platform, devices, api, subDeviceCount))
+{}
+
+Tuner::Tuner(const std::string& resultsFile, const OutputFormat format, const bool virtualClock) :
+    m_Tuner(std::make_unique<TunerCore>(resultsFile, format, virtualClock))
+{}
+
 Tuner::~Tuner() = default;
 
 KernelDefinitionId Tuner::AddKernelDefinition(const std::string& name, const std::string& source, const DimensionVector& globalSize,
@@ -77,6 +87,25 @@ KernelDefinitionId Tuner::AddKernelDefinitionFromFile(const std::string& name, c
     return AddKernelDefinitionFromFile(name, filePath, DimensionVector(), DimensionVector(), typeNames);
 }
 
+KernelDefinitionId Tuner::AddHostKernelDefinition(const std::string& name, HostFunction function, const DimensionVector& globalSize,
+    const DimensionVector& localSize)
+{
+    try
+    {
+        return m_Tuner->AddHostKernelDefinition(name, function, globalSize, localSize);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return InvalidKernelDefinitionId;
+    }
+}
+
+KernelDefinitionId Tuner::AddHostKernelDefinition(const std::string& name, HostFunction function)
+{
+    return AddHostKernelDefinition(name, function, DimensionVector(), DimensionVector());
+}
+
 KernelDefinitionId Tuner::GetKernelDefinitionId(const std::string& name, const std::vector<std::string>& typeNames) const
 {
     try
@@ -393,6 +422,18 @@ void Tuner::SetReadOnlyArgumentCache(const bool flag)
     }
 }
 
+void Tuner::SetReadWriteArgumentSnapshot(const bool flag)
+{
+    try
+    {
+        m_Tuner->SetReadWriteArgumentSnapshot(flag);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 KernelResult Tuner::Run(const KernelId id, const KernelConfiguration& configuration,
     const std::vector<BufferOutputDescriptor>& output)
 {
@@ -413,6 +454,38 @@ KernelResult Tuner::Run(const KernelId id, const KernelConfiguration& configurat
     }
 }
 
+KernelResult Tuner::RunAsync(const KernelId id, const KernelConfiguration& configuration,
+    const std::vector<BufferOutputDescriptor>& output, OutputCallback callback)
+{
+    return RunAsync(id, configuration, {}, output, callback);
+}
+
+KernelResult Tuner::RunAsync(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+    const std::vector<BufferOutputDescriptor>& output, OutputCallback callback)
+{
+    try
+    {
+        return m_Tuner->RunKernelAsync(id, configuration, dimensions, output, callback);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return KernelResult();
+    }
+}
+
+void Tuner::WaitForOutputs()
+{
+    try
+    {
+        m_Tuner->WaitForOutputs();
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 void Tuner::SetProfiling(const bool flag)
 {
     try
@@ -430,6 +503,43 @@ bool Tuner::GetProfiling()
     return m_Tuner->GetProfiling();
 }
 
+void Tuner::SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+    const double targetRelativeWidth)
+{
+    try
+    {
+        m_Tuner->SetMeasurementPolicy(warmupRuns, minimumRuns, maximumRuns, targetRelativeWidth);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetRacing(const bool flag, const uint64_t minimumRuns)
+{
+    try
+    {
+        m_Tuner->SetRacing(flag, minimumRuns);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::CalibrateTimer()
+{
+    try
+    {
+        m_Tuner->CalibrateTimer();
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 
 void Tuner::SetValidationMethod(const ValidationMethod method, const double toleranceThreshold)
 {
@@ -455,6 +565,30 @@ void Tuner::SetValidationMode(const ValidationMode mode)
     }
 }
 
+void Tuner::SetValidationSampleCount(const size_t count)
+{
+    try
+    {
+        m_Tuner->SetValidationSampleCount(count);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetReferenceResultCache(const std::string& directory, const std::string& referenceVersion)
+{
+    try
+    {
+        m_Tuner->SetReferenceResultCache(directory, referenceVersion);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 void Tuner::SetValidationRange(const ArgumentId& id, const size_t range)
 {
     try
@@ -535,6 +669,57 @@ std::vector<KernelResult> Tuner::Tune(const KernelId id, const KernelDimensions&
     }
 }
 
+std::vector<KernelResult> Tuner::TuneDistributed(const KernelId id, const uint16_t port, const uint32_t leaseTimeout,
+    std::unique_ptr<StopCondition> stopCondition)
+{
+    try
+    {
+        return m_Tuner->TuneKernelDistributed(id, port, leaseTimeout, std::move(stopCondition));
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return std::vector<KernelResult>{};
+    }
+}
+
+uint64_t Tuner::RunTuningWorker(const KernelId id, const std::string& host, const uint16_t port)
+{
+    return RunTuningWorker(id, {}, host, port);
+}
+
+uint64_t Tuner::RunTuningWorker(const KernelId id, const KernelDimensions& dimensions, const std::string& host, const uint16_t port)
+{
+    try
+    {
+        return m_Tuner->RunTuningWorker(id, dimensions, host, port);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return 0;
+    }
+}
+
+bool Tuner::RunSandboxWorker(const KernelId id)
+{
+    return RunSandboxWorker(id, {});
+}
+
+bool Tuner::RunSandboxWorker(const KernelId id, const KernelDimensions& dimensions)
+{
+    try
+    {
+        return m_Tuner->RunSandboxWorker(id, dimensions);
+    }
+    catch (const KttException& exception)
+    {
+        // Worker process must not continue with tuning of the kernel after failure, parent process handles it as a crash
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return true;
+    }
+}
+
 KernelResult Tuner::TuneIteration(const KernelId id, const std::vector<BufferOutputDescriptor>& output,
     const bool recomputeReference)
 {
@@ -576,6 +761,18 @@ std::vector<KernelResult> Tuner::SimulateTuning(const KernelId id, const std::ve
     }
 }
 
+void Tuner::Precompile(const KernelId id, const uint64_t startIndex, const uint64_t endIndex)
+{
+    try
+    {
+        m_Tuner->Precompile(id, startIndex, endIndex);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 void Tuner::SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
 {
     try
@@ -588,12 +785,22 @@ void Tuner::SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
     }
 }
 
-void Tuner::SetProfileBasedSearcher([[maybe_unused]] const KernelId id, [[maybe_unused]] const std::string& modelPath, [[maybe_unused]] const bool useBuiltinModule, [[maybe_unused]] const uint batchSize, [[maybe_unused]] const uint neighborSize, [[maybe_unused]] const uint randomSize)
+void Tuner::SetProfileBasedSearcher(const KernelId id, const std::string& modelPath, [[maybe_unused]] const bool useBuiltinModule,
+    const uint batchSize, const uint neighborSize, const uint randomSize)
 {
     try
     {
+        if (useBuiltinModule && modelPath.size() >= 5 && modelPath.substr(modelPath.size() - 5) == ".json")
+        {
+            auto searcher = std::make_unique<NativeProfileBasedSearcher>(*this, m_Tuner->GetCurrentDeviceInfo(), modelPath,
+                batchSize, neighborSize, randomSize);
+            m_Tuner->SetSearcher(id, std::move(searcher));
+            return;
+        }
+
         #ifndef KTT_PYTHON
-        throw KttException("Usage of profile-based searcher requires compilation of Python backend");
+        throw KttException("Usage of profile-based searcher with pickled models requires compilation of Python backend, models "
+            "exported to JSON format can be used without it");
         #else
         if (useBuiltinModule)
         {
@@ -620,6 +827,19 @@ void Tuner::SetProfileBasedSearcher([[maybe_unused]] const KernelId id, [[maybe_
     #endif // KTT_PYTHON
 }
 
+void Tuner::SetTuningObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+    ObjectiveScalarization scalarization)
+{
+    try
+    {
+        m_Tuner->SetTuningObjectives(id, objectives, scalarization);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
 void Tuner::InitializeConfigurationData(const KernelId id)
 {
     try
@@ -677,6 +897,19 @@ KernelConfiguration Tuner::GetBestConfiguration(const KernelId id) const
     }
 }
 
+std::vector<KernelResult> Tuner::GetParetoFront(const KernelId id) const
+{
+    try
+    {
+        return m_Tuner->GetParetoFront(id);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return std::vector<KernelResult>{};
+    }
+}
+
 KernelConfiguration Tuner::CreateConfiguration(const KernelId id, const ParameterInput& parameters) const
 {
     try
@@ -903,6 +1136,117 @@ void Tuner::SetKernelCacheCapacity(const uint64_t capacity)
     }
 }
 
+void Tuner::SetKernelCacheMemoryLimit(const uint64_t limit)
+{
+    try
+    {
+        m_Tuner->SetKernelCacheMemoryLimit(limit);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetKernelCachePolicy(const KernelCachePolicy policy)
+{
+    try
+    {
+        m_Tuner->SetKernelCachePolicy(policy);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+KernelCacheStatistics Tuner::GetKernelCacheStatistics() const
+{
+    try
+    {
+        return m_Tuner->GetKernelCacheStatistics();
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return KernelCacheStatistics();
+    }
+}
+
+void Tuner::SetCompilationLookahead(const uint64_t count)
+{
+    try
+    {
+        m_Tuner->SetCompilationLookahead(count);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetSandboxedExecution(const bool flag, const double timeoutFactor, const uint32_t minimumTimeout,
+    const std::vector<std::string>& workerArguments)
+{
+    try
+    {
+        m_Tuner->SetSandboxedExecution(flag, timeoutFactor, minimumTimeout, workerArguments);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetOutlierDetection(const uint64_t sentinelInterval)
+{
+    try
+    {
+        m_Tuner->SetOutlierDetection(sentinelInterval);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize)
+{
+    try
+    {
+        m_Tuner->SetKernelBinaryCache(directory, maximumSize);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+void Tuner::SetStagingMemoryLimit(const uint64_t limit)
+{
+    try
+    {
+        m_Tuner->SetStagingMemoryLimit(limit);
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+    }
+}
+
+TransferStatistics Tuner::GetTransferStatistics() const
+{
+    try
+    {
+        return m_Tuner->GetTransferStatistics();
+    }
+    catch (const KttException& exception)
+    {
+        TunerCore::Log(LoggingLevel::Error, exception.what());
+        return TransferStatistics();
+    }
+}
+
 std::vector<PlatformInfo> Tuner::GetPlatformInfo() const
 {
     try
@@ -3,6 +3,7 @@
   */
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -14,6 +15,7 @@
 // Data types and enums
 #include <ComputeEngine/ComputeApi.h>
 #include <ComputeEngine/GlobalSizeType.h>
+#include <ComputeEngine/KernelCachePolicy.h>
 #include <Kernel/ModifierAction.h>
 #include <Kernel/ModifierDimension.h>
 #include <Kernel/ModifierType.h>
@@ -33,9 +35,12 @@
 #include <Api/Configuration/DimensionVector.h>
 #include <Api/Configuration/KernelConfiguration.h>
 #include <Api/Info/DeviceInfo.h>
+#include <Api/Info/KernelCacheStatistics.h>
 #include <Api/Info/PlatformInfo.h>
+#include <Api/Info/TransferStatistics.h>
 #include <Api/Output/BufferOutputDescriptor.h>
 #include <Api/Output/KernelResult.h>
+#include <Api/Output/TuningObjective.h>
 
 // Tuner customization
 #include <Api/Searcher/Searcher.h>
@@ -100,6 +105,40 @@ public:
       */
     explicit Tuner(const ComputeApi api, const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds);
 
+    /** @fn explicit Tuner(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+      * const uint32_t subDeviceCount = 0)
+      * Creates tuner which evaluates different configurations concurrently on multiple devices during offline tuning. Results from
+      * all devices are passed to a single searcher and each result is tagged with the device which produced it. The devices should
+      * be identical, otherwise the measured durations are not comparable. Regular kernel runs and tuning by iterations are
+      * performed only on the first device. Configurations for the other devices are taken from the upcoming configurations
+      * reported by searcher, see Searcher::GetUpcomingConfigurations() for more information. Among the built-in searchers, only
+      * DeterministicSearcher and RandomSearcher report them, with other searchers a warning is logged and configurations are
+      * evaluated on a single device at a time. User arguments and writable arguments in host zero-copy memory are not supported
+      * in this mode.
+      * @param platform Index for platform used by the tuner.
+      * @param devices Indices for devices used by the tuner. Has to contain at least one device.
+      * @param api Compute API used by the tuner.
+      * @param subDeviceCount If greater than zero, each device is partitioned into the specified number of sub-devices with equal
+      * number of compute units and the sub-devices are used for tuning instead of the whole devices. Only supported for OpenCL.
+      */
+    explicit Tuner(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+        const uint32_t subDeviceCount = 0);
+
+    /** @fn explicit Tuner(const std::string& resultsFile, const OutputFormat format, const bool virtualClock = true)
+      * Creates tuner which replays previously saved kernel results instead of running kernels on a device. Kernel runs return
+      * durations and profiling data recorded for the launched configuration and failed configurations fail again. Useful for
+      * evaluating searchers and stop conditions on large tuning spaces without access to the original device. Kernels, arguments
+      * and parameters have to be added the same way as during the recorded tuning. Arguments are not transferred and output is
+      * not computed, so output validation should not be used. Tuner time unit has to match the time unit of the results file and
+      * should be set with SetTimeUnit() method before the tuner is created.
+      * @param resultsFile File containing results saved with SaveResults() method. File extension is added automatically based
+      * on the specified format.
+      * @param format Format of the results file.
+      * @param virtualClock If true, time-based stop conditions measure replayed kernel durations and overheads instead of
+      * wall-clock time. The clock belongs to this tuner and it only affects tuning performed with this tuner.
+      */
+    explicit Tuner(const std::string& resultsFile, const OutputFormat format, const bool virtualClock = true);
+
     /** @fn ~Tuner()
       * Tuner destructor.
       */
@@ -155,6 +194,32 @@ public:
     KernelDefinitionId AddKernelDefinitionFromFile(const std::string& name, const std::string& filePath,
         const std::vector<std::string>& typeNames = {});
 
+    /** @fn KernelDefinitionId AddHostKernelDefinition(const std::string& name, HostFunction function,
+      * const DimensionVector& globalSize, const DimensionVector& localSize)
+      * Adds new kernel definition which is executed as C++ function on the host processor. Only supported in tuners which use
+      * host compute API.
+      * @param name Name of the kernel definition. The name must be unique.
+      * @param function Function which performs the kernel computation. It receives the current configuration and pointers to
+      * kernel arguments. See HostFunction for more information.
+      * @param globalSize Dimensions for base kernel global size. They are not interpreted by the tuner, but can be modified by
+      * parameters and are recorded in tuning results.
+      * @param localSize Dimensions for base kernel local size. They are not interpreted by the tuner, but can be modified by
+      * parameters and are recorded in tuning results.
+      * @return Id assigned to kernel definition by the tuner. The id can be used in other API methods.
+      */
+    KernelDefinitionId AddHostKernelDefinition(const std::string& name, HostFunction function, const DimensionVector& globalSize,
+        const DimensionVector& localSize);
+
+    /** @fn KernelDefinitionId AddHostKernelDefinition(const std::string& name, HostFunction function)
+      * Adds new kernel definition which is executed as C++ function on the host processor. Only supported in tuners which use
+      * host compute API.
+      * @param name Name of the kernel definition. The name must be unique.
+      * @param function Function which performs the kernel computation. It receives the current configuration and pointers to
+      * kernel arguments. See HostFunction for more information.
+      * @return Id assigned to kernel definition by the tuner. The id can be used in other API methods.
+      */
+    KernelDefinitionId AddHostKernelDefinition(const std::string& name, HostFunction function);
+
     /** @fn KernelDefinitionId GetKernelDefinitionId(const std::string& name, const std::vector<std::string>& typeNames = {}) const
       * Retrieves kernel definition id from the tuner based on provided name and template arguments.
       * @param name Name of a kernel definition.
@@ -524,6 +589,17 @@ public:
       */
     void SetReadOnlyArgumentCache(const bool flag);
 
+    /** @fn void SetReadWriteArgumentSnapshot(const bool flag)
+      * Toggles device-side snapshots of writable vector arguments which have management type set to framework and are located in
+      * device memory. When enabled, each such argument is uploaded from host memory only once. A pristine copy of its buffer is
+      * kept on device and it is restored with a device-to-device copy before every kernel run. This reduces data movement
+      * overhead for kernels which modify large inputs in place, at the cost of twice as much device memory for these arguments.
+      * Snapshots are disabled by default. Snapshots are not refreshed when host data of an argument changes, they need to be
+      * toggled off and on again in such case.
+      * @param flag If true, argument snapshots are enabled. They are disabled otherwise.
+      */
+    void SetReadWriteArgumentSnapshot(const bool flag);
+
     /** @fn KernelResult Run(const KernelId id, const KernelConfiguration& configuration,
       * const std::vector<BufferOutputDescriptor>& output)
       * Runs kernel using the specified configuration.
@@ -549,6 +625,48 @@ public:
     KernelResult Run(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
         const std::vector<BufferOutputDescriptor>& output);
 
+    /** @fn KernelResult RunAsync(const KernelId id, const KernelConfiguration& configuration,
+      * const std::vector<BufferOutputDescriptor>& output, OutputCallback callback = nullptr)
+      * Runs kernel using the specified configuration and downloads its output asynchronously. The method returns as soon as
+      * the kernel is measured and validated, downloads of output buffers are issued in a secondary queue if the tuner has more
+      * than one queue. The output memory must not be accessed until the downloads finish. They are finished by WaitForOutputs()
+      * method, by queue synchronization or implicitly by the next run of a kernel which overwrites any of the downloaded buffers.
+      * Runs of kernels which do not overwrite them proceed while the downloads are pending. Data movement overhead in the returned
+      * result does not include the asynchronous downloads.
+      * @param id Id of kernel which will be run.
+      * @param configuration Configuration under which the kernel will be launched. See KernelConfiguration for more information.
+      * @param output User-provided memory locations for kernel arguments which should be retrieved. See BufferOutputDescriptor
+      * for more information.
+      * @param callback Optional function which is invoked with the kernel result once the output is downloaded. The function
+      * must not run kernels with the tuner.
+      * @return Result containing information about kernel computation. See KernelResult for more information.
+      */
+    KernelResult RunAsync(const KernelId id, const KernelConfiguration& configuration, const std::vector<BufferOutputDescriptor>& output,
+        OutputCallback callback = nullptr);
+
+    /** @fn KernelResult RunAsync(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+      * const std::vector<BufferOutputDescriptor>& output, OutputCallback callback = nullptr)
+      * Runs kernel using the specified dimensions and configuration and downloads its output asynchronously. See the other
+      * overload of RunAsync() method for more information.
+      * @param id Id of kernel which will be run.
+      * @param configuration Configuration under which the kernel will be launched. See KernelConfiguration for more information.
+      * @param dimensions Global and local sizes with which the kernel will be launched. If no dimensions are specified for some
+      * definition, the sizes specified during its addition will be used.
+      * @param output User-provided memory locations for kernel arguments which should be retrieved. See BufferOutputDescriptor
+      * for more information.
+      * @param callback Optional function which is invoked with the kernel result once the output is downloaded. The function
+      * must not run kernels with the tuner.
+      * @return Result containing information about kernel computation. See KernelResult for more information.
+      */
+    KernelResult RunAsync(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+        const std::vector<BufferOutputDescriptor>& output, OutputCallback callback = nullptr);
+
+    /** @fn void WaitForOutputs()
+      * Blocks until output downloads issued by previous RunAsync() calls are finished and invokes the corresponding callbacks in
+      * the order of the calls. Does nothing if there are no pending downloads.
+      */
+    void WaitForOutputs();
+
     /** @fn void SetProfiling(const bool flag)
       * Toggles profiling of kernels inside the tuner. Profiled kernel runs generate profiling counters which can be used by
       * searchers and stop conditions for more accurate performance measurement. Profiling counters can also be retrieved through
@@ -565,6 +683,45 @@ public:
      */
     bool GetProfiling();
 
+    /** @fn void SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+      * const double targetRelativeWidth)
+      * Sets policy for measurement of kernel configurations during tuning. Each configuration is first launched the specified number
+      * of times without measurement, then it is run repeatedly until the 95% confidence interval of the median duration is narrower
+      * than the target width or until the maximum number of runs is reached. The run with median duration is reported as a result,
+      * collected statistics can be retrieved through KernelResult::GetMeasurementStatistics(). Arguments which are not read-only
+      * are uploaded again before each run. The policy is not applied to profiled runs and to kernel runs outside of tuning. By
+      * default, each configuration is measured exactly once.
+      * @param warmupRuns Number of unmeasured runs performed before the measurement.
+      * @param minimumRuns Minimum number of measured runs. Has to be at least one.
+      * @param maximumRuns Maximum number of measured runs. Cannot be lower than the minimum number of runs.
+      * @param targetRelativeWidth Target width of the confidence interval relative to the median, e.g., 0.02 for 2%.
+      */
+    void SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+        const double targetRelativeWidth);
+
+    /** @fn void SetRacing(const bool flag, const uint64_t minimumRuns = 3)
+      * Toggles racing of configurations during repeated measurement. After the specified number of measured runs, measurement of
+      * a configuration is aborted once the confidence interval of its median duration lies entirely above the confidence interval
+      * of the fastest configuration measured so far. The number of performed runs is recorded in the measurement statistics of
+      * the result. Racing only has an effect when repeated measurement is enabled with SetMeasurementPolicy(). Racing is disabled
+      * by default.
+      * @param flag If true, racing is enabled. It is disabled otherwise.
+      * @param minimumRuns Number of measured runs performed before a configuration can be discarded. Has to be at least two.
+      */
+    void SetRacing(const bool flag, const uint64_t minimumRuns = 3);
+
+    /** @fn void CalibrateTimer()
+      * Measures duration of an empty kernel reported by compute API events, overhead of an empty kernel launch and overhead and
+      * resolution of the host timer on the current device. Subsequently measured kernel durations are reduced by the duration of
+      * the empty kernel and launcher durations by the timer overhead. The removed time is reported in calibration overhead of
+      * kernel result (see KernelResult::GetCalibrationOverhead()), it is not added to data movement overhead or launcher
+      * duration. This improves comparability of kernels which run for only a few microseconds. The calibration data is stored in
+      * metadata of saved results. The calibration should be performed right after tuner creation, before kernel definitions are
+      * added and profiling is enabled. Calibration is not performed by default. Tuners which replay recorded results skip the
+      * calibration.
+      */
+    void CalibrateTimer();
+
     /** @fn void SetValidationMethod(const ValidationMethod method, const double toleranceThreshold)
       * Sets validation method and tolerance threshold for floating-point argument validation. Default validation method is side
       * by side comparison. Default tolerance threshold is 1e-4.
@@ -582,6 +739,24 @@ public:
       */
     void SetValidationMode(const ValidationMode mode);
 
+    /** @fn void SetValidationSampleCount(const size_t count)
+      * Sets number of randomly sampled elements which are compared by sampled comparison validation method in addition to the
+      * elements at the beginning and end of the buffer. Default sample count is 1024. See ::ValidationMethod for more information.
+      * @param count Number of sampled elements. Must be greater than zero.
+      */
+    void SetValidationSampleCount(const size_t count);
+
+    /** @fn void SetReferenceResultCache(const std::string& directory, const std::string& referenceVersion = "")
+      * Enables persistent caching of reference results computed with reference kernels and reference computations. Results
+      * are stored in the specified directory, keyed by the contents of the validated kernel's arguments and the reference
+      * version. In subsequent tuning sessions, matching results are mapped into memory from the cache instead of being
+      * recomputed. Caching is disabled for kernels which use user-owned arguments, since their contents are not accessible.
+      * @param directory Directory where reference results will be stored. Caching is disabled if the directory is empty.
+      * @param referenceVersion Version of the reference computation. It should be changed whenever the reference kernel or
+      * reference computation changes, or when the reference computation depends on data which are not kernel arguments.
+      */
+    void SetReferenceResultCache(const std::string& directory, const std::string& referenceVersion = "");
+
     /** @fn void SetValidationRange(const ArgumentId& id, const size_t range)
       * Sets validation range for the specified argument. The entire argument is validated by default.
       * @param id Id of argument for which the validation range will be set. Only not read-only vector arguments can be validated.
@@ -659,6 +834,76 @@ public:
     std::vector<KernelResult> Tune(const KernelId id, const KernelDimensions& dimensions,
         std::unique_ptr<StopCondition> stopCondition = nullptr);
 
+    /** @fn std::vector<KernelResult> TuneDistributed(const KernelId id, const uint16_t port, const uint32_t leaseTimeout,
+      * std::unique_ptr<StopCondition> stopCondition = nullptr)
+      * Performs the tuning process for specified kernel with configurations measured by worker processes, which may run on other
+      * machines. This tuner acts as a coordinator. It owns the configuration space and Searcher, accepts worker connections on
+      * the specified port and hands out configurations to idle workers. Workers are started with RunTuningWorker() method and
+      * may connect or disconnect at any time during tuning. Configuration whose result is not delivered within the lease timeout
+      * is handed out to another worker. Kernel, its parameters, constraints and the time unit must be set up identically in
+      * coordinator and all workers. Coordinator does not need kernel arguments, since it does not launch any kernels. Several
+      * workers can also run on the same machine as the coordinator, e.g., one worker per device.
+      * @param id Id of the tuned kernel.
+      * @param port TCP port on which the coordinator waits for workers. If zero is specified, free port is chosen by the
+      * operating system and logged.
+      * @param leaseTimeout Time in seconds after which configuration assigned to a worker is handed out to another worker.
+      * @param stopCondition Condition which decides whether to continue the tuning process. If no condition is provided, tuning
+      * will end when all configurations are explored. See StopCondition for more information.
+      * @return Vector of results containing information about kernel computation in specific configuration. Index of the worker
+      * which measured the configuration is available as tuning device of each result. See KernelResult for more information.
+      */
+    std::vector<KernelResult> TuneDistributed(const KernelId id, const uint16_t port, const uint32_t leaseTimeout,
+        std::unique_ptr<StopCondition> stopCondition = nullptr);
+
+    /** @fn uint64_t RunTuningWorker(const KernelId id, const std::string& host, const uint16_t port)
+      * Connects to tuning coordinator started with TuneDistributed() method and measures configurations of specified kernel
+      * assigned by the coordinator on the device of this tuner. The measurement is performed in the same way as during offline
+      * tuning, including output validation. Returns once the coordinator finishes tuning or closes the connection.
+      * @param id Id of the measured kernel. Kernel and its parameters must be set up identically to the coordinator.
+      * @param host Name or address of the machine where the coordinator runs.
+      * @param port TCP port on which the coordinator waits for workers.
+      * @return Number of configurations measured by this worker.
+      */
+    uint64_t RunTuningWorker(const KernelId id, const std::string& host, const uint16_t port);
+
+    /** @fn uint64_t RunTuningWorker(const KernelId id, const KernelDimensions& dimensions, const std::string& host,
+      * const uint16_t port)
+      * Connects to tuning coordinator started with TuneDistributed() method and measures configurations of specified kernel
+      * assigned by the coordinator on the device of this tuner. The measurement is performed in the same way as during offline
+      * tuning, including output validation. Returns once the coordinator finishes tuning or closes the connection.
+      * @param id Id of the measured kernel. Kernel and its parameters must be set up identically to the coordinator.
+      * @param dimensions Global and local sizes with which the kernel will be launched. If no dimensions are specified for some
+      * definition, the sizes specified during its addition will be used.
+      * @param host Name or address of the machine where the coordinator runs.
+      * @param port TCP port on which the coordinator waits for workers.
+      * @return Number of configurations measured by this worker.
+      */
+    uint64_t RunTuningWorker(const KernelId id, const KernelDimensions& dimensions, const std::string& host, const uint16_t port);
+
+    /** @fn bool RunSandboxWorker(const KernelId id)
+      * Entry point of sandbox worker process launched during tuning with enabled sandboxed execution. If the current process is
+      * the sandbox worker of specified kernel, measures configurations assigned by the tuning process until its tuning is
+      * finished. Does nothing otherwise. The application should call this method right after the kernel is set up and return
+      * from its main function once it returns true. See SetSandboxedExecution() for more information.
+      * @param id Id of the sandboxed kernel. Kernel and its parameters must be set up identically to the tuning process.
+      * @return True if the current process is the sandbox worker of specified kernel and it has finished measurement. False
+      * otherwise.
+      */
+    bool RunSandboxWorker(const KernelId id);
+
+    /** @fn bool RunSandboxWorker(const KernelId id, const KernelDimensions& dimensions)
+      * Entry point of sandbox worker process launched during tuning with enabled sandboxed execution. If the current process is
+      * the sandbox worker of specified kernel, measures configurations assigned by the tuning process until its tuning is
+      * finished. Does nothing otherwise. The application should call this method right after the kernel is set up and return
+      * from its main function once it returns true. See SetSandboxedExecution() for more information.
+      * @param id Id of the sandboxed kernel. Kernel and its parameters must be set up identically to the tuning process.
+      * @param dimensions Global and local sizes with which the kernel will be launched. If no dimensions are specified for some
+      * definition, the sizes specified during its addition will be used.
+      * @return True if the current process is the sandbox worker of specified kernel and it has finished measurement. False
+      * otherwise.
+      */
+    bool RunSandboxWorker(const KernelId id, const KernelDimensions& dimensions);
+
     /** @fn KernelResult TuneIteration(const KernelId id, const std::vector<BufferOutputDescriptor>& output,
       * const bool recomputeReference = false)
       * Performs one step of the tuning process for specified kernel. When this method is called for the kernel for the first time,
@@ -728,6 +973,19 @@ public:
     std::vector<KernelResult> SimulateTuning(const KernelId id, const std::vector<KernelResult>& results,
         std::unique_ptr<StopCondition> stopCondition = nullptr);
 
+    /** @fn void Precompile(const KernelId id, const uint64_t startIndex = 0,
+      * const uint64_t endIndex = std::numeric_limits<uint64_t>::max())
+      * Compiles kernels for the specified range of configurations concurrently on all available host cores and stores the
+      * resulting binaries inside kernel binary cache. Subsequent tuning of the kernel loads the binaries from the cache instead
+      * of compiling the sources. Configurations whose binaries are already cached are skipped. Requires kernel binary cache to
+      * be set with SetKernelBinaryCache() method. Precompilation is currently supported only by OpenCL backend.
+      * @param id Id of kernel whose configurations will be precompiled.
+      * @param startIndex Index of the first configuration which will be precompiled.
+      * @param endIndex Index one past the last configuration which will be precompiled. Indices past the end of configuration
+      * space are ignored.
+      */
+    void Precompile(const KernelId id, const uint64_t startIndex = 0, const uint64_t endIndex = std::numeric_limits<uint64_t>::max());
+
     /** @fn void SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
       * Sets searcher which will be used during kernel tuning. If no searcher is specified, DeterministicSearcher will be used.
       * @param id Id of kernel for which searcher will be set.
@@ -738,15 +996,31 @@ public:
     /** @fn void SetProfileBasedSearcher(const KernelId id, const std::string& modelPath, const bool exportModule = true)
       * Sets profile-based searcher to be used during kernel tuning. This is special method for profile-based searcher, for other searchers, use SetSearcher.
       * @param id Id of kernel for which searcher will be set.
-      * @param modelPath Path to a ML model file containing trained model for the tuned kernel.
+      * @param modelPath Path to a ML model file containing trained model for the tuned kernel. Models exported to JSON format (files with
+      * .json extension, see Scripts/PrepareModels/export_model_to_json.py) are evaluated natively and do not require Python backend.
+      * Pickled models are evaluated by the Python module.
       * @param useBuiltinModule Toggles usage of built-in profile-based searcher module. If set to false, the built-in module will not be used,
-      * making it possible to use externally modified version of module which is useful for debugging.
+      * making it possible to use externally modified version of Python module which is useful for debugging.
       * @param batchSize number of configuration from which the fastest one is profiled. Default value also needs to be changed in TuningLoader/Commands/SearcherCommand.cpp
       * @param neighborSize number of neighboring configurations that are used for batch selection. Default value also needs to be changed in TuningLoader/Commands/SearcherCommand.cpp
       * @param randomSize number of random configurations that are used for batch selection. Default value also needs to be changed in TuningLoader/Commands/SearcherCommand.cpp
       */
     void SetProfileBasedSearcher(const KernelId id, const std::string& modelPath, const bool useBuiltinModule = true, const uint batchSize = 5, const uint neighborSize = 100, const uint randomSize = 10);
 
+    /** @fn void SetTuningObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+      * ObjectiveScalarization scalarization = nullptr)
+      * Sets objectives which will be optimized during kernel tuning. Tuner maintains Pareto front of explored configurations with
+      * regard to the specified objectives. By default, only total duration is optimized. Setting objectives clears configuration
+      * data of the kernel.
+      * @param id Id of kernel for which the objectives will be set.
+      * @param objectives Objectives which will be minimized. See ::TuningObjective for more information.
+      * @param scalarization Optional function which converts objective values into a single score, the configuration with the lowest
+      * score is then returned as the best configuration. If no function is provided, the first objective decides the best
+      * configuration.
+      */
+    void SetTuningObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+        ObjectiveScalarization scalarization = nullptr);
+
     /** @fn void InitializeConfigurationData(const KernelId id)
       * Generates configuration space and initializes searcher for the specified kernel.
       * @param id Id of kernel whose configuration data will be initialized.
@@ -781,6 +1055,14 @@ public:
       */
     KernelConfiguration GetBestConfiguration(const KernelId id) const;
 
+    /** @fn std::vector<KernelResult> GetParetoFront(const KernelId id) const
+      * Returns results of explored configurations which form Pareto front with regard to the objectives set for the kernel. Only
+      * valid results are considered.
+      * @param id Id of kernel for which the Pareto front will be returned.
+      * @return Results which are not dominated by any other explored configuration. See KernelResult for more information.
+      */
+    std::vector<KernelResult> GetParetoFront(const KernelId id) const;
+
     /** @fn KernelConfiguration CreateConfiguration(const KernelId id, const ParameterInput& parameters) const
       * Creates and returns configuration for the specified kernel based on provided parameters and their values.
       * @param id Id of kernel for which the configuration will be created.
@@ -942,6 +1224,106 @@ public:
       */
     void SetKernelCacheCapacity(const uint64_t capacity);
 
+    /** @fn void SetKernelCacheMemoryLimit(const uint64_t limit)
+      * Sets limit for total size of compiled kernel binaries stored in kernel cache. When the limit is exceeded, kernels are evicted
+      * from the cache according to the cache policy, even if the cache capacity is not reached. The most recently compiled kernel
+      * is always kept. Memory limit is disabled by default.
+      * @param limit Maximum size of cached kernel binaries in bytes. If zero, only the cache capacity limits the cache.
+      */
+    void SetKernelCacheMemoryLimit(const uint64_t limit);
+
+    /** @fn void SetKernelCachePolicy(const KernelCachePolicy policy)
+      * Sets eviction policy of compiled kernel cache. Least recently used policy is utilized by default.
+      * @param policy Eviction policy of the cache. See ::KernelCachePolicy for more information.
+      */
+    void SetKernelCachePolicy(const KernelCachePolicy policy);
+
+    /** @fn KernelCacheStatistics GetKernelCacheStatistics() const
+      * Retrieves statistics about usage of compiled kernel cache, such as number of cache hits, misses and evictions. The statistics
+      * can be used to choose suitable cache capacity and memory limit for specific workload. When tuning on multiple devices, the
+      * statistics are summed over the kernel caches of all devices.
+      * @return Statistics about the kernel cache. See KernelCacheStatistics for more information.
+      */
+    KernelCacheStatistics GetKernelCacheStatistics() const;
+
+    /** @fn void SetCompilationLookahead(const uint64_t count)
+      * Enables pipelined tuning. While a configuration is being measured, kernels for the specified number of upcoming configurations
+      * predicted by the searcher are compiled in background and inserted into the kernel cache. Compilation overhead reported in
+      * KernelResult then only contains the time spent waiting for a compilation which did not finish in time. Pipelining only
+      * helps with searchers which override Searcher::GetUpcomingConfigurations(). Among the built-in searchers, these are
+      * DeterministicSearcher and RandomSearcher. Other searchers depend on results of the current configuration, so kernels are
+      * compiled on launch as usual and a warning is logged when tuning starts. Background compilation is only implemented in OpenCL backend and requires enabled kernel
+      * cache. In CUDA and Vulkan backends, the setting has no effect. Pipelining is disabled by default.
+      * @param count Number of upcoming configurations which are compiled in advance. If zero, pipelining is disabled.
+      */
+    void SetCompilationLookahead(const uint64_t count);
+
+    /** @fn void SetSandboxedExecution(const bool flag, const double timeoutFactor = 10.0, const uint32_t minimumTimeout = 10,
+      * const std::vector<std::string>& workerArguments = {})
+      * Toggles sandboxed kernel execution during offline tuning. When enabled, configurations are measured inside a persistent child
+      * worker process, which runs the same executable. The worker process must set up the tuned kernel identically and call
+      * RunSandboxWorker() for it, which measures the configurations and returns once the tuning is finished. Worker arguments
+      * can be used to direct the worker process to this setup without running the rest of the application. Tuning of other
+      * kernels is skipped inside the worker process. Worker process which does not connect within 60 seconds is terminated and
+      * the tuning fails. If measurement of a configuration does not finish within the time limit, the worker process is
+      * terminated and launched again and the configuration receives ResultStatus::Timeout. Crash of the worker process results in
+      * ResultStatus::ComputationFailed instead of termination of the whole tuning. Sandboxed execution is supported on Linux and
+      * Windows and it cannot be combined with multi-device tuning. It is disabled by default.
+      * @param flag If true, sandboxed execution is enabled. It is disabled otherwise.
+      * @param timeoutFactor Time limit of a configuration as a multiple of the total duration including overhead of the fastest
+      * configuration measured so far.
+      * @param minimumTimeout Minimum time limit in seconds. It is also used before any valid configuration is measured, so it
+      * should cover kernel compilation and computation of reference output.
+      * @param workerArguments Command line arguments of the worker process, not including the program name. If no arguments
+      * are specified, the worker process receives the same arguments as the current process.
+      */
+    void SetSandboxedExecution(const bool flag, const double timeoutFactor = 10.0, const uint32_t minimumTimeout = 10,
+        const std::vector<std::string>& workerArguments = {});
+
+    /** @fn void SetOutlierDetection(const uint64_t sentinelInterval)
+      * Enables detection of measurement anomalies during offline tuning, e.g., thermal throttling or activity of other processes
+      * on the device. The first valid configuration becomes a sentinel, which is measured again after each interval of tuned
+      * configurations. When its duration deviates from its typical duration according to median absolute deviation and the
+      * deviation is confirmed by another measurement, durations of results from the interval are scaled to compensate for the
+      * drift. See KernelResult::GetDriftCorrection() for more information. If the deviation is not confirmed, configurations from
+      * the interval are measured again. Additionally, each new best configuration is measured again immediately, regardless of the
+      * interval. If both measurements differ, the slower one is kept. If the re-measurement fails, the original measurement is
+      * kept. Searcher receives the original results, the corrections are reflected in returned results, the best configuration
+      * and Pareto front. Detection is not performed in multi-device, distributed and sandboxed tuning. It is disabled by default.
+      * @param sentinelInterval Number of tuned configurations after which the sentinel configuration is measured again. If zero,
+      * detection is disabled, including re-measurement of new best configurations.
+      */
+    void SetOutlierDetection(const uint64_t sentinelInterval);
+
+    /** @fn void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize = 0)
+      * Sets directory of persistent kernel binary cache. Compiled kernel binaries are stored inside the directory, keyed by hash
+      * of kernel source, compiler options, device name and driver version. Kernels whose binaries are found in the cache are not
+      * compiled again, even across different tuner instances. OpenCL backend stores program binaries, Vulkan backend stores
+      * SPIR-V shaders together with driver pipeline cache. The cache is not supported by CUDA backend. The cache is disabled by
+      * default.
+      * @param directory Path to cache directory. The directory is created if it does not exist. If empty, the cache is disabled.
+      * @param maximumSize Maximum size of cached binaries in bytes. When exceeded, the least recently used binaries are removed
+      * from the directory. If zero, the cache size is not limited.
+      */
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize = 0);
+
+    /** @fn void SetStagingMemoryLimit(const uint64_t limit)
+      * Enables transfers of large buffers through pool of pinned staging buffers. Data are copied between host memory and pinned
+      * buffers in chunks which overlap with transfers of the previous chunks. Pinned buffers are reused across transfers, so that
+      * they do not need to be allocated repeatedly. Only transfers of buffers located in device memory are staged. Staging is
+      * supported by OpenCL and CUDA backends. Staging is disabled by default.
+      * @param limit Maximum total size of allocated pinned buffers in bytes. If the limit is reached, the remaining data are
+      * transferred directly. If zero, staging is disabled and all pinned buffers are released.
+      */
+    void SetStagingMemoryLimit(const uint64_t limit);
+
+    /** @fn TransferStatistics GetTransferStatistics() const
+      * Retrieves statistics about data transfers between host and device, such as transferred data sizes, throughput and usage
+      * of staging buffers. When tuning on multiple devices, the statistics are summed over all devices.
+      * @return Statistics about data transfers. See TransferStatistics for more information.
+      */
+    TransferStatistics GetTransferStatistics() const;
+
     /** @fn std::vector<PlatformInfo> GetPlatformInfo() const
       * Retrieves detailed information about all available platforms. See PlatformInfo for more information.
       * @return Information about all available platforms.
@@ -1,8 +1,12 @@
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 
 #include <Api/KttException.h>
 #include <ComputeEngine/Cuda/CudaEngine.h>
+#include <ComputeEngine/Host/HostEngine.h>
 #include <ComputeEngine/OpenCl/OpenClEngine.h>
+#include <ComputeEngine/Replay/ReplayEngine.h>
 #include <ComputeEngine/Vulkan/VulkanEngine.h>
 #include <Output/Deserializer/JsonDeserializer.h>
 #include <Output/Deserializer/XmlDeserializer.h>
@@ -20,7 +24,8 @@ namespace ktt
 
 TunerCore::TunerCore(const PlatformIndex platform, const DeviceIndex device, const ComputeApi api, const uint32_t queueCount) :
     m_ArgumentManager(std::make_unique<KernelArgumentManager>()),
-    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager))
+    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager)),
+    m_ReplayFlag(false)
 {
     InitializeComputeEngine(platform, device, api, queueCount);
     InitializeRunners();
@@ -28,12 +33,46 @@ TunerCore::TunerCore(const PlatformIndex platform, const DeviceIndex device, con
 
 TunerCore::TunerCore(const ComputeApi api, const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds) :
     m_ArgumentManager(std::make_unique<KernelArgumentManager>()),
-    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager))
+    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager)),
+    m_ReplayFlag(false)
 {
     InitializeComputeEngine(api, initializer, assignedQueueIds);
     InitializeRunners();
 }
 
+TunerCore::TunerCore(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+    const uint32_t subDeviceCount) :
+    m_ArgumentManager(std::make_unique<KernelArgumentManager>()),
+    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager)),
+    m_ReplayFlag(false)
+{
+    if (devices.empty())
+    {
+        throw KttException("List of tuning devices must not be empty");
+    }
+
+    InitializeComputeEngine(platform, devices[0], api, 1);
+    InitializeRunners();
+    InitializeParallelRunners(platform, devices, api, subDeviceCount);
+}
+
+TunerCore::TunerCore(const std::string& resultsFile, const OutputFormat format, const bool virtualClock) :
+    m_ArgumentManager(std::make_unique<KernelArgumentManager>()),
+    m_KernelManager(std::make_unique<KernelManager>(*m_ArgumentManager)),
+    m_ReplayFlag(true)
+{
+    UserData data;
+    const auto pair = ReadResults(resultsFile, format, data);
+
+    if (virtualClock)
+    {
+        m_VirtualClock = std::make_unique<VirtualClock>();
+    }
+
+    m_ComputeEngine = std::make_unique<ReplayEngine>(pair.first, pair.second, m_VirtualClock.get());
+    InitializeRunners();
+}
+
 KernelDefinitionId TunerCore::AddKernelDefinition(const std::string& name, const std::string& source,
     const DimensionVector& globalSize, const DimensionVector& localSize, const std::vector<std::string>& typeNames)
 {
@@ -46,6 +85,24 @@ KernelDefinitionId TunerCore::AddKernelDefinitionFromFile(const std::string& nam
     return m_KernelManager->AddKernelDefinitionFromFile(name, filePath, globalSize, localSize, typeNames);
 }
 
+KernelDefinitionId TunerCore::AddHostKernelDefinition(const std::string& name, HostFunction function,
+    const DimensionVector& globalSize, const DimensionVector& localSize)
+{
+    if (m_ComputeEngine->GetComputeApi() != ComputeApi::Host)
+    {
+        throw KttException("Host kernel definitions are only supported for host compute API");
+    }
+
+    if (!function)
+    {
+        throw KttException("Host function for kernel definition with name " + name + " must not be empty");
+    }
+
+    const auto id = m_KernelManager->AddKernelDefinition(name, "", globalSize, localSize, {});
+    m_KernelManager->GetDefinition(id).SetHostFunction(function);
+    return id;
+}
+
 KernelDefinitionId TunerCore::GetKernelDefinitionId(const std::string& name, const std::vector<std::string>& typeNames) const
 {
     return m_KernelManager->GetDefinitionId(name, typeNames);
@@ -54,13 +111,21 @@ KernelDefinitionId TunerCore::GetKernelDefinitionId(const std::string& name, con
 void TunerCore::RemoveKernelDefinition(const KernelDefinitionId id)
 {
     const auto& definition = m_KernelManager->GetDefinition(id);
-    m_ComputeEngine->ClearKernelData(definition.GetName() + definition.GetTemplatedName());
+
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->ClearKernelData(definition.GetName() + definition.GetTemplatedName());
+    }
+
     m_KernelManager->RemoveKernelDefinition(id);
 }
 
 void TunerCore::SetArguments(const KernelDefinitionId id, const std::vector<ArgumentId>& argumentIds)
 {
     m_KernelManager->SetArguments(id, argumentIds);
+
+    // Durations measured with previous arguments cannot be used to discard configurations
+    m_TuningRunner->ClearRacingIncumbents();
 }
 
 KernelId TunerCore::CreateKernel(const std::string& name, const KernelDefinitionId definitionId)
@@ -78,7 +143,12 @@ KernelId TunerCore::CreateKernel(const std::string& name, const std::vector<Kern
 void TunerCore::RemoveKernel(const KernelId id)
 {
     m_TuningRunner->ClearConfigurationData(id, true);
-    m_KernelRunner->RemoveKernelData(id);
+
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->RemoveKernelData(id);
+    }
+
     m_KernelManager->RemoveKernel(id);
 }
 
@@ -177,6 +247,11 @@ ArgumentId TunerCore::AddUserArgument(ComputeBuffer buffer, const size_t element
     const ArgumentMemoryLocation memoryLocation, const ArgumentAccessType accessType, const size_t dataSize,
     const ArgumentId& customId)
 {
+    if (!m_ParallelEngines.empty())
+    {
+        throw KttException("User arguments are not supported in multi-device tuning mode");
+    }
+
     const ArgumentId& id = m_ArgumentManager->AddUserArgument(elementSize, dataType, memoryLocation, accessType, dataSize, customId);
     auto& argument = m_ArgumentManager->GetArgument(id);
     m_ComputeEngine->AddCustomBuffer(argument, buffer);
@@ -190,8 +265,19 @@ void TunerCore::RemoveArgument(const ArgumentId& id)
         throw KttException("Argument with id " + id + " cannot be removed because it is still referenced by at least one kernel definition");
     }
 
-    m_KernelRunner->RemoveValidationData(id);
-    m_ComputeEngine->ClearBuffer(id);
+    m_KernelRunner->WaitForOutputs();
+
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->RemoveValidationData(id);
+        runner->ClearArgumentSnapshot(id);
+    }
+
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->ClearBuffer(id);
+    }
+
     m_ArgumentManager->RemoveArgument(id);
 }
 
@@ -202,7 +288,18 @@ void TunerCore::SaveArgument(const ArgumentId& id, const std::string& file) cons
 
 void TunerCore::SetReadOnlyArgumentCache(const bool flag)
 {
-    m_KernelRunner->SetReadOnlyArgumentCache(flag);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReadOnlyArgumentCache(flag);
+    }
+}
+
+void TunerCore::SetReadWriteArgumentSnapshot(const bool flag)
+{
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReadWriteArgumentSnapshot(flag);
+    }
 }
 
 KernelResult TunerCore::RunKernel(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
@@ -212,9 +309,24 @@ KernelResult TunerCore::RunKernel(const KernelId id, const KernelConfiguration&
     return m_KernelRunner->RunKernel(kernel, configuration, dimensions, KernelRunMode::Running, output);
 }
 
+KernelResult TunerCore::RunKernelAsync(const KernelId id, const KernelConfiguration& configuration,
+    const KernelDimensions& dimensions, const std::vector<BufferOutputDescriptor>& output, OutputCallback callback)
+{
+    const auto& kernel = m_KernelManager->GetKernel(id);
+    return m_KernelRunner->RunKernelAsync(kernel, configuration, dimensions, output, callback);
+}
+
+void TunerCore::WaitForOutputs()
+{
+    m_KernelRunner->WaitForOutputs();
+}
+
 void TunerCore::SetProfiling(const bool flag)
 {
-    m_KernelRunner->SetProfiling(flag);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetProfiling(flag);
+    }
 }
 
 bool TunerCore::GetProfiling()
@@ -222,43 +334,154 @@ bool TunerCore::GetProfiling()
     return m_KernelRunner->IsProfilingActive();
 }
 
+void TunerCore::SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+    const double targetRelativeWidth)
+{
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetMeasurementPolicy(warmupRuns, minimumRuns, maximumRuns, targetRelativeWidth);
+    }
+}
+
+void TunerCore::SetRacing(const bool flag, const uint64_t minimumRuns)
+{
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetRacing(flag, minimumRuns);
+    }
+}
+
+
+void TunerCore::CalibrateTimer()
+{
+    if (m_ReplayFlag)
+    {
+        // Replayed durations were already corrected by calibration of the recorded session, if it was performed
+        Logger::LogInfo("Timer calibration is skipped, because kernels are replayed from recorded results");
+        return;
+    }
+
+    std::string name = "kttCalibrationKernel";
+    std::string source;
+    HostFunction function;
+
+    switch (m_ComputeEngine->GetComputeApi())
+    {
+    case ComputeApi::OpenCL:
+        source = "__kernel void " + name + "() {}";
+        break;
+    case ComputeApi::CUDA:
+        source = "extern \"C\" __global__ void " + name + "() {}";
+        break;
+    case ComputeApi::Vulkan:
+        name = "main";
+        source = "#version 450\nlayout(local_size_x = 1) in;\nvoid main() {}\n";
+        break;
+    case ComputeApi::Host:
+        function = [](const KernelConfiguration&, const std::vector<void*>&) {};
+        break;
+    default:
+        KttError("Unhandled compute API value");
+    }
+
+    const auto definitionId = m_KernelManager->AddKernelDefinition(name, source, DimensionVector(), DimensionVector(), {});
+    m_KernelManager->GetDefinition(definitionId).SetHostFunction(function);
+
+    const auto kernelId = m_KernelManager->CreateKernel("KttTimerCalibration", {definitionId});
+
+    try
+    {
+        for (auto* runner : GetKernelRunners())
+        {
+            runner->CalibrateTimer(m_KernelManager->GetKernel(kernelId));
+        }
+    }
+    catch (const KttException&)
+    {
+        RemoveKernel(kernelId);
+        RemoveKernelDefinition(definitionId);
+        throw;
+    }
+
+    RemoveKernel(kernelId);
+    RemoveKernelDefinition(definitionId);
+}
 
 void TunerCore::SetValidationMethod(const ValidationMethod method, const double toleranceThreshold)
 {
-    m_KernelRunner->SetValidationMethod(method, toleranceThreshold);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetValidationMethod(method, toleranceThreshold);
+    }
 }
 
 void TunerCore::SetValidationMode(const ValidationMode mode)
 {
-    m_KernelRunner->SetValidationMode(mode);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetValidationMode(mode);
+    }
+}
+
+void TunerCore::SetValidationSampleCount(const size_t count)
+{
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetValidationSampleCount(count);
+    }
+}
+
+void TunerCore::SetReferenceResultCache(const std::string& directory, const std::string& referenceVersion)
+{
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReferenceResultCache(directory, referenceVersion);
+    }
 }
 
 void TunerCore::SetValidationRange(const ArgumentId& id, const size_t range)
 {
-    m_KernelRunner->SetValidationRange(id, range);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetValidationRange(id, range);
+    }
 }
 
 void TunerCore::SetValueComparator(const ArgumentId& id, ValueComparator comparator)
 {
-    m_KernelRunner->SetValueComparator(id, comparator);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetValueComparator(id, comparator);
+    }
 }
 
 void TunerCore::SetReferenceComputation(const ArgumentId& id, ReferenceComputation computation)
 {
-    m_KernelRunner->SetReferenceComputation(id, computation);
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReferenceComputation(id, computation);
+    }
 }
 
 void TunerCore::SetReferenceKernel(const ArgumentId& id, const KernelId referenceId, const KernelConfiguration& configuration,
     const KernelDimensions& dimensions)
 {
     const auto& kernel = m_KernelManager->GetKernel(referenceId);
-    m_KernelRunner->SetReferenceKernel(id, kernel, configuration, dimensions);
+
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReferenceKernel(id, kernel, configuration, dimensions);
+    }
 }
 
 void TunerCore::SetReferenceArgument(const ArgumentId& id, const ArgumentId& referenceId)
 {
     const auto& referenceArgument = m_ArgumentManager->GetArgument(referenceId);
-    m_KernelRunner->SetReferenceArgument(id, referenceArgument);
+
+    for (auto* runner : GetKernelRunners())
+    {
+        runner->SetReferenceArgument(id, referenceArgument);
+    }
 }
 
 std::vector<KernelResult> TunerCore::TuneKernel(const KernelId id, const KernelDimensions& dimensions,
@@ -268,6 +491,26 @@ std::vector<KernelResult> TunerCore::TuneKernel(const KernelId id, const KernelD
     return m_TuningRunner->Tune(kernel, dimensions, std::move(stopCondition));
 }
 
+std::vector<KernelResult> TunerCore::TuneKernelDistributed(const KernelId id, const uint16_t port, const uint32_t leaseTimeout,
+    std::unique_ptr<StopCondition> stopCondition)
+{
+    const auto& kernel = m_KernelManager->GetKernel(id);
+    return m_TuningRunner->TuneDistributed(kernel, port, std::chrono::seconds(leaseTimeout), std::move(stopCondition));
+}
+
+uint64_t TunerCore::RunTuningWorker(const KernelId id, const KernelDimensions& dimensions, const std::string& host,
+    const uint16_t port)
+{
+    const auto& kernel = m_KernelManager->GetKernel(id);
+    return m_TuningRunner->RunWorker(kernel, dimensions, host, port);
+}
+
+bool TunerCore::RunSandboxWorker(const KernelId id, const KernelDimensions& dimensions)
+{
+    const auto& kernel = m_KernelManager->GetKernel(id);
+    return m_TuningRunner->RunSandboxWorker(kernel, dimensions);
+}
+
 KernelResult TunerCore::TuneKernelIteration(const KernelId id, const KernelDimensions& dimensions,
     const std::vector<BufferOutputDescriptor>& output, const bool recomputeReference)
 {
@@ -282,11 +525,28 @@ std::vector<KernelResult> TunerCore::SimulateKernelTuning(const KernelId id, con
     return m_TuningRunner->SimulateTuning(kernel, results, std::move(stopCondition));
 }
 
+void TunerCore::Precompile(const KernelId id, const uint64_t startIndex, const uint64_t endIndex)
+{
+    const auto& kernel = m_KernelManager->GetKernel(id);
+    m_TuningRunner->Precompile(kernel, startIndex, endIndex);
+}
+
 void TunerCore::SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
 {
     m_TuningRunner->SetSearcher(id, std::move(searcher));
 }
 
+void TunerCore::SetTuningObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+    ObjectiveScalarization scalarization)
+{
+    if (objectives.empty())
+    {
+        throw KttException("At least one tuning objective must be specified");
+    }
+
+    m_TuningRunner->SetObjectives(id, objectives, scalarization);
+}
+
 void TunerCore::InitializeConfigurationData(const KernelId id)
 {
     const auto& kernel = m_KernelManager->GetKernel(id);
@@ -308,6 +568,11 @@ KernelConfiguration TunerCore::GetBestConfiguration(const KernelId id) const
     return m_TuningRunner->GetBestConfiguration(id);
 }
 
+std::vector<KernelResult> TunerCore::GetParetoFront(const KernelId id) const
+{
+    return m_TuningRunner->GetParetoFront(id);
+}
+
 KernelConfiguration TunerCore::CreateConfiguration(const KernelId id, const ParameterInput& parameters) const
 {
     const auto& kernel = m_KernelManager->GetKernel(id);
@@ -356,30 +621,14 @@ void TunerCore::SaveResults(const std::vector<KernelResult>& results, const std:
     }
 
     TunerMetadata metadata(*m_ComputeEngine);
+    metadata.SetTimerCalibration(m_KernelRunner->GetTimerCalibration());
     auto serializer = CreateSerializer(format);
     serializer->SerializeResults(metadata, results, data, outputStream);
 }
 
 std::vector<KernelResult> TunerCore::LoadResults(const std::string& filePath, const OutputFormat format, UserData& data) const
 {
-    const std::string file = filePath + GetFileExtension(format);
-    Logger::LogInfo("Loading kernel results from file: " + file);
-    std::ifstream inputStream(file);
-
-    if (!inputStream.is_open())
-    {
-        throw KttException("Unable to open file: " + file);
-    }
-
-    auto deserializer = CreateDeserializer(format);
-    const auto pair = deserializer->DeserializeResults(data, inputStream);
-
-    if (pair.first.GetTimeUnit() != TimeConfiguration::GetInstance().GetTimeUnit())
-    {
-        Logger::LogWarning("Loaded kernel results use different time unit than tuner");
-    }
-
-    return pair.second;
+    return ReadResults(filePath, format, data).second;
 }
 
 QueueId TunerCore::AddComputeQueue(ComputeQueue queue)
@@ -404,42 +653,135 @@ void TunerCore::WaitForTransferAction(const TransferActionId id)
 
 void TunerCore::SynchronizeQueue(const QueueId queueId)
 {
+    // Pending output downloads have to finish before their transfer actions are released by synchronization
+    m_KernelRunner->WaitForOutputs();
     m_ComputeEngine->SynchronizeQueue(queueId);
 }
 
 void TunerCore::SynchronizeQueues()
 {
+    // Pending output downloads have to finish before their transfer actions are released by synchronization
+    m_KernelRunner->WaitForOutputs();
     m_ComputeEngine->SynchronizeQueues();
 }
 
 void TunerCore::SynchronizeDevice()
 {
+    // Pending output downloads have to finish before their transfer actions are released by synchronization
+    m_KernelRunner->WaitForOutputs();
     m_ComputeEngine->SynchronizeDevice();
 }
 
 void TunerCore::SetProfilingCounters(const std::vector<std::string>& counters)
 {
-    m_ComputeEngine->SetProfilingCounters(counters);
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetProfilingCounters(counters);
+    }
 }
 
 void TunerCore::SetCompilerOptions(const std::string& options, const bool overrideDefault)
 {
-    m_ComputeEngine->SetCompilerOptions(options, overrideDefault);
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetCompilerOptions(options, overrideDefault);
+    }
 }
 
 void TunerCore::SetGlobalSizeType(const GlobalSizeType type)
 {
-    m_ComputeEngine->SetGlobalSizeType(type);
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetGlobalSizeType(type);
+    }
 }
 
 void TunerCore::SetAutomaticGlobalSizeCorrection(const bool flag)
 {
-    m_ComputeEngine->SetAutomaticGlobalSizeCorrection(flag);
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetAutomaticGlobalSizeCorrection(flag);
+    }
 }
 
 void TunerCore::SetKernelCacheCapacity(const uint64_t capacity)
 {
-    m_ComputeEngine->SetKernelCacheCapacity(capacity);
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetKernelCacheCapacity(capacity);
+    }
+}
+
+void TunerCore::SetKernelCacheMemoryLimit(const uint64_t limit)
+{
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetKernelCacheMemoryLimit(limit);
+    }
+}
+
+void TunerCore::SetKernelCachePolicy(const KernelCachePolicy policy)
+{
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetKernelCachePolicy(policy);
+    }
+}
+
+KernelCacheStatistics TunerCore::GetKernelCacheStatistics() const
+{
+    KernelCacheStatistics statistics;
+
+    for (const auto* engine : GetComputeEngines())
+    {
+        statistics.Merge(engine->GetKernelCacheStatistics());
+    }
+
+    return statistics;
+}
+
+void TunerCore::SetCompilationLookahead(const uint64_t count)
+{
+    m_TuningRunner->SetCompilationLookahead(count);
+}
+
+void TunerCore::SetSandboxedExecution(const bool flag, const double timeoutFactor, const uint32_t minimumTimeout,
+    const std::vector<std::string>& workerArguments)
+{
+    m_TuningRunner->SetSandboxedExecution(flag, timeoutFactor, std::chrono::seconds(minimumTimeout), workerArguments);
+}
+
+void TunerCore::SetOutlierDetection(const uint64_t sentinelInterval)
+{
+    m_TuningRunner->SetOutlierDetection(sentinelInterval);
+}
+
+void TunerCore::SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize)
+{
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetKernelBinaryCache(directory, maximumSize);
+    }
+}
+
+void TunerCore::SetStagingMemoryLimit(const uint64_t limit)
+{
+    for (auto* engine : GetComputeEngines())
+    {
+        engine->SetStagingMemoryLimit(limit);
+    }
+}
+
+TransferStatistics TunerCore::GetTransferStatistics() const
+{
+    TransferStatistics statistics;
+
+    for (const auto* engine : GetComputeEngines())
+    {
+        statistics.Merge(engine->GetTransferStatistics());
+    }
+
+    return statistics;
 }
 
 std::vector<PlatformInfo> TunerCore::GetPlatformInfo() const
@@ -482,82 +824,156 @@ void TunerCore::Log(const LoggingLevel level, const std::string& message)
     Logger::GetLogger().Log(level, message);
 }
 
-void TunerCore::InitializeComputeEngine([[maybe_unused]] const PlatformIndex platform, const DeviceIndex device, const ComputeApi api,
+void TunerCore::InitializeComputeEngine(const PlatformIndex platform, const DeviceIndex device, const ComputeApi api,
     const uint32_t queueCount)
 {
-    if (queueCount == 0)
-    {
-        throw KttException("Number of compute queues must be greater than zero");
-    }
+    m_ComputeEngine = CreateComputeEngine(platform, device, api, queueCount);
+}
 
+void TunerCore::InitializeComputeEngine(const ComputeApi api, [[maybe_unused]] const ComputeApiInitializer& initializer,
+    [[maybe_unused]] std::vector<QueueId>& assignedQueueIds)
+{
     switch (api)
     {
     case ComputeApi::OpenCL:
         #ifdef KTT_API_OPENCL
-        m_ComputeEngine = std::make_unique<OpenClEngine>(platform, device, queueCount);
+        m_ComputeEngine = std::make_unique<OpenClEngine>(initializer, assignedQueueIds);
         #else
         throw KttException("Support for OpenCL API is not included in this version of KTT framework");
         #endif // KTT_API_OPENCL
         break;
     case ComputeApi::CUDA:
         #ifdef KTT_API_CUDA
-        m_ComputeEngine = std::make_unique<CudaEngine>(device, queueCount);
+        m_ComputeEngine = std::make_unique<CudaEngine>(initializer, assignedQueueIds);
         #else
         throw KttException("Support for CUDA API is not included in this version of KTT framework");
         #endif // KTT_API_CUDA
         break;
     case ComputeApi::Vulkan:
         #ifdef KTT_API_VULKAN
-        m_ComputeEngine = std::make_unique<VulkanEngine>(device, queueCount);
+        throw KttException("Support for user initializers is not yet available for Vulkan API");
         #else
         throw KttException("Support for Vulkan API is not included in this version of KTT framework");
         #endif // KTT_API_VULKAN
         break;
+    case ComputeApi::Host:
+        throw KttException("Support for user initializers is not available for host API");
     default:
         KttError("Unhandled compute API value");
     }
 }
 
-void TunerCore::InitializeComputeEngine(const ComputeApi api, [[maybe_unused]] const ComputeApiInitializer& initializer,
-    [[maybe_unused]] std::vector<QueueId>& assignedQueueIds)
+void TunerCore::InitializeRunners()
+{
+    DeviceInfo info = m_ComputeEngine->GetCurrentDeviceInfo();
+    Logger::LogInfo("Initializing tuner for device " + info.GetName());
+
+    m_KernelRunner = std::make_unique<KernelRunner>(*m_ComputeEngine, *m_ArgumentManager);
+    m_TuningRunner = std::make_unique<TuningRunner>(*m_KernelRunner, m_VirtualClock.get());
+}
+
+void TunerCore::InitializeParallelRunners(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+    const uint32_t subDeviceCount)
 {
+    std::vector<KernelRunner*> tuningRunners;
+
+    if (subDeviceCount == 0)
+    {
+        tuningRunners.push_back(m_KernelRunner.get());
+
+        for (size_t i = 1; i < devices.size(); ++i)
+        {
+            m_ParallelEngines.push_back(CreateComputeEngine(platform, devices[i], api, 1));
+        }
+    }
+    else
+    {
+        if (api != ComputeApi::OpenCL)
+        {
+            throw KttException("Sub-devices are only supported for OpenCL API");
+        }
+
+        #ifdef KTT_API_OPENCL
+        // Sub-devices share compute units with the whole device, which is kept only for regular kernel runs
+        for (const auto device : devices)
+        {
+            auto engines = OpenClEngine::CreateSubDeviceEngines(platform, device, subDeviceCount, 1);
+            std::move(engines.begin(), engines.end(), std::back_inserter(m_ParallelEngines));
+        }
+        #endif // KTT_API_OPENCL
+    }
+
+    for (auto& engine : m_ParallelEngines)
+    {
+        Logger::LogInfo("Initializing tuning device " + std::to_string(tuningRunners.size()) + ": "
+            + engine->GetCurrentDeviceInfo().GetName());
+        m_ParallelRunners.push_back(std::make_unique<KernelRunner>(*engine, *m_ArgumentManager));
+        tuningRunners.push_back(m_ParallelRunners.back().get());
+    }
+
+    m_TuningRunner->SetParallelRunners(tuningRunners);
+}
+
+std::vector<KernelRunner*> TunerCore::GetKernelRunners() const
+{
+    std::vector<KernelRunner*> runners{m_KernelRunner.get()};
+
+    for (const auto& runner : m_ParallelRunners)
+    {
+        runners.push_back(runner.get());
+    }
+
+    return runners;
+}
+
+std::vector<ComputeEngine*> TunerCore::GetComputeEngines() const
+{
+    std::vector<ComputeEngine*> engines{m_ComputeEngine.get()};
+
+    for (const auto& engine : m_ParallelEngines)
+    {
+        engines.push_back(engine.get());
+    }
+
+    return engines;
+}
+
+std::unique_ptr<ComputeEngine> TunerCore::CreateComputeEngine([[maybe_unused]] const PlatformIndex platform,
+    [[maybe_unused]] const DeviceIndex device, const ComputeApi api, [[maybe_unused]] const uint32_t queueCount)
+{
+    if (queueCount == 0)
+    {
+        throw KttException("Number of compute queues must be greater than zero");
+    }
+
     switch (api)
     {
     case ComputeApi::OpenCL:
         #ifdef KTT_API_OPENCL
-        m_ComputeEngine = std::make_unique<OpenClEngine>(initializer, assignedQueueIds);
+        return std::make_unique<OpenClEngine>(platform, device, queueCount);
         #else
         throw KttException("Support for OpenCL API is not included in this version of KTT framework");
         #endif // KTT_API_OPENCL
-        break;
     case ComputeApi::CUDA:
         #ifdef KTT_API_CUDA
-        m_ComputeEngine = std::make_unique<CudaEngine>(initializer, assignedQueueIds);
+        return std::make_unique<CudaEngine>(device, queueCount);
         #else
         throw KttException("Support for CUDA API is not included in this version of KTT framework");
         #endif // KTT_API_CUDA
-        break;
     case ComputeApi::Vulkan:
         #ifdef KTT_API_VULKAN
-        throw KttException("Support for user initializers is not yet available for Vulkan API");
+        return std::make_unique<VulkanEngine>(device, queueCount);
         #else
         throw KttException("Support for Vulkan API is not included in this version of KTT framework");
         #endif // KTT_API_VULKAN
-        break;
+    case ComputeApi::Host:
+        return std::make_unique<HostEngine>(platform, device, queueCount);
     default:
         KttError("Unhandled compute API value");
+        return nullptr;
     }
 }
 
-void TunerCore::InitializeRunners()
-{
-    DeviceInfo info = m_ComputeEngine->GetCurrentDeviceInfo();
-    Logger::LogInfo("Initializing tuner for device " + info.GetName());
-
-    m_KernelRunner = std::make_unique<KernelRunner>(*m_ComputeEngine, *m_ArgumentManager);
-    m_TuningRunner = std::make_unique<TuningRunner>(*m_KernelRunner);
-}
-
 std::unique_ptr<Serializer> TunerCore::CreateSerializer(const OutputFormat format)
 {
     switch (format)
@@ -586,4 +1002,27 @@ std::unique_ptr<Deserializer> TunerCore::CreateDeserializer(const OutputFormat f
     }
 }
 
+std::pair<TunerMetadata, std::vector<KernelResult>> TunerCore::ReadResults(const std::string& filePath, const OutputFormat format,
+    UserData& data)
+{
+    const std::string file = filePath + GetFileExtension(format);
+    Logger::LogInfo("Loading kernel results from file: " + file);
+    std::ifstream inputStream(file);
+
+    if (!inputStream.is_open())
+    {
+        throw KttException("Unable to open file: " + file);
+    }
+
+    auto deserializer = CreateDeserializer(format);
+    auto pair = deserializer->DeserializeResults(data, inputStream);
+
+    if (pair.first.GetTimeUnit() != TimeConfiguration::GetInstance().GetTimeUnit())
+    {
+        Logger::LogWarning("Loaded kernel results use different time unit than tuner");
+    }
+
+    return pair;
+}
+
 } // namespace ktt
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <Api/ComputeApiInitializer.h>
 #include <ComputeEngine/ComputeApi.h>
@@ -15,6 +17,7 @@
 #include <Output/OutputFormat.h>
 #include <TuningRunner/TuningRunner.h>
 #include <Utility/Logger/LoggingLevel.h>
+#include <Utility/Timer/VirtualClock.h>
 #include <KttTypes.h>
 
 namespace ktt
@@ -25,12 +28,17 @@ class TunerCore
 public:
     explicit TunerCore(const PlatformIndex platform, const DeviceIndex device, const ComputeApi api, const uint32_t queueCount);
     explicit TunerCore(const ComputeApi api, const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds);
+    explicit TunerCore(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+        const uint32_t subDeviceCount);
+    explicit TunerCore(const std::string& resultsFile, const OutputFormat format, const bool virtualClock);
 
     // Kernel management
     KernelDefinitionId AddKernelDefinition(const std::string& name, const std::string& source, const DimensionVector& globalSize,
         const DimensionVector& localSize, const std::vector<std::string>& typeNames = {});
     KernelDefinitionId AddKernelDefinitionFromFile(const std::string& name, const std::string& filePath,
         const DimensionVector& globalSize, const DimensionVector& localSize, const std::vector<std::string>& typeNames = {});
+    KernelDefinitionId AddHostKernelDefinition(const std::string& name, HostFunction function, const DimensionVector& globalSize,
+        const DimensionVector& localSize);
     KernelDefinitionId GetKernelDefinitionId(const std::string& name, const std::vector<std::string>& typeNames = {}) const;
     void RemoveKernelDefinition(const KernelDefinitionId id);
     void SetArguments(const KernelDefinitionId id, const std::vector<ArgumentId>& argumentIds);
@@ -71,14 +79,24 @@ public:
     void RemoveArgument(const ArgumentId& id);
     void SaveArgument(const ArgumentId& id, const std::string& file) const;
     void SetReadOnlyArgumentCache(const bool flag);
+    void SetReadWriteArgumentSnapshot(const bool flag);
 
     // Kernel running and validation
     KernelResult RunKernel(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
         const std::vector<BufferOutputDescriptor>& output);
+    KernelResult RunKernelAsync(const KernelId id, const KernelConfiguration& configuration, const KernelDimensions& dimensions,
+        const std::vector<BufferOutputDescriptor>& output, OutputCallback callback);
+    void WaitForOutputs();
     void SetProfiling(const bool flag);
     bool GetProfiling();
+    void SetMeasurementPolicy(const uint64_t warmupRuns, const uint64_t minimumRuns, const uint64_t maximumRuns,
+        const double targetRelativeWidth);
+    void SetRacing(const bool flag, const uint64_t minimumRuns);
+    void CalibrateTimer();
     void SetValidationMethod(const ValidationMethod method, const double toleranceThreshold);
     void SetValidationMode(const ValidationMode mode);
+    void SetValidationSampleCount(const size_t count);
+    void SetReferenceResultCache(const std::string& directory, const std::string& referenceVersion);
     void SetValidationRange(const ArgumentId& id, const size_t range);
     void SetValueComparator(const ArgumentId& id, ValueComparator comparator);
     void SetReferenceComputation(const ArgumentId& id, ReferenceComputation computation);
@@ -88,15 +106,22 @@ public:
 
     // Kernel tuning and configurations
     std::vector<KernelResult> TuneKernel(const KernelId id, const KernelDimensions& dimensions, std::unique_ptr<StopCondition> stopCondition);
+    std::vector<KernelResult> TuneKernelDistributed(const KernelId id, const uint16_t port, const uint32_t leaseTimeout,
+        std::unique_ptr<StopCondition> stopCondition);
+    uint64_t RunTuningWorker(const KernelId id, const KernelDimensions& dimensions, const std::string& host, const uint16_t port);
+    bool RunSandboxWorker(const KernelId id, const KernelDimensions& dimensions);
     KernelResult TuneKernelIteration(const KernelId id, const KernelDimensions& dimensions, const std::vector<BufferOutputDescriptor>& output,
         const bool recomputeReference);
     std::vector<KernelResult> SimulateKernelTuning(const KernelId id, const std::vector<KernelResult>& results,
         std::unique_ptr<StopCondition> stopCondition);
+    void Precompile(const KernelId id, const uint64_t startIndex, const uint64_t endIndex);
     void SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void SetTuningObjectives(const KernelId id, const std::vector<TuningObjective>& objectives, ObjectiveScalarization scalarization);
     void InitializeConfigurationData(const KernelId id);
     void ClearConfigurationData(const KernelId id);
     uint64_t GetConfigurationsCount(const KernelId id) const;
     KernelConfiguration GetBestConfiguration(const KernelId id) const;
+    std::vector<KernelResult> GetParetoFront(const KernelId id) const;
     KernelConfiguration CreateConfiguration(const KernelId id, const ParameterInput& parameters) const;
     std::string GetKernelSource(const KernelId id, const KernelConfiguration& configuration) const;
     std::string GetKernelDefinitionSource(const KernelDefinitionId id, const KernelConfiguration& configuration) const;
@@ -120,6 +145,16 @@ public:
     void SetGlobalSizeType(const GlobalSizeType type);
     void SetAutomaticGlobalSizeCorrection(const bool flag);
     void SetKernelCacheCapacity(const uint64_t capacity);
+    void SetKernelCacheMemoryLimit(const uint64_t limit);
+    void SetKernelCachePolicy(const KernelCachePolicy policy);
+    KernelCacheStatistics GetKernelCacheStatistics() const;
+    void SetCompilationLookahead(const uint64_t count);
+    void SetSandboxedExecution(const bool flag, const double timeoutFactor, const uint32_t minimumTimeout,
+        const std::vector<std::string>& workerArguments);
+    void SetOutlierDetection(const uint64_t sentinelInterval);
+    void SetKernelBinaryCache(const std::string& directory, const uint64_t maximumSize);
+    void SetStagingMemoryLimit(const uint64_t limit);
+    TransferStatistics GetTransferStatistics() const;
     std::vector<PlatformInfo> GetPlatformInfo() const;
     std::vector<DeviceInfo> GetDeviceInfo(const PlatformIndex platform) const;
     DeviceInfo GetCurrentDeviceInfo() const;
@@ -134,16 +169,29 @@ public:
 private:
     std::unique_ptr<KernelArgumentManager> m_ArgumentManager;
     std::unique_ptr<KernelManager> m_KernelManager;
+    std::unique_ptr<VirtualClock> m_VirtualClock;
     std::unique_ptr<ComputeEngine> m_ComputeEngine;
     std::unique_ptr<KernelRunner> m_KernelRunner;
+    std::vector<std::unique_ptr<ComputeEngine>> m_ParallelEngines;
+    std::vector<std::unique_ptr<KernelRunner>> m_ParallelRunners;
     std::unique_ptr<TuningRunner> m_TuningRunner;
+    bool m_ReplayFlag;
 
     void InitializeComputeEngine(const PlatformIndex platform, const DeviceIndex device, const ComputeApi api, const uint32_t queueCount);
     void InitializeComputeEngine(const ComputeApi api, const ComputeApiInitializer& initializer, std::vector<QueueId>& assignedQueueIds);
     void InitializeRunners();
+    void InitializeParallelRunners(const PlatformIndex platform, const std::vector<DeviceIndex>& devices, const ComputeApi api,
+        const uint32_t subDeviceCount);
+    std::vector<KernelRunner*> GetKernelRunners() const;
+    std::vector<ComputeEngine*> GetComputeEngines() const;
+
+    static std::unique_ptr<ComputeEngine> CreateComputeEngine(const PlatformIndex platform, const DeviceIndex device,
+        const ComputeApi api, const uint32_t queueCount);
 
     static std::unique_ptr<Serializer> CreateSerializer(const OutputFormat format);
     static std::unique_ptr<Deserializer> CreateDeserializer(const OutputFormat format);
+    static std::pair<TunerMetadata, std::vector<KernelResult>> ReadResults(const std::string& filePath, const OutputFormat format,
+        UserData& data);
 };
 
 } // namespace ktt
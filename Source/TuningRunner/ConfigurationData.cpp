@@ -14,12 +14,20 @@
 namespace ktt
 {
 
-ConfigurationData::ConfigurationData(Searcher& searcher, const Kernel& kernel) :
-    m_BestConfiguration({KernelConfiguration(), InvalidDuration}),
+ConfigurationData::ConfigurationData(Searcher& searcher, const Kernel& kernel, const std::vector<TuningObjective>& objectives,
+    ObjectiveScalarization scalarization) :
+    m_BestConfiguration({KernelConfiguration(), m_InvalidScore}),
+    m_Objectives(objectives),
+    m_Scalarization(scalarization),
     m_Searcher(searcher),
     m_Kernel(kernel),
     m_SearcherActive(false)
 {
+    if (m_Objectives.empty())
+    {
+        m_Objectives.push_back(TuningObjective::TotalDuration);
+    }
+
     InitializeConfigurations();
 }
 
@@ -64,6 +72,29 @@ bool ConfigurationData::CalculateNextConfiguration(const KernelResult& previousR
     return m_SearcherActive;
 }
 
+void ConfigurationData::UpdateResult(const KernelResult& result)
+{
+    const auto& configuration = result.GetConfiguration();
+    m_ParetoFront.Erase(configuration);
+    m_Scores.erase(GetIndexForConfiguration(configuration));
+
+    if (result.IsValid())
+    {
+        UpdateBestConfiguration(result);
+    }
+
+    // Updated result may be worse than the original one, so the best configuration is chosen again from all scores
+    const auto best = std::min_element(m_Scores.cbegin(), m_Scores.cend(), [](const auto& first, const auto& second)
+    {
+        return first.second < second.second;
+    });
+
+    if (best != m_Scores.cend())
+    {
+        m_BestConfiguration = {GetConfigurationForIndex(best->first), best->second};
+    }
+}
+
 void ConfigurationData::ListConfigurations() const
 {
     Logger::LogInfo("Listing all configurations for kernel " + m_Kernel.GetName());
@@ -212,9 +243,19 @@ KernelConfiguration ConfigurationData::GetCurrentConfiguration() const
     return m_Searcher.GetCurrentConfiguration();
 }
 
+std::vector<KernelConfiguration> ConfigurationData::GetUpcomingConfigurations(const size_t count) const
+{
+    if (!m_Searcher.IsInitialized() || IsProcessed())
+    {
+        return {};
+    }
+
+    return m_Searcher.GetUpcomingConfigurations(count);
+}
+
 KernelConfiguration ConfigurationData::GetBestConfiguration() const
 {
-    if (m_BestConfiguration.second != InvalidDuration)
+    if (m_BestConfiguration.second != m_InvalidScore)
     {
         return m_BestConfiguration.first;
     }
@@ -222,6 +263,63 @@ KernelConfiguration ConfigurationData::GetBestConfiguration() const
     return GetCurrentConfiguration();
 }
 
+const std::vector<TuningObjective>& ConfigurationData::GetObjectives() const
+{
+    return m_Objectives;
+}
+
+std::vector<double> ConfigurationData::GetObjectiveValues(const KernelResult& result) const
+{
+    std::vector<double> values;
+
+    for (const auto objective : m_Objectives)
+    {
+        switch (objective)
+        {
+        case TuningObjective::TotalDuration:
+            // Median of repeated runs is less sensitive to measurement noise than a single run
+            values.push_back(static_cast<double>(result.HasMeasurementStatistics() ? result.GetMeasurementStatistics().m_Median
+                : result.GetTotalDuration()));
+            break;
+        case TuningObjective::KernelDuration:
+            values.push_back(static_cast<double>(result.GetKernelDuration()));
+            break;
+        case TuningObjective::CompilationOverhead:
+            values.push_back(static_cast<double>(result.GetCompilationOverhead()));
+            break;
+        case TuningObjective::EnergyConsumption:
+        {
+            double energy = 0.0;
+
+            for (const auto& partialResult : result.GetResults())
+            {
+                if (partialResult.HasPowerData())
+                {
+                    energy += partialResult.GetEnergyConsumption();
+                }
+            }
+
+            values.push_back(energy);
+            break;
+        }
+        default:
+            KttError("Unhandled tuning objective");
+        }
+    }
+
+    return values;
+}
+
+bool ConfigurationData::IsBestCandidate(const KernelResult& result) const
+{
+    return result.IsValid() && ComputeScore(result) < m_BestConfiguration.second;
+}
+
+std::vector<KernelResult> ConfigurationData::GetParetoFront() const
+{
+    return m_ParetoFront.GetResults();
+}
+
 void ConfigurationData::InitializeConfigurations()
 {
     const auto groups = m_Kernel.GenerateParameterGroups();
@@ -260,7 +358,7 @@ void ConfigurationData::InitializeConfigurations()
         initialBest.Merge(forest->GetConfiguration(0));
     }
 
-    m_BestConfiguration = {initialBest, InvalidDuration};
+    m_BestConfiguration = {initialBest, m_InvalidScore};
     m_SearcherActive = true;
     m_Searcher.Initialize(*this);
     Logger::LogInfo("Searcher selected configuration " + std::to_string(GetIndexForConfiguration(m_Searcher.GetCurrentConfiguration())) + ": " + m_Searcher.GetCurrentConfiguration().GetString());
@@ -269,18 +367,30 @@ void ConfigurationData::InitializeConfigurations()
 void ConfigurationData::UpdateBestConfiguration(const KernelResult& previousResult)
 {
     const auto& configuration = previousResult.GetConfiguration();
-    const Nanoseconds duration = previousResult.GetTotalDuration();
+    const std::vector<double> values = GetObjectiveValues(previousResult);
+    m_ParetoFront.Insert(previousResult, values);
+
+    const double score = ComputeScore(previousResult);
+    m_Scores[GetIndexForConfiguration(configuration)] = score;
 
-    if (duration < m_BestConfiguration.second)
+    if (score < m_BestConfiguration.second)
     {
         m_BestConfiguration.first = configuration;
-        m_BestConfiguration.second = duration;
+        m_BestConfiguration.second = score;
     }
 }
 
+double ConfigurationData::ComputeScore(const KernelResult& result) const
+{
+    const std::vector<double> values = GetObjectiveValues(result);
+
+    // Without scalarization, the first objective is the primary one and decides the single best configuration
+    return m_Scalarization ? m_Scalarization(values) : values[0];
+}
+
 const ConfigurationForest& ConfigurationData::GetLocalForest(const KernelConfiguration& configuration) const
 {
-    KttAssert(!IsProcessed(), "This should not be called after configuration space exploration is finished.");
+    // Forests are kept after the exploration is finished, so that results of explored configurations can still be updated
     const auto& pairs = configuration.GetPairs();
 
     if (pairs.empty())
@@ -1,13 +1,17 @@
 #pragma once
 
+#include <limits>
+#include <map>
 #include <set>
 #include <utility>
 #include <vector>
 
 #include <Api/Configuration/KernelConfiguration.h>
+#include <Api/Output/TuningObjective.h>
 #include <Api/Searcher/Searcher.h>
 #include <Kernel/Kernel.h>
 #include <TuningRunner/ConfigurationForest.h>
+#include <TuningRunner/ParetoFront.h>
 #include <Utility/RandomIntGenerator.h>
 #include <KttTypes.h>
 
@@ -17,10 +21,12 @@ namespace ktt
 class ConfigurationData
 {
 public:
-    explicit ConfigurationData(Searcher& searcher, const Kernel& kernel);
+    explicit ConfigurationData(Searcher& searcher, const Kernel& kernel, const std::vector<TuningObjective>& objectives = {},
+        ObjectiveScalarization scalarization = nullptr);
     ~ConfigurationData();
 
     bool CalculateNextConfiguration(const KernelResult& previousResult);
+    void UpdateResult(const KernelResult& result);
     void ListConfigurations() const;
 
     KernelConfiguration GetConfigurationForIndex(const uint64_t index) const;
@@ -34,19 +40,31 @@ public:
     const std::set<uint64_t>& GetExploredConfigurations() const;
     bool IsProcessed() const;
     KernelConfiguration GetCurrentConfiguration() const;
+    std::vector<KernelConfiguration> GetUpcomingConfigurations(const size_t count) const;
     KernelConfiguration GetBestConfiguration() const;
+    bool IsBestCandidate(const KernelResult& result) const;
+    const std::vector<TuningObjective>& GetObjectives() const;
+    std::vector<double> GetObjectiveValues(const KernelResult& result) const;
+    std::vector<KernelResult> GetParetoFront() const;
 
 private:
     std::vector<std::unique_ptr<ConfigurationForest>> m_Forests;
     std::set<uint64_t> m_ExploredConfigurations;
-    std::pair<KernelConfiguration, Nanoseconds> m_BestConfiguration;
+    std::pair<KernelConfiguration, double> m_BestConfiguration;
+    std::map<uint64_t, double> m_Scores;
+    std::vector<TuningObjective> m_Objectives;
+    ObjectiveScalarization m_Scalarization;
+    ParetoFront m_ParetoFront;
     mutable RandomIntGenerator<uint64_t> m_Generator;
     Searcher& m_Searcher;
     const Kernel& m_Kernel;
     bool m_SearcherActive;
 
+    inline static const double m_InvalidScore = std::numeric_limits<double>::max();
+
     void InitializeConfigurations();
     void UpdateBestConfiguration(const KernelResult& previousResult);
+    double ComputeScore(const KernelResult& result) const;
     const ConfigurationForest& GetLocalForest(const KernelConfiguration& configuration) const;
 };
 
@@ -22,6 +22,14 @@ void ConfigurationManager::SetSearcher(const KernelId id, std::unique_ptr<Search
     m_Searchers[id] = std::move(searcher);
 }
 
+void ConfigurationManager::SetObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+    ObjectiveScalarization scalarization)
+{
+    Logger::LogDebug("Setting tuning objectives for kernel with id " + std::to_string(id));
+    ClearData(id);
+    m_Objectives[id] = {objectives, scalarization};
+}
+
 void ConfigurationManager::InitializeData(const Kernel& kernel)
 {
     const auto id = kernel.GetId();
@@ -32,7 +40,14 @@ void ConfigurationManager::InitializeData(const Kernel& kernel)
         m_Searchers[id] = std::make_unique<DeterministicSearcher>();
     }
 
-    m_ConfigurationData[id] = std::make_unique<ConfigurationData>(*m_Searchers[id], kernel);
+    if (!ContainsKey(m_Objectives, id))
+    {
+        m_ConfigurationData[id] = std::make_unique<ConfigurationData>(*m_Searchers[id], kernel);
+        return;
+    }
+
+    const auto& objectives = m_Objectives[id];
+    m_ConfigurationData[id] = std::make_unique<ConfigurationData>(*m_Searchers[id], kernel, objectives.first, objectives.second);
 }
 
 void ConfigurationManager::ClearData(const KernelId id, const bool clearSearcher)
@@ -43,6 +58,7 @@ void ConfigurationManager::ClearData(const KernelId id, const bool clearSearcher
     if (clearSearcher)
     {
         m_Searchers.erase(id);
+        m_Objectives.erase(id);
     }
 }
 
@@ -52,6 +68,12 @@ bool ConfigurationManager::CalculateNextConfiguration(const KernelId id, const K
     return m_ConfigurationData[id]->CalculateNextConfiguration(previousResult);
 }
 
+void ConfigurationManager::UpdateResult(const KernelId id, const KernelResult& result)
+{
+    KttAssert(HasData(id), "Results can only be updated for kernels with initialized configuration data");
+    m_ConfigurationData[id]->UpdateResult(result);
+}
+
 void ConfigurationManager::ListConfigurations(const KernelId id) const
 {
     KttAssert(HasData(id), "Configurations can only be listed for kernels with initialized configuration data");
@@ -100,6 +122,24 @@ KernelConfiguration ConfigurationManager::GetCurrentConfiguration(const KernelId
     return m_ConfigurationData.find(id)->second->GetCurrentConfiguration();
 }
 
+KernelConfiguration ConfigurationManager::GetConfigurationForIndex(const KernelId id, const uint64_t index) const
+{
+    KttAssert(HasData(id), "Configuration can only be retrieved for kernels with initialized configuration data");
+    return m_ConfigurationData.find(id)->second->GetConfigurationForIndex(index);
+}
+
+uint64_t ConfigurationManager::GetIndexForConfiguration(const KernelId id, const KernelConfiguration& configuration) const
+{
+    KttAssert(HasData(id), "Configuration index can only be retrieved for kernels with initialized configuration data");
+    return m_ConfigurationData.find(id)->second->GetIndexForConfiguration(configuration);
+}
+
+std::vector<KernelConfiguration> ConfigurationManager::GetUpcomingConfigurations(const KernelId id, const size_t count) const
+{
+    KttAssert(HasData(id), "Upcoming configurations can only be retrieved for kernels with initialized configuration data");
+    return m_ConfigurationData.find(id)->second->GetUpcomingConfigurations(count);
+}
+
 KernelConfiguration ConfigurationManager::GetBestConfiguration(const KernelId id) const
 {
     if (!HasData(id))
@@ -110,4 +150,20 @@ KernelConfiguration ConfigurationManager::GetBestConfiguration(const KernelId id
     return m_ConfigurationData.find(id)->second->GetBestConfiguration();
 }
 
+bool ConfigurationManager::IsBestCandidate(const KernelId id, const KernelResult& result) const
+{
+    KttAssert(HasData(id), "Results can only be compared for kernels with initialized configuration data");
+    return m_ConfigurationData.find(id)->second->IsBestCandidate(result);
+}
+
+std::vector<KernelResult> ConfigurationManager::GetParetoFront(const KernelId id) const
+{
+    if (!HasData(id))
+    {
+        throw KttException("Pareto front can only be retrieved for kernels with initialized configuration data");
+    }
+
+    return m_ConfigurationData.find(id)->second->GetParetoFront();
+}
+
 } // namespace ktt
@@ -6,6 +6,7 @@
 
 #include <Api/Configuration/KernelConfiguration.h>
 #include <Api/Output/KernelResult.h>
+#include <Api/Output/TuningObjective.h>
 #include <Api/Searcher/Searcher.h>
 #include <Kernel/Kernel.h>
 #include <TuningRunner/ConfigurationData.h>
@@ -20,9 +21,11 @@ public:
     ConfigurationManager();
 
     void SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void SetObjectives(const KernelId id, const std::vector<TuningObjective>& objectives, ObjectiveScalarization scalarization);
     void InitializeData(const Kernel& kernel);
     void ClearData(const KernelId id, const bool clearSearcher = false);
     bool CalculateNextConfiguration(const KernelId id, const KernelResult& previousResult);
+    void UpdateResult(const KernelId id, const KernelResult& result);
     void ListConfigurations(const KernelId id) const;
 
     bool HasData(const KernelId id) const;
@@ -30,10 +33,16 @@ public:
     uint64_t GetTotalConfigurationsCount(const KernelId id) const;
     uint64_t GetExploredConfigurationsCount(const KernelId id) const;
     KernelConfiguration GetCurrentConfiguration(const KernelId id) const;
+    KernelConfiguration GetConfigurationForIndex(const KernelId id, const uint64_t index) const;
+    uint64_t GetIndexForConfiguration(const KernelId id, const KernelConfiguration& configuration) const;
+    std::vector<KernelConfiguration> GetUpcomingConfigurations(const KernelId id, const size_t count) const;
     KernelConfiguration GetBestConfiguration(const KernelId id) const;
+    bool IsBestCandidate(const KernelId id, const KernelResult& result) const;
+    std::vector<KernelResult> GetParetoFront(const KernelId id) const;
 
 private:
     std::map<KernelId, std::unique_ptr<Searcher>> m_Searchers;
+    std::map<KernelId, std::pair<std::vector<TuningObjective>, ObjectiveScalarization>> m_Objectives;
     std::map<KernelId, std::unique_ptr<ConfigurationData>> m_ConfigurationData;
 };
 
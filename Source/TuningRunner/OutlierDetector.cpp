@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+
+#include <TuningRunner/OutlierDetector.h>
+#include <Utility/ErrorHandling/Assert.h>
+
+namespace ktt
+{
+
+OutlierDetector::OutlierDetector() :
+    m_HasSentinel(false)
+{}
+
+void OutlierDetector::SetSentinel(const KernelConfiguration& configuration, const Nanoseconds duration)
+{
+    m_Sentinel = configuration;
+    m_SentinelDurations.clear();
+    m_HasSentinel = true;
+    AddSentinelDuration(duration);
+}
+
+void OutlierDetector::AddSentinelDuration(const Nanoseconds duration)
+{
+    KttAssert(m_HasSentinel, "Sentinel durations can only be added after sentinel configuration is set");
+    m_SentinelDurations.push_back(duration);
+
+    if (m_SentinelDurations.size() > m_HistorySize)
+    {
+        m_SentinelDurations.pop_front();
+    }
+}
+
+bool OutlierDetector::HasSentinel() const
+{
+    return m_HasSentinel;
+}
+
+const KernelConfiguration& OutlierDetector::GetSentinel() const
+{
+    return m_Sentinel;
+}
+
+Nanoseconds OutlierDetector::GetTypicalDuration() const
+{
+    const std::vector<double> durations(m_SentinelDurations.cbegin(), m_SentinelDurations.cend());
+    return static_cast<Nanoseconds>(ComputeMedian(durations));
+}
+
+bool OutlierDetector::IsOutlier(const Nanoseconds duration) const
+{
+    const auto typicalDuration = static_cast<double>(GetTypicalDuration());
+    return std::fabs(static_cast<double>(duration) - typicalDuration) > GetAllowedDeviation();
+}
+
+double OutlierDetector::GetDriftFactor(const Nanoseconds duration) const
+{
+    if (duration == 0)
+    {
+        return 1.0;
+    }
+
+    return static_cast<double>(GetTypicalDuration()) / static_cast<double>(duration);
+}
+
+bool OutlierDetector::AreConsistent(const Nanoseconds first, const Nanoseconds second)
+{
+    const auto larger = static_cast<double>(std::max(first, second));
+    const auto smaller = static_cast<double>(std::min(first, second));
+    return larger - smaller <= m_MinimumRelativeDeviation * larger;
+}
+
+double OutlierDetector::GetAllowedDeviation() const
+{
+    const auto typicalDuration = static_cast<double>(GetTypicalDuration());
+    std::vector<double> deviations;
+
+    for (const auto duration : m_SentinelDurations)
+    {
+        deviations.push_back(std::fabs(static_cast<double>(duration) - typicalDuration));
+    }
+
+    const double medianDeviation = ComputeMedian(deviations);
+    return std::max(m_OutlierThreshold * m_DeviationScale * medianDeviation, m_MinimumRelativeDeviation * typicalDuration);
+}
+
+double OutlierDetector::ComputeMedian(std::vector<double> values)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+
+    const auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+
+    if (values.size() % 2 == 1)
+    {
+        return *middle;
+    }
+
+    const double lower = *std::max_element(values.begin(), middle);
+    return (lower + *middle) / 2.0;
+}
+
+} // namespace ktt
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <Api/Configuration/KernelConfiguration.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+// Device performance is tracked through repeated measurements of a single sentinel configuration, durations of different
+// configurations cannot be compared with each other
+class OutlierDetector
+{
+public:
+    OutlierDetector();
+
+    void SetSentinel(const KernelConfiguration& configuration, const Nanoseconds duration);
+    void AddSentinelDuration(const Nanoseconds duration);
+
+    bool HasSentinel() const;
+    const KernelConfiguration& GetSentinel() const;
+    Nanoseconds GetTypicalDuration() const;
+    bool IsOutlier(const Nanoseconds duration) const;
+    double GetDriftFactor(const Nanoseconds duration) const;
+
+    static bool AreConsistent(const Nanoseconds first, const Nanoseconds second);
+
+private:
+    KernelConfiguration m_Sentinel;
+    std::deque<Nanoseconds> m_SentinelDurations;
+    bool m_HasSentinel;
+
+    double GetAllowedDeviation() const;
+    static double ComputeMedian(std::vector<double> values);
+
+    inline static const size_t m_HistorySize = 16;
+
+    // Threshold of modified z-score (Iglewicz and Hoaglin), scale factor makes median absolute deviation consistent with
+    // standard deviation of normal distribution
+    inline static const double m_OutlierThreshold = 3.5;
+    inline static const double m_DeviationScale = 1.4826;
+
+    // Deviation which is always tolerated, median absolute deviation of a few nearly identical durations may be close to zero
+    inline static const double m_MinimumRelativeDeviation = 0.1;
+};
+
+} // namespace ktt
@@ -0,0 +1,87 @@
+#include <algorithm>
+
+#include <TuningRunner/ParetoFront.h>
+#include <Utility/ErrorHandling/Assert.h>
+#include <Utility/StlHelpers.h>
+
+namespace ktt
+{
+
+bool ParetoFront::Insert(const KernelResult& result, const std::vector<double>& objectiveValues)
+{
+    const bool dominated = std::any_of(m_Entries.cbegin(), m_Entries.cend(), [&objectiveValues](const auto& entry)
+    {
+        return Dominates(entry.second, objectiveValues) || entry.second == objectiveValues;
+    });
+
+    if (dominated)
+    {
+        return false;
+    }
+
+    EraseIf(m_Entries, [&objectiveValues](const auto& entry)
+    {
+        return Dominates(objectiveValues, entry.second);
+    });
+
+    m_Entries.emplace_back(result, objectiveValues);
+    return true;
+}
+
+void ParetoFront::Erase(const KernelConfiguration& configuration)
+{
+    EraseIf(m_Entries, [&configuration](const auto& entry)
+    {
+        return entry.first.GetConfiguration() == configuration;
+    });
+}
+
+void ParetoFront::Clear()
+{
+    m_Entries.clear();
+}
+
+const std::vector<std::pair<KernelResult, std::vector<double>>>& ParetoFront::GetEntries() const
+{
+    return m_Entries;
+}
+
+std::vector<KernelResult> ParetoFront::GetResults() const
+{
+    std::vector<KernelResult> results;
+
+    for (const auto& entry : m_Entries)
+    {
+        results.push_back(entry.first);
+    }
+
+    return results;
+}
+
+size_t ParetoFront::GetSize() const
+{
+    return m_Entries.size();
+}
+
+bool ParetoFront::Dominates(const std::vector<double>& first, const std::vector<double>& second)
+{
+    KttAssert(first.size() == second.size(), "Objective vectors must have the same size");
+    bool strictlyBetter = false;
+
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        if (first[i] > second[i])
+        {
+            return false;
+        }
+
+        if (first[i] < second[i])
+        {
+            strictlyBetter = true;
+        }
+    }
+
+    return strictlyBetter;
+}
+
+} // namespace ktt
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <Api/Output/KernelResult.h>
+
+namespace ktt
+{
+
+class ParetoFront
+{
+public:
+    ParetoFront() = default;
+
+    bool Insert(const KernelResult& result, const std::vector<double>& objectiveValues);
+    void Erase(const KernelConfiguration& configuration);
+    void Clear();
+
+    const std::vector<std::pair<KernelResult, std::vector<double>>>& GetEntries() const;
+    std::vector<KernelResult> GetResults() const;
+    size_t GetSize() const;
+
+    static bool Dominates(const std::vector<double>& first, const std::vector<double>& second);
+
+private:
+    std::vector<std::pair<KernelResult, std::vector<double>>> m_Entries;
+};
+
+} // namespace ktt
@@ -0,0 +1,388 @@
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+
+#include <Api/KttException.h>
+#include <TuningRunner/ProfileBased/BottleneckAnalyzer.h>
+#include <Utility/Logger/Logger.h>
+
+namespace ktt
+{
+
+std::string Bottlenecks::GetString() const
+{
+    std::stringstream stream;
+    stream << "DRAM read: " << m_DramRead << ", DRAM write: " << m_DramWrite << ", L2 read: " << m_L2Read << ", L2 write: "
+        << m_L2Write << ", texture: " << m_Texture << ", local: " << m_Local << ", shared read: " << m_SharedRead
+        << ", shared write: " << m_SharedWrite << ", MP parallelism: " << m_MultiprocessorParallelism << ", global parallelism: "
+        << m_GlobalParallelism << ", tail effect: " << m_TailEffect << ", threads: " << m_Threads << ", SP: " << m_SinglePrecision
+        << ", DP: " << m_DoublePrecision << ", SFU: " << m_SpecialFunction << ", CF: " << m_ControlFlow << ", LDST: " << m_LoadStore
+        << ", texture FU: " << m_TextureUnit << ", integer: " << m_Integer << ", misc: " << m_Miscellaneous << ", bit conversion: "
+        << m_BitConversion << ", instruction issue: " << m_InstructionIssue;
+    return stream.str();
+}
+
+BottleneckAnalyzer::BottleneckAnalyzer(const uint32_t computeCapabilityMajor, const uint32_t computeCapabilityMinor,
+    const uint32_t multiprocessors) :
+    m_ComputeCapability(static_cast<double>(computeCapabilityMajor) + 0.1 * static_cast<double>(computeCapabilityMinor)),
+    m_Multiprocessors(multiprocessors),
+    m_Cores(GetCoresPerMultiprocessor(computeCapabilityMajor, computeCapabilityMinor) * multiprocessors)
+{}
+
+// Scores bottlenecks in interval <0, 1> based on observed profiling counters, implemented for CUDA compute capabilities 3.0 - 8.6
+Bottlenecks BottleneckAnalyzer::AnalyzeBottlenecks(const std::vector<std::string>& counterNames,
+    const std::vector<double>& counterValues) const
+{
+    const auto counter = [&counterNames, &counterValues](const std::string& name)
+    {
+        const auto iterator = std::find(counterNames.cbegin(), counterNames.cend(), name);
+
+        if (iterator == counterNames.cend())
+        {
+            throw KttException("Profiling counter " + name + " required by profile-based searcher was not collected");
+        }
+
+        return counterValues[static_cast<size_t>(std::distance(counterNames.cbegin(), iterator))];
+    };
+
+    const bool legacy = m_ComputeCapability < 7.0;
+    Bottlenecks result;
+
+    // Global memory
+    double dramUtilization;
+    double dramReads;
+    double dramWrites;
+
+    if (legacy)
+    {
+        dramUtilization = counter("dram_utilization");
+        dramReads = counter("dram_read_transactions");
+        dramWrites = counter("dram_write_transactions");
+    }
+    else
+    {
+        dramUtilization = counter("dram__throughput.avg.pct_of_peak_sustained_elapsed") / 10.0;
+        dramReads = counter("dram__sectors_read.sum");
+        dramWrites = counter("dram__sectors_write.sum");
+    }
+
+    if (dramReads + dramWrites > 0.0 && dramUtilization > 0.0)
+    {
+        result.m_DramRead = dramReads / (dramReads + dramWrites) * (dramUtilization / 10.0);
+        result.m_DramWrite = dramWrites / (dramReads + dramWrites) * (dramUtilization / 10.0);
+    }
+    else
+    {
+        result.m_DramRead = 0.0;
+        result.m_DramWrite = 0.0;
+    }
+
+    // Cache system
+    double l2Utilization;
+    double l2Reads;
+    double l2Writes;
+    double textureUtilization;
+
+    if (legacy)
+    {
+        l2Utilization = counter("l2_utilization");
+        l2Reads = counter("l2_read_transactions");
+        l2Writes = counter("l2_write_transactions");
+        textureUtilization = counter("tex_utilization");
+    }
+    else
+    {
+        l2Utilization = counter("lts__t_sectors.avg.pct_of_peak_sustained_elapsed") / 10.0;
+        l2Reads = counter("lts__t_sectors_op_read.sum");
+        l2Writes = counter("lts__t_sectors_op_write.sum");
+        textureUtilization = counter("l1tex__t_requests_pipe_lsu_mem_global_op_ld.avg.pct_of_peak_sustained_active") / 10.0;
+    }
+
+    result.m_L2Read = Divide(l2Reads, l2Reads + l2Writes) * (l2Utilization / 10.0);
+    result.m_L2Write = Divide(l2Writes, l2Reads + l2Writes) * (l2Utilization / 10.0);
+    result.m_Texture = textureUtilization / 10.0;
+
+    // Local memory (non-register private memory in OpenCL)
+    double localOverhead;
+
+    if (legacy)
+    {
+        localOverhead = counter("local_memory_overhead");
+    }
+    else
+    {
+        localOverhead = Divide(100.0 * counter("l1tex__t_sectors_pipe_lsu_mem_local_op_st.sum"), l2Writes);
+    }
+
+    result.m_Local = localOverhead / 100.0 * std::max({dramUtilization / 10.0, l2Utilization / 10.0, textureUtilization / 10.0});
+
+    // Shared memory
+    double sharedUtilization;
+    double sharedReads;
+    double sharedWrites;
+
+    if (legacy)
+    {
+        sharedUtilization = m_ComputeCapability < 4.0 ? counter("shared_efficiency") : counter("shared_utilization");
+        sharedReads = counter("shared_load_transactions");
+        sharedWrites = counter("shared_store_transactions");
+    }
+    else
+    {
+        sharedUtilization = counter("l1tex__data_pipe_lsu_wavefronts_mem_shared.avg.pct_of_peak_sustained_elapsed") / 10.0;
+        sharedReads = counter("l1tex__data_pipe_lsu_wavefronts_mem_shared_op_ld.sum");
+        sharedWrites = counter("l1tex__data_pipe_lsu_wavefronts_mem_shared_op_st.sum");
+    }
+
+    result.m_SharedRead = Divide(sharedReads, sharedReads + sharedWrites) * (sharedUtilization / 10.0);
+    result.m_SharedWrite = Divide(sharedWrites, sharedReads + sharedWrites) * (sharedUtilization / 10.0);
+
+    // Multiprocessor and global parallelism, sm_efficiency is not used on older devices due to its unreliable behaviour with
+    // recent drivers
+    const double occupancy = legacy ? counter("achieved_occupancy")
+        : counter("sm__warps_active.avg.pct_of_peak_sustained_active") / 100.0;
+    result.m_MultiprocessorParallelism = 1.0 - occupancy;
+
+    const double smEfficiency = legacy ? 100.0 : counter("smsp__cycles_active.avg.pct_of_peak_sustained_elapsed");
+    result.m_GlobalParallelism = (100.0 - smEfficiency) / 100.0;
+
+    const double globalSize = counter("Global size");
+    const double threadBlocks = Divide(globalSize, counter("Local size"));
+    const auto multiprocessors = static_cast<double>(m_Multiprocessors);
+    result.m_TailEffect = 1.0 - Divide(threadBlocks, (threadBlocks + multiprocessors - 1.0) / multiprocessors * multiprocessors);
+
+    const auto cores = static_cast<double>(m_Cores);
+    result.m_Threads = std::max(0.0, Divide(cores * 5.0 - globalSize, cores * 5.0));
+
+    // Instruction counts
+    double spInstructions;
+    double dpInstructions;
+    double intInstructions;
+    double miscInstructions;
+    double ldstInstructions;
+    double controlInstructions;
+    double conversionInstructions;
+    double executedInstructions;
+
+    if (legacy)
+    {
+        spInstructions = counter("inst_fp_32");
+        dpInstructions = counter("inst_fp_64");
+        intInstructions = counter("inst_integer");
+        miscInstructions = counter("inst_misc");
+        ldstInstructions = counter("inst_compute_ld_st");
+        controlInstructions = counter("inst_control");
+        conversionInstructions = counter("inst_bit_convert");
+        executedInstructions = counter("inst_executed");
+    }
+    else
+    {
+        spInstructions = counter("smsp__sass_thread_inst_executed_op_fp32_pred_on.sum");
+        dpInstructions = counter("smsp__sass_thread_inst_executed_op_fp64_pred_on.sum");
+        intInstructions = counter("smsp__sass_thread_inst_executed_op_integer_pred_on.sum");
+        miscInstructions = counter("smsp__sass_thread_inst_executed_op_misc_pred_on.sum");
+        ldstInstructions = counter("smsp__sass_thread_inst_executed_op_memory_pred_on.sum");
+        controlInstructions = counter("smsp__sass_thread_inst_executed_op_control_pred_on.sum");
+        conversionInstructions = counter("smsp__sass_thread_inst_executed_op_conversion_pred_on.sum");
+        executedInstructions = counter("smsp__inst_executed.sum");
+    }
+
+    // Instruction utilization
+    double sfuUtilization;
+    double textureUnitUtilization;
+    double issueSlotUtilization;
+    double executionEfficiency;
+    double predicationEfficiency;
+
+    if (legacy)
+    {
+        sfuUtilization = m_ComputeCapability < 4.0 ? 0.0 : counter("special_fu_utilization");
+        textureUnitUtilization = counter("tex_fu_utilization");
+        issueSlotUtilization = counter("issue_slot_utilization");
+        executionEfficiency = m_ComputeCapability < 4.0 ? 100.0 : counter("warp_execution_efficiency");
+        predicationEfficiency = m_ComputeCapability < 4.0 ? 100.0 : counter("warp_nonpred_execution_efficiency");
+    }
+    else
+    {
+        sfuUtilization = counter("smsp__inst_executed_pipe_xu.avg.pct_of_peak_sustained_active") / 10.0;
+        textureUnitUtilization = counter("smsp__inst_executed_pipe_tex.avg.pct_of_peak_sustained_active") / 10.0;
+        issueSlotUtilization = counter("smsp__issue_active.avg.pct_of_peak_sustained_active");
+        executionEfficiency = counter("smsp__thread_inst_executed_per_inst_executed.ratio") * 100.0 / 32.0;
+        predicationEfficiency = counter("smsp__thread_inst_executed_per_inst_executed.pct");
+    }
+
+    const double fittedExecutedInstructions = executedInstructions * 32.0 * Divide(100.0, executionEfficiency)
+        * Divide(100.0, predicationEfficiency);
+
+    // Dual-issue causes maximum 50% utilization of instructions of a single type on newer devices
+    const double fittedUtilization = legacy ? issueSlotUtilization / 100.0 : std::min(1.0, issueSlotUtilization / 50.0);
+
+    result.m_SinglePrecision = Divide(spInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_DoublePrecision = Divide(dpInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_SpecialFunction = sfuUtilization / 10.0;
+    result.m_ControlFlow = Divide(controlInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_LoadStore = Divide(ldstInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_TextureUnit = textureUnitUtilization / 10.0;
+    result.m_Integer = Divide(intInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_Miscellaneous = Divide(miscInstructions, fittedExecutedInstructions) * fittedUtilization;
+    result.m_BitConversion = Divide(conversionInstructions, fittedExecutedInstructions) * fittedUtilization;
+
+    const double maxInstructionUtilization = std::max(
+    {
+        Divide(result.m_SinglePrecision, fittedUtilization),
+        Divide(result.m_DoublePrecision, fittedUtilization),
+        result.m_SpecialFunction,
+        Divide(result.m_ControlFlow, fittedUtilization),
+        Divide(result.m_LoadStore, fittedUtilization),
+        Divide(result.m_Integer, fittedUtilization),
+        Divide(result.m_Miscellaneous, fittedUtilization),
+        Divide(result.m_BitConversion, fittedUtilization)
+    });
+
+    double issueWeight = 0.0;
+
+    if (maxInstructionUtilization > m_InstructionBottleneckThreshold)
+    {
+        issueWeight = (maxInstructionUtilization - m_InstructionBottleneckThreshold) / (1.0 - m_InstructionBottleneckThreshold);
+    }
+
+    result.m_InstructionIssue = (100.0 - issueSlotUtilization) / 100.0 * issueWeight;
+    Logger::LogDebug("Profile-based searcher bottlenecks: " + result.GetString());
+    return result;
+}
+
+// Computes how the profiling counters should change according to bottlenecks. Absolute value of a change is its importance,
+// the sign is the required direction. Counters are ordered in the same way as model outputs.
+std::vector<double> BottleneckAnalyzer::ComputeChanges(const Bottlenecks& bottlenecks, const std::vector<std::string>& modelCounterNames,
+    const double modelComputeCapability) const
+{
+    std::vector<double> result(modelCounterNames.size(), 0.0);
+
+    const auto setChange = [&result, &modelCounterNames](const std::string& name, const double change)
+    {
+        const auto iterator = std::find(modelCounterNames.cbegin(), modelCounterNames.cend(), name);
+
+        if (iterator != modelCounterNames.cend())
+        {
+            result[static_cast<size_t>(std::distance(modelCounterNames.cbegin(), iterator))] = change;
+        }
+    };
+
+    const auto setInstructionChange = [&setChange](const std::string& name, const double bottleneck, const bool scaled)
+    {
+        if (bottleneck <= m_InstructionBottleneckThreshold)
+        {
+            return;
+        }
+
+        if (scaled)
+        {
+            setChange(name, -(bottleneck - m_InstructionBottleneckThreshold) / (1.0 - m_InstructionBottleneckThreshold));
+        }
+        else
+        {
+            setChange(name, -bottleneck);
+        }
+    };
+
+    if (modelComputeCapability < 7.0)
+    {
+        setChange("dram_read_transactions", -bottlenecks.m_DramRead);
+        setChange("dram_write_transactions", -bottlenecks.m_DramWrite);
+        setChange("l2_read_transactions", -bottlenecks.m_L2Read);
+        setChange("l2_write_transactions", -bottlenecks.m_L2Write);
+        setChange("tex_cache_transactions", -bottlenecks.m_Texture);
+        setChange("local_memory_overhead", -bottlenecks.m_Local);
+        setChange("shared_load_transactions", -bottlenecks.m_SharedRead);
+        setChange("shared_store_transactions", -bottlenecks.m_SharedWrite);
+
+        setInstructionChange("inst_fp_32", bottlenecks.m_SinglePrecision, true);
+
+        if (bottlenecks.m_SinglePrecision > m_InstructionBottleneckThreshold)
+        {
+            setChange("flop_sp_efficiency", (bottlenecks.m_SinglePrecision - m_InstructionBottleneckThreshold)
+                / (1.0 - m_InstructionBottleneckThreshold));
+        }
+
+        setInstructionChange("inst_fp_64", bottlenecks.m_DoublePrecision, true);
+        setInstructionChange("inst_control", bottlenecks.m_ControlFlow, true);
+        setInstructionChange("inst_compute_ld_st", bottlenecks.m_LoadStore, true);
+        setInstructionChange("inst_integer", bottlenecks.m_Integer, true);
+        setInstructionChange("inst_misc", bottlenecks.m_Miscellaneous, true);
+        setInstructionChange("inst_bit_convert", bottlenecks.m_BitConversion, true);
+        setChange("issue_slot_utilization", bottlenecks.m_InstructionIssue);
+        setChange("sm_efficiency", bottlenecks.m_GlobalParallelism);
+    }
+    else
+    {
+        setChange("dram__sectors_read.sum", -bottlenecks.m_DramRead);
+        setChange("dram__sectors_write.sum", -bottlenecks.m_DramWrite);
+        setChange("lts__t_sectors_op_read.sum", -bottlenecks.m_L2Read);
+        setChange("lts__t_sectors_op_write.sum", -bottlenecks.m_L2Write);
+        setChange("l1tex__t_requests_pipe_lsu_mem_global_op_ld.sum", -bottlenecks.m_Texture);
+        setChange("l1tex__t_sectors_pipe_lsu_mem_local_op_ld.sum", -bottlenecks.m_Local);
+        setChange("l1tex__t_sectors_pipe_lsu_mem_local_op_st.sum", -bottlenecks.m_Local);
+        setChange("l1tex__data_pipe_lsu_wavefronts_mem_shared_op_ld.sum", -bottlenecks.m_SharedRead);
+        setChange("l1tex__data_pipe_lsu_wavefronts_mem_shared_op_st.sum", -bottlenecks.m_SharedWrite);
+
+        setInstructionChange("smsp__sass_thread_inst_executed_op_fp32_pred_on.sum", bottlenecks.m_SinglePrecision, false);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_fp64_pred_on.sum", bottlenecks.m_DoublePrecision, false);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_control_pred_on.sum", bottlenecks.m_ControlFlow, true);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_memory_pred_on.sum", bottlenecks.m_LoadStore, true);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_integer_pred_on.sum", bottlenecks.m_Integer, true);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_misc_pred_on.sum", bottlenecks.m_Miscellaneous, true);
+        setInstructionChange("smsp__sass_thread_inst_executed_op_conversion_pred_on.sum", bottlenecks.m_BitConversion, true);
+        setChange("smsp__issue_active.avg.pct_of_peak_sustained_active", bottlenecks.m_InstructionIssue);
+        setChange("smsp__cycles_active.avg.pct_of_peak_sustained_elapsed", bottlenecks.m_GlobalParallelism);
+    }
+
+    setChange("Global size", bottlenecks.m_Threads);
+    return result;
+}
+
+double BottleneckAnalyzer::GetComputeCapability() const
+{
+    return m_ComputeCapability;
+}
+
+uint32_t BottleneckAnalyzer::GetCoresCount() const
+{
+    return m_Cores;
+}
+
+uint32_t BottleneckAnalyzer::GetCoresPerMultiprocessor(const uint32_t computeCapabilityMajor, const uint32_t computeCapabilityMinor)
+{
+    static const std::map<uint32_t, uint32_t> coresPerMultiprocessor =
+    {
+        {0x30, 192}, {0x32, 192}, {0x35, 192}, {0x37, 192},
+        {0x50, 128}, {0x52, 128}, {0x53, 128},
+        {0x60, 64}, {0x61, 128}, {0x62, 128},
+        {0x70, 64}, {0x72, 64}, {0x75, 64},
+        {0x80, 64}, {0x86, 64}
+    };
+
+    const uint32_t compact = (computeCapabilityMajor << 4) + computeCapabilityMinor;
+    const auto iterator = coresPerMultiprocessor.find(compact);
+
+    if (iterator != coresPerMultiprocessor.cend())
+    {
+        return iterator->second;
+    }
+
+    Logger::LogWarning("Unknown number of cores for compute capability " + std::to_string(computeCapabilityMajor) + "."
+        + std::to_string(computeCapabilityMinor) + ", using default value of " + std::to_string(m_DefaultCoresPerMultiprocessor));
+    return m_DefaultCoresPerMultiprocessor;
+}
+
+double BottleneckAnalyzer::Divide(const double dividend, const double divisor)
+{
+    if (divisor == 0.0)
+    {
+        return 0.0;
+    }
+
+    return dividend / divisor;
+}
+
+} // namespace ktt
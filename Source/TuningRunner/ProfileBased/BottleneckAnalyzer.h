@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+struct Bottlenecks
+{
+    double m_DramRead;
+    double m_DramWrite;
+    double m_L2Read;
+    double m_L2Write;
+    double m_Texture;
+    double m_Local;
+    double m_SharedRead;
+    double m_SharedWrite;
+    double m_MultiprocessorParallelism;
+    double m_GlobalParallelism;
+    double m_TailEffect;
+    double m_Threads;
+    double m_SinglePrecision;
+    double m_DoublePrecision;
+    double m_SpecialFunction;
+    double m_ControlFlow;
+    double m_LoadStore;
+    double m_TextureUnit;
+    double m_Integer;
+    double m_Miscellaneous;
+    double m_BitConversion;
+    double m_InstructionIssue;
+
+    std::string GetString() const;
+};
+
+class BottleneckAnalyzer
+{
+public:
+    explicit BottleneckAnalyzer(const uint32_t computeCapabilityMajor, const uint32_t computeCapabilityMinor,
+        const uint32_t multiprocessors);
+
+    Bottlenecks AnalyzeBottlenecks(const std::vector<std::string>& counterNames, const std::vector<double>& counterValues) const;
+    std::vector<double> ComputeChanges(const Bottlenecks& bottlenecks, const std::vector<std::string>& modelCounterNames,
+        const double modelComputeCapability) const;
+
+    double GetComputeCapability() const;
+    uint32_t GetCoresCount() const;
+
+private:
+    double m_ComputeCapability;
+    uint32_t m_Multiprocessors;
+    uint32_t m_Cores;
+
+    inline static const double m_InstructionBottleneckThreshold = 0.7;
+    inline static const uint32_t m_DefaultCoresPerMultiprocessor = 64;
+
+    static uint32_t GetCoresPerMultiprocessor(const uint32_t computeCapabilityMajor, const uint32_t computeCapabilityMinor);
+    static double Divide(const double dividend, const double divisor);
+};
+
+} // namespace ktt
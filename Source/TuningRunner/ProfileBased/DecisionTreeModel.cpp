@@ -0,0 +1,150 @@
+#include <fstream>
+#include <string>
+
+#include <json.hpp>
+
+#include <Api/KttException.h>
+#include <TuningRunner/ProfileBased/DecisionTreeModel.h>
+#include <Utility/ErrorHandling/Assert.h>
+
+namespace ktt
+{
+
+DecisionTreeModel::DecisionTreeModel(const std::string& file)
+{
+    std::ifstream inputStream(file);
+
+    if (!inputStream.is_open())
+    {
+        throw KttException("Unable to open profile-based searcher model file: " + file);
+    }
+
+    nlohmann::json input;
+
+    try
+    {
+        inputStream >> input;
+        m_ComputeCapability = input.at("ComputeCapability").get<double>();
+        m_ParameterNames = input.at("TuningParameters").get<std::vector<std::string>>();
+        m_CounterNames = input.at("ProfilingCounters").get<std::vector<std::string>>();
+
+        for (const auto& treeInput : input.at("Trees"))
+        {
+            Tree tree;
+            tree.m_LeftChildren = treeInput.at("LeftChildren").get<std::vector<int64_t>>();
+            tree.m_RightChildren = treeInput.at("RightChildren").get<std::vector<int64_t>>();
+            tree.m_Features = treeInput.at("Features").get<std::vector<int64_t>>();
+            tree.m_Thresholds = treeInput.at("Thresholds").get<std::vector<double>>();
+
+            for (const auto& nodeValues : treeInput.at("Values"))
+            {
+                const auto values = nodeValues.get<std::vector<double>>();
+                tree.m_Values.insert(tree.m_Values.end(), values.cbegin(), values.cend());
+            }
+
+            ValidateTree(tree);
+            m_Trees.push_back(std::move(tree));
+        }
+    }
+    catch (const nlohmann::json::exception& exception)
+    {
+        throw KttException("Invalid profile-based searcher model file " + file + ": " + exception.what());
+    }
+
+    if (m_Trees.empty())
+    {
+        throw KttException("Profile-based searcher model file " + file + " does not contain any trees");
+    }
+}
+
+// Prediction is the average of all trees in the ensemble, models with single tree are supported as well
+std::vector<double> DecisionTreeModel::Predict(const std::vector<double>& features) const
+{
+    KttAssert(features.size() == m_ParameterNames.size(), "Feature count does not match model tuning parameters");
+    std::vector<double> result(m_CounterNames.size(), 0.0);
+
+    for (const auto& tree : m_Trees)
+    {
+        const double* values = GetLeafValues(tree, features);
+
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] += values[i];
+        }
+    }
+
+    for (auto& value : result)
+    {
+        value /= static_cast<double>(m_Trees.size());
+    }
+
+    return result;
+}
+
+const std::vector<std::string>& DecisionTreeModel::GetParameterNames() const
+{
+    return m_ParameterNames;
+}
+
+const std::vector<std::string>& DecisionTreeModel::GetCounterNames() const
+{
+    return m_CounterNames;
+}
+
+double DecisionTreeModel::GetComputeCapability() const
+{
+    return m_ComputeCapability;
+}
+
+const double* DecisionTreeModel::GetLeafValues(const Tree& tree, const std::vector<double>& features) const
+{
+    size_t node = 0;
+
+    while (tree.m_LeftChildren[node] >= 0)
+    {
+        // Scikit-learn compares features in single precision
+        const auto feature = static_cast<float>(features[static_cast<size_t>(tree.m_Features[node])]);
+
+        if (static_cast<double>(feature) <= tree.m_Thresholds[node])
+        {
+            node = static_cast<size_t>(tree.m_LeftChildren[node]);
+        }
+        else
+        {
+            node = static_cast<size_t>(tree.m_RightChildren[node]);
+        }
+    }
+
+    return tree.m_Values.data() + node * m_CounterNames.size();
+}
+
+void DecisionTreeModel::ValidateTree(const Tree& tree) const
+{
+    const size_t nodeCount = tree.m_LeftChildren.size();
+
+    if (nodeCount == 0 || tree.m_RightChildren.size() != nodeCount || tree.m_Features.size() != nodeCount
+        || tree.m_Thresholds.size() != nodeCount || tree.m_Values.size() != nodeCount * m_CounterNames.size())
+    {
+        throw KttException("Profile-based searcher model contains tree with inconsistent node data");
+    }
+
+    for (size_t node = 0; node < nodeCount; ++node)
+    {
+        if (tree.m_LeftChildren[node] < 0)
+        {
+            continue;
+        }
+
+        // Children are always stored after their parent, which also guarantees that the tree traversal terminates
+        const auto left = static_cast<size_t>(tree.m_LeftChildren[node]);
+        const auto right = tree.m_RightChildren[node];
+
+        if (left <= node || left >= nodeCount || right <= static_cast<int64_t>(node) || right >= static_cast<int64_t>(nodeCount)
+            || tree.m_Features[node] < 0 || tree.m_Features[node] >= static_cast<int64_t>(m_ParameterNames.size()))
+        {
+            throw KttException("Profile-based searcher model contains tree with invalid node " + std::to_string(node));
+        }
+    }
+}
+
+} // namespace ktt
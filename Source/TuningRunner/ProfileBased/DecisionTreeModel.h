@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+class DecisionTreeModel
+{
+public:
+    explicit DecisionTreeModel(const std::string& file);
+
+    std::vector<double> Predict(const std::vector<double>& features) const;
+
+    const std::vector<std::string>& GetParameterNames() const;
+    const std::vector<std::string>& GetCounterNames() const;
+    double GetComputeCapability() const;
+
+private:
+    struct Tree
+    {
+        std::vector<int64_t> m_LeftChildren;
+        std::vector<int64_t> m_RightChildren;
+        std::vector<int64_t> m_Features;
+        std::vector<double> m_Thresholds;
+        std::vector<double> m_Values;
+    };
+
+    std::vector<std::string> m_ParameterNames;
+    std::vector<std::string> m_CounterNames;
+    std::vector<Tree> m_Trees;
+    double m_ComputeCapability;
+
+    const double* GetLeafValues(const Tree& tree, const std::vector<double>& features) const;
+    void ValidateTree(const Tree& tree) const;
+};
+
+} // namespace ktt
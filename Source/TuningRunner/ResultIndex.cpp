@@ -0,0 +1,211 @@
+#include <Api/KttException.h>
+#include <TuningRunner/ResultIndex.h>
+#include <Utility/Logger/Logger.h>
+#include <Utility/StlHelpers.h>
+
+namespace ktt
+{
+
+ResultIndex::ResultIndex(const std::vector<KernelResult>& results) :
+    m_Results(results)
+{
+    for (const auto& result : results)
+    {
+        AddParameterValues(result.GetConfiguration());
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        Key key;
+        std::vector<std::string> unknownValues;
+        GetKey(results[i].GetConfiguration(), key, unknownValues);
+
+        if (results[i].IsValid())
+        {
+            AddComputations(results[i], i, key);
+        }
+
+        // The first of duplicate results is kept, the same as with linear search
+        m_Entries.emplace(std::move(key), i);
+    }
+
+    if (m_Entries.size() < results.size())
+    {
+        Logger::LogWarning("Loaded results contain " + std::to_string(results.size() - m_Entries.size())
+            + " duplicate configurations, only the first result for each configuration is used");
+    }
+}
+
+const KernelResult& ResultIndex::Find(const KernelConfiguration& configuration) const
+{
+    Key key;
+    std::vector<std::string> unknownValues;
+
+    if (!GetKey(configuration, key, unknownValues))
+    {
+        std::string values;
+
+        for (const auto& value : unknownValues)
+        {
+            values += (values.empty() ? "" : ", ") + value;
+        }
+
+        throw KttException("Matching configuration was not found, loaded results do not contain parameter values: " + values);
+    }
+
+    const auto iterator = m_Entries.find(key);
+
+    if (iterator == m_Entries.cend())
+    {
+        throw KttException("Matching configuration was not found, loaded results do not contain this combination of parameter "
+            "values");
+    }
+
+    return m_Results[iterator->second];
+}
+
+const KernelResult* ResultIndex::TryFind(const KernelConfiguration& configuration) const
+{
+    Key key;
+    std::vector<std::string> unknownValues;
+
+    if (!GetKey(configuration, key, unknownValues))
+    {
+        return nullptr;
+    }
+
+    const auto iterator = m_Entries.find(key);
+
+    if (iterator == m_Entries.cend())
+    {
+        return nullptr;
+    }
+
+    return &m_Results[iterator->second];
+}
+
+const ComputationResult* ResultIndex::TryFind(const std::string& kernelFunction, const KernelConfiguration& configuration) const
+{
+    const auto function = m_KernelFunctions.find(kernelFunction);
+    Key key;
+    std::vector<std::string> unknownValues;
+
+    if (function == m_KernelFunctions.cend() || !GetKey(configuration, key, unknownValues))
+    {
+        return nullptr;
+    }
+
+    key.push_back(function->second);
+    const auto iterator = m_Computations.find(key);
+
+    if (iterator == m_Computations.cend())
+    {
+        return nullptr;
+    }
+
+    const auto [resultIndex, computationIndex] = iterator->second;
+    return &m_Results[resultIndex].GetResults()[computationIndex];
+}
+
+size_t ResultIndex::GetSize() const
+{
+    return m_Entries.size();
+}
+
+size_t ResultIndex::GetComputationCount() const
+{
+    return m_Computations.size();
+}
+
+size_t ResultIndex::KeyHash::operator()(const Key& key) const
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (const auto index : key)
+    {
+        hash ^= index;
+        hash *= 0x100000001B3ull;
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+void ResultIndex::AddParameterValues(const KernelConfiguration& configuration)
+{
+    for (const auto& pair : configuration.GetPairs())
+    {
+        const auto parameter = m_ParameterIndices.try_emplace(pair.GetName(), m_ParameterValues.size());
+
+        if (parameter.second)
+        {
+            m_ParameterValues.emplace_back();
+        }
+
+        auto& values = m_ParameterValues[parameter.first->second];
+        const bool hasValue = ContainsElementIf(values, [&pair](const auto& value)
+        {
+            return value.HasSameValue(pair);
+        });
+
+        if (!hasValue)
+        {
+            values.push_back(pair);
+        }
+    }
+}
+
+void ResultIndex::AddComputations(const KernelResult& result, const size_t resultIndex, const Key& key)
+{
+    const auto& computations = result.GetResults();
+
+    for (size_t i = 0; i < computations.size(); ++i)
+    {
+        const auto function = m_KernelFunctions.try_emplace(computations[i].GetKernelFunction(),
+            static_cast<uint32_t>(m_KernelFunctions.size()));
+
+        // Kernel function index is appended after parameter value indices
+        Key computationKey = key;
+        computationKey.push_back(function.first->second);
+        m_Computations.emplace(std::move(computationKey), std::make_pair(resultIndex, i));
+    }
+}
+
+bool ResultIndex::GetKey(const KernelConfiguration& configuration, Key& key, std::vector<std::string>& unknownValues) const
+{
+    // Parameters which are not present in configuration keep missing value, so configurations with different parameters differ
+    key.assign(m_ParameterValues.size(), m_MissingValue);
+
+    for (const auto& pair : configuration.GetPairs())
+    {
+        const auto parameter = m_ParameterIndices.find(pair.GetName());
+
+        if (parameter == m_ParameterIndices.cend())
+        {
+            unknownValues.push_back(pair.GetString());
+            continue;
+        }
+
+        // Each parameter usually has only a few distinct values, so they can be searched linearly
+        const auto& values = m_ParameterValues[parameter->second];
+        bool found = false;
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (values[i].HasSameValue(pair))
+            {
+                key[parameter->second] = static_cast<uint32_t>(i);
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            unknownValues.push_back(pair.GetString());
+        }
+    }
+
+    return unknownValues.empty();
+}
+
+} // namespace ktt
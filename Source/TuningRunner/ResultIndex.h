@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Api/Configuration/KernelConfiguration.h>
+#include <Api/Output/KernelResult.h>
+
+namespace ktt
+{
+
+// Configurations are keyed by indices of their parameter values, so that matching result is found without comparing strings.
+// Computation results of valid kernel results are additionally keyed by kernel function.
+class ResultIndex
+{
+public:
+    explicit ResultIndex(const std::vector<KernelResult>& results);
+
+    const KernelResult& Find(const KernelConfiguration& configuration) const;
+    const KernelResult* TryFind(const KernelConfiguration& configuration) const;
+    const ComputationResult* TryFind(const std::string& kernelFunction, const KernelConfiguration& configuration) const;
+    size_t GetSize() const;
+    size_t GetComputationCount() const;
+
+private:
+    using Key = std::vector<uint32_t>;
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    const std::vector<KernelResult>& m_Results;
+    std::unordered_map<std::string, size_t> m_ParameterIndices;
+    std::vector<std::vector<ParameterPair>> m_ParameterValues;
+    std::unordered_map<Key, size_t, KeyHash> m_Entries;
+    std::unordered_map<std::string, uint32_t> m_KernelFunctions;
+    std::unordered_map<Key, std::pair<size_t, size_t>, KeyHash> m_Computations;
+
+    void AddParameterValues(const KernelConfiguration& configuration);
+    void AddComputations(const KernelResult& result, const size_t resultIndex, const Key& key);
+    bool GetKey(const KernelConfiguration& configuration, Key& key, std::vector<std::string>& unknownValues) const;
+
+    inline static const uint32_t m_MissingValue = UINT32_MAX;
+};
+
+} // namespace ktt
@@ -1,7 +1,14 @@
 #include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <set>
 
 #include <Api/KttException.h>
+#include <Output/JsonConverters.h>
 #include <Output/TimeConfiguration/TimeConfiguration.h>
+#include <TuningRunner/ResultIndex.h>
 #include <TuningRunner/TuningRunner.h>
 #include <Utility/Logger/Logger.h>
 #include <Utility/Timer/ScopeTimer.h>
@@ -9,17 +16,42 @@
 namespace ktt
 {
 
-TuningRunner::TuningRunner(KernelRunner& kernelRunner) :
+TuningRunner::TuningRunner(KernelRunner& kernelRunner, const VirtualClock* virtualClock) :
     m_KernelRunner(kernelRunner),
-    m_ConfigurationManager(std::make_unique<ConfigurationManager>())
+    m_VirtualClock(virtualClock),
+    m_ConfigurationManager(std::make_unique<ConfigurationManager>()),
+    m_CompilationLookahead(0),
+    m_Sandboxed(false),
+    m_SandboxTimeoutFactor(10.0),
+    m_SandboxMinimumTimeout(10),
+    m_OutlierDetectionInterval(0)
 {}
 
 std::vector<KernelResult> TuningRunner::Tune(const Kernel& kernel, const KernelDimensions& dimensions,
     std::unique_ptr<StopCondition> stopCondition)
 {
+    // Timers and stop conditions on this thread measure replayed time of this tuner, if it has a virtual clock
+    const VirtualClockScope clockScope(m_VirtualClock);
+
+    if (IsSandboxWorker())
+    {
+        if (std::getenv(m_SandboxKernelVariable.c_str()) == std::to_string(kernel.GetId()))
+        {
+            throw KttException("Kernel " + kernel.GetName() + " cannot be tuned inside sandbox worker process, the application must "
+                "call RunSandboxWorker() for the kernel first");
+        }
+
+        // Worker process may run through setup of other kernels before it reaches the sandboxed one, their tuning is skipped
+        Logger::LogInfo("Skipping tuning of kernel " + kernel.GetName() + " inside sandbox worker process");
+        return std::vector<KernelResult>{};
+    }
+
     Logger::LogInfo("Starting offline tuning for kernel " + kernel.GetName());
     const auto id = kernel.GetId();
 
+    // Incumbent measured in previous tuning may come from different arguments or dimensions
+    m_RacingIncumbents.erase(id);
+
     if (!m_ConfigurationManager->HasData(id))
     {
         m_ConfigurationManager->InitializeData(kernel);
@@ -31,8 +63,42 @@ std::vector<KernelResult> TuningRunner::Tune(const Kernel& kernel, const KernelD
         stopCondition->Initialize(configurationsCount);
     }
 
+    if (!m_Sandboxed && (m_CompilationLookahead > 0 || !m_ParallelRunners.empty()))
+    {
+        CheckUpcomingConfigurations(kernel);
+    }
+
+    if (m_Sandboxed)
+    {
+        if (!m_ParallelRunners.empty())
+        {
+            throw KttException("Sandboxed execution is not supported in multi-device tuning");
+        }
+
+        const auto results = TuneSandboxed(kernel, stopCondition.get());
+        Logger::LogInfo("Ending offline tuning for kernel " + kernel.GetName() + ", total number of tested configurations is "
+            + std::to_string(results.size()));
+        return results;
+    }
+
+    if (!m_ParallelRunners.empty())
+    {
+        const auto results = TuneParallel(kernel, dimensions, stopCondition.get());
+        Logger::LogInfo("Ending offline tuning for kernel " + kernel.GetName() + ", total number of tested configurations is "
+            + std::to_string(results.size()));
+
+        for (auto* runner : m_ParallelRunners)
+        {
+            runner->ClearReferenceResult(kernel);
+        }
+
+        return results;
+    }
+
     std::vector<KernelResult> results;
 //    KernelResult result(kernel.GetName(), m_ConfigurationManager->GetCurrentConfiguration(id));
+    OutlierDetector detector;
+    size_t periodBegin = 0;
 
     while (!m_ConfigurationManager->IsDataProcessed(id))
     {
@@ -53,6 +119,11 @@ std::vector<KernelResult> TuningRunner::Tune(const Kernel& kernel, const KernelD
             result.TransferPowerData(multiResult);
         }
 
+        if (m_OutlierDetectionInterval > 0 && m_ConfigurationManager->IsBestCandidate(id, result))
+        {
+            result = ConfirmBestResult(kernel, dimensions, result);
+        }
+
         const Nanoseconds searcherOverhead = RunScopeTimer([this, id, &result]()
         {
             m_ConfigurationManager->CalculateNextConfiguration(id, result);
@@ -61,6 +132,11 @@ std::vector<KernelResult> TuningRunner::Tune(const Kernel& kernel, const KernelD
         result.SetSearcherOverhead(searcherOverhead);
         results.push_back(result);
 
+        if (m_OutlierDetectionInterval > 0)
+        {
+            CheckMeasurementDrift(kernel, dimensions, detector, results, periodBegin);
+        }
+
         if (stopCondition == nullptr)
         {
             continue;
@@ -81,9 +157,262 @@ std::vector<KernelResult> TuningRunner::Tune(const Kernel& kernel, const KernelD
     return results;
 }
 
+std::vector<KernelResult> TuningRunner::TuneDistributed(const Kernel& kernel, const uint16_t port, const std::chrono::seconds leaseTimeout,
+    std::unique_ptr<StopCondition> stopCondition)
+{
+    Logger::LogInfo("Starting distributed tuning for kernel " + kernel.GetName());
+    const auto id = kernel.GetId();
+    m_RacingIncumbents.erase(id);
+
+    if (!m_ConfigurationManager->HasData(id))
+    {
+        m_ConfigurationManager->InitializeData(kernel);
+    }
+
+    if (stopCondition != nullptr)
+    {
+        const uint64_t configurationsCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+        stopCondition->Initialize(configurationsCount);
+    }
+
+    auto listener = TcpSocket::Listen(port);
+    Logger::LogInfo("Waiting for tuning workers on port " + std::to_string(listener->GetPort()));
+
+    std::vector<KernelResult> results;
+    std::map<DeviceIndex, DistributedWorker> workers;
+    std::map<uint64_t, ConfigurationLease> leases;
+    std::map<uint64_t, KernelResult> finishedResults;
+    std::set<uint64_t> completedIndices;
+    DeviceIndex nextWorkerId = 0;
+    bool stopped = false;
+
+    while (true)
+    {
+        ProcessFinishedResults(id, finishedResults, results, stopCondition.get(), stopped);
+
+        if (stopped || m_ConfigurationManager->IsDataProcessed(id))
+        {
+            break;
+        }
+
+        // Configurations of workers which failed to deliver result in time are handed out again, result which arrives later
+        // from the original worker is still accepted if the configuration was not completed in the meantime
+        const auto now = std::chrono::steady_clock::now();
+
+        for (auto lease = leases.begin(); lease != leases.end();)
+        {
+            if (lease->second.m_Deadline > now)
+            {
+                ++lease;
+                continue;
+            }
+
+            Logger::LogWarning("Lease of configuration " + std::to_string(lease->first) + " held by tuning worker "
+                + std::to_string(lease->second.m_Worker) + " has expired, the configuration will be reassigned");
+            lease = leases.erase(lease);
+        }
+
+        const size_t lookahead = workers.size() + leases.size() + finishedResults.size();
+        std::vector<uint64_t> candidates;
+
+        for (const uint64_t index : GetCandidateIndices(id, lookahead))
+        {
+            if (leases.find(index) == leases.cend() && completedIndices.find(index) == completedIndices.cend())
+            {
+                candidates.push_back(index);
+            }
+        }
+
+        auto candidate = candidates.cbegin();
+        std::vector<DeviceIndex> failedWorkers;
+
+        for (auto& [workerId, worker] : workers)
+        {
+            if (candidate == candidates.cend())
+            {
+                break;
+            }
+
+            if (!worker.m_Ready || !worker.m_Idle)
+            {
+                continue;
+            }
+
+            try
+            {
+                worker.m_Socket->Send(json{{"Type", "Lease"}, {"Index", *candidate}}.dump());
+            }
+            catch (const KttException&)
+            {
+                failedWorkers.push_back(workerId);
+                continue;
+            }
+
+            Logger::LogDebug("Leasing configuration " + std::to_string(*candidate) + " to tuning worker " + std::to_string(workerId));
+            leases[*candidate] = ConfigurationLease{workerId, now + leaseTimeout};
+            worker.m_Idle = false;
+            ++candidate;
+        }
+
+        for (const auto workerId : failedWorkers)
+        {
+            Logger::LogWarning("Unable to reach tuning worker " + std::to_string(workerId) + ", the worker will be dropped");
+            DropWorker(workerId, workers, leases);
+        }
+
+        std::vector<TcpSocket*> sockets{listener.get()};
+
+        for (const auto& worker : workers)
+        {
+            sockets.push_back(worker.second.m_Socket.get());
+        }
+
+        for (auto* socket : TcpSocket::WaitForData(sockets, m_WorkerPollInterval))
+        {
+            if (socket == listener.get())
+            {
+                const DeviceIndex workerId = nextWorkerId++;
+                workers[workerId] = DistributedWorker{listener->Accept(), false, false};
+                Logger::LogInfo("Tuning worker " + std::to_string(workerId) + " has connected");
+                continue;
+            }
+
+            const auto worker = std::find_if(workers.begin(), workers.end(), [socket](const auto& pair)
+            {
+                return pair.second.m_Socket.get() == socket;
+            });
+
+            const DeviceIndex workerId = worker->first;
+
+            if (!socket->HasMessage() && !socket->ReadAvailable())
+            {
+                Logger::LogWarning("Tuning worker " + std::to_string(workerId) + " has disconnected");
+                DropWorker(workerId, workers, leases);
+                continue;
+            }
+
+            std::string message;
+
+            try
+            {
+                while (workers.find(workerId) != workers.cend() && socket->PopMessage(message))
+                {
+                    ProcessWorkerMessage(kernel, workerId, message, workers, leases, finishedResults, completedIndices);
+                }
+            }
+            catch (const json::exception& exception)
+            {
+                Logger::LogWarning("Invalid message from tuning worker " + std::to_string(workerId) + ": " + exception.what());
+                DropWorker(workerId, workers, leases);
+            }
+        }
+    }
+
+    for (const auto& worker : workers)
+    {
+        try
+        {
+            worker.second.m_Socket->Send(json{{"Type", "Finish"}}.dump());
+        }
+        catch (const KttException&)
+        {
+            // Workers which are no longer reachable do not need to be notified
+        }
+    }
+
+    Logger::LogInfo("Ending distributed tuning for kernel " + kernel.GetName() + ", total number of tested configurations is "
+        + std::to_string(results.size()));
+    return results;
+}
+
+uint64_t TuningRunner::RunWorker(const Kernel& kernel, const KernelDimensions& dimensions, const std::string& host, const uint16_t port)
+{
+    const auto id = kernel.GetId();
+
+    if (!m_ConfigurationManager->HasData(id))
+    {
+        m_ConfigurationManager->InitializeData(kernel);
+    }
+
+    const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+    auto socket = TcpSocket::Connect(host, port);
+    Logger::LogInfo("Connected to tuning coordinator at " + host + ":" + std::to_string(port) + " for kernel " + kernel.GetName());
+
+    socket->Send(json{{"Type", "Hello"}, {"KernelName", kernel.GetName()}, {"ConfigurationCount", configurationCount}}.dump());
+    uint64_t testedCount = 0;
+    std::string message;
+
+    while (socket->Receive(message))
+    {
+        std::string type;
+        uint64_t index = 0;
+
+        try
+        {
+            const json request = json::parse(message);
+            request.at("Type").get_to(type);
+
+            if (type == "Lease")
+            {
+                request.at("Index").get_to(index);
+            }
+        }
+        catch (const json::exception& exception)
+        {
+            throw KttException(std::string("Invalid message from tuning coordinator: ") + exception.what());
+        }
+
+        if (type == "Finish")
+        {
+            break;
+        }
+
+        if (type != "Lease" || index >= configurationCount)
+        {
+            throw KttException("Invalid request from tuning coordinator: " + message);
+        }
+
+        Logger::LogInfo("Running configuration " + std::to_string(index) + " / " + std::to_string(configurationCount)
+            + " for kernel " + kernel.GetName());
+        const auto configuration = m_ConfigurationManager->GetConfigurationForIndex(id, index);
+        const KernelResult result = RunConfiguration(m_KernelRunner, kernel, configuration, dimensions);
+        ++testedCount;
+
+        try
+        {
+            socket->Send(json{{"Type", "Result"}, {"Index", index}, {"Result", result}}.dump());
+        }
+        catch (const KttException&)
+        {
+            // Coordinator closes the connection once the tuning is finished, even if some configurations are still running
+            Logger::LogWarning("Connection to tuning coordinator was closed before the result could be delivered");
+            break;
+        }
+    }
+
+    Logger::LogInfo("Tuning worker for kernel " + kernel.GetName() + " has finished, total number of tested configurations is "
+        + std::to_string(testedCount));
+    m_KernelRunner.ClearReferenceResult(kernel);
+    return testedCount;
+}
+
+bool TuningRunner::RunSandboxWorker(const Kernel& kernel, const KernelDimensions& dimensions)
+{
+    if (!IsSandboxWorker() || std::getenv(m_SandboxKernelVariable.c_str()) != std::to_string(kernel.GetId()))
+    {
+        return false;
+    }
+
+    const auto port = static_cast<uint16_t>(std::stoul(std::getenv(m_SandboxPortVariable.c_str())));
+    RunWorker(kernel, dimensions, "127.0.0.1", port);
+    return true;
+}
+
 KernelResult TuningRunner::TuneIteration(const Kernel& kernel, const KernelDimensions& dimensions, const KernelRunMode mode,
     const std::vector<BufferOutputDescriptor>& output, const bool recomputeReference)
 {
+    const VirtualClockScope clockScope(m_VirtualClock);
+
     if (recomputeReference)
     {
         m_KernelRunner.ClearReferenceResult(kernel);
@@ -111,9 +440,22 @@ KernelResult TuningRunner::TuneIteration(const Kernel& kernel, const KernelDimen
         const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
         Logger::LogInfo("Launching configuration " + std::to_string(configurationNumber) + " / " + std::to_string(configurationCount)
             + " for kernel " + kernel.GetName());
+
+        if (m_CompilationLookahead > 0)
+        {
+            // Upcoming configurations are compiled in background while the current one is measured
+            const auto upcoming = m_ConfigurationManager->GetUpcomingConfigurations(id, static_cast<size_t>(m_CompilationLookahead));
+            m_KernelRunner.CompileKernelsAsync(kernel, upcoming, dimensions);
+        }
     }
 
+    const auto incumbent = m_RacingIncumbents.find(id);
+    m_KernelRunner.SetRacingIncumbent(incumbent != m_RacingIncumbents.cend()
+        ? std::optional<MeasurementStatistics>(incumbent->second) : std::nullopt);
+
     KernelResult result = m_KernelRunner.RunKernel(kernel, configuration, dimensions, mode, output);
+    m_KernelRunner.SetRacingIncumbent(std::nullopt);
+    UpdateRacingIncumbent(id, result);
 
     if (mode != KernelRunMode::OfflineTuning && !result.HasRemainingProfilingRuns() && !m_ConfigurationManager->IsDataProcessed(id))
     {
@@ -142,6 +484,7 @@ std::vector<KernelResult> TuningRunner::SimulateTuning(const Kernel& kernel, con
     uint64_t passedIterations = 0;
     std::vector<KernelResult> output;
     const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+    const ResultIndex index(results);
 
     if (stopCondition != nullptr)
     {
@@ -162,7 +505,7 @@ std::vector<KernelResult> TuningRunner::SimulateTuning(const Kernel& kernel, con
         {
             Logger::LogInfo("Simulating run for configuration " + std::to_string(passedIterations + 1) + " / "
                 + std::to_string(configurationCount) + " for kernel " + kernel.GetName() + ": " + currentConfiguration.GetString());
-            result = FindMatchingResult(results, currentConfiguration);
+            result = index.Find(currentConfiguration);
 
             const auto& time = TimeConfiguration::GetInstance();
             const uint64_t duration = time.ConvertFromNanoseconds(result.GetTotalDuration());
@@ -200,11 +543,86 @@ std::vector<KernelResult> TuningRunner::SimulateTuning(const Kernel& kernel, con
     return output;
 }
 
+void TuningRunner::Precompile(const Kernel& kernel, const uint64_t startIndex, const uint64_t endIndex)
+{
+    const auto id = kernel.GetId();
+
+    if (!m_ConfigurationManager->HasData(id))
+    {
+        m_ConfigurationManager->InitializeData(kernel);
+    }
+
+    const uint64_t lastIndex = std::min(endIndex, m_ConfigurationManager->GetTotalConfigurationsCount(id));
+
+    if (startIndex >= lastIndex)
+    {
+        throw KttException("Invalid configuration index range for precompilation of kernel " + kernel.GetName());
+    }
+
+    Logger::LogInfo("Starting precompilation of " + std::to_string(lastIndex - startIndex) + " configurations for kernel "
+        + kernel.GetName());
+
+    // Configurations are generated in batches, so that large configuration spaces do not need to be kept in memory
+    for (uint64_t batchStart = startIndex; batchStart < lastIndex; batchStart += m_PrecompilationBatchSize)
+    {
+        const uint64_t batchEnd = std::min(batchStart + m_PrecompilationBatchSize, lastIndex);
+        std::vector<KernelConfiguration> configurations;
+
+        for (uint64_t index = batchStart; index < batchEnd; ++index)
+        {
+            configurations.push_back(m_ConfigurationManager->GetConfigurationForIndex(id, index));
+        }
+
+        m_KernelRunner.PrecompileKernels(kernel, configurations);
+    }
+}
+
 void TuningRunner::SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
 {
     m_ConfigurationManager->SetSearcher(id, std::move(searcher));
 }
 
+void TuningRunner::SetCompilationLookahead(const uint64_t count)
+{
+    m_CompilationLookahead = count;
+}
+
+void TuningRunner::SetParallelRunners(const std::vector<KernelRunner*>& runners)
+{
+    m_ParallelRunners = runners;
+    m_DevicePool.reset();
+
+    if (!m_ParallelRunners.empty())
+    {
+        m_DevicePool = std::make_unique<ctpl::thread_pool>(static_cast<int>(m_ParallelRunners.size()));
+    }
+}
+
+void TuningRunner::SetSandboxedExecution(const bool flag, const double timeoutFactor, const std::chrono::seconds minimumTimeout,
+    const std::vector<std::string>& workerArguments)
+{
+    if (timeoutFactor <= 0.0)
+    {
+        throw KttException("Sandbox timeout factor must be greater than zero");
+    }
+
+    m_Sandboxed = flag;
+    m_SandboxTimeoutFactor = timeoutFactor;
+    m_SandboxMinimumTimeout = minimumTimeout;
+    m_SandboxWorkerArguments = workerArguments;
+}
+
+void TuningRunner::SetOutlierDetection(const uint64_t sentinelInterval)
+{
+    m_OutlierDetectionInterval = sentinelInterval;
+}
+
+void TuningRunner::SetObjectives(const KernelId id, const std::vector<TuningObjective>& objectives,
+    ObjectiveScalarization scalarization)
+{
+    m_ConfigurationManager->SetObjectives(id, objectives, scalarization);
+}
+
 void TuningRunner::InitializeConfigurationData(const Kernel& kernel)
 {
     m_ConfigurationManager->InitializeData(kernel);
@@ -213,6 +631,12 @@ void TuningRunner::InitializeConfigurationData(const Kernel& kernel)
 void TuningRunner::ClearConfigurationData(const KernelId id, const bool clearSearcher)
 {
     m_ConfigurationManager->ClearData(id, clearSearcher);
+    m_RacingIncumbents.erase(id);
+}
+
+void TuningRunner::ClearRacingIncumbents()
+{
+    m_RacingIncumbents.clear();
 }
 
 uint64_t TuningRunner::GetConfigurationsCount(const KernelId id) const
@@ -225,18 +649,701 @@ KernelConfiguration TuningRunner::GetBestConfiguration(const KernelId id) const
     return m_ConfigurationManager->GetBestConfiguration(id);
 }
 
-const KernelResult& TuningRunner::FindMatchingResult(const std::vector<KernelResult>& results,
-    const KernelConfiguration& configuration)
+std::vector<KernelResult> TuningRunner::GetParetoFront(const KernelId id) const
+{
+    return m_ConfigurationManager->GetParetoFront(id);
+}
+
+std::vector<KernelResult> TuningRunner::TuneParallel(const Kernel& kernel, const KernelDimensions& dimensions,
+    StopCondition* stopCondition)
+{
+    CheckParallelArguments(kernel);
+
+    const auto id = kernel.GetId();
+    m_RacingIncumbents.erase(id);
+    const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+    std::vector<KernelResult> results;
+    std::vector<bool> idleDevices(m_ParallelRunners.size(), true);
+    std::set<uint64_t> runningConfigurations;
+    std::map<uint64_t, KernelResult> finishedResults;
+    std::exception_ptr failure;
+    bool stopped = false;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<CompletedRun> completedRuns;
+
+    while (true)
+    {
+        ProcessFinishedResults(id, finishedResults, results, stopCondition, stopped);
+
+        if (!stopped && !m_ConfigurationManager->IsDataProcessed(id))
+        {
+            const size_t lookahead = m_ParallelRunners.size() + runningConfigurations.size() + finishedResults.size();
+            const auto incumbent = m_RacingIncumbents.find(id);
+            const std::optional<MeasurementStatistics> racingIncumbent = incumbent != m_RacingIncumbents.cend()
+                ? std::optional<MeasurementStatistics>(incumbent->second) : std::nullopt;
+            size_t device = 0;
+
+            for (const uint64_t index : GetCandidateIndices(id, lookahead))
+            {
+                while (device < idleDevices.size() && !idleDevices[device])
+                {
+                    ++device;
+                }
+
+                if (device >= idleDevices.size())
+                {
+                    break;
+                }
+
+                if (runningConfigurations.find(index) != runningConfigurations.cend()
+                    || finishedResults.find(index) != finishedResults.cend())
+                {
+                    continue;
+                }
+
+                const auto configuration = m_ConfigurationManager->GetConfigurationForIndex(id, index);
+
+                Logger::LogInfo("Launching configuration " + std::to_string(index) + " / " + std::to_string(configurationCount)
+                    + " for kernel " + kernel.GetName() + " on tuning device " + std::to_string(device));
+
+                idleDevices[device] = false;
+                runningConfigurations.insert(index);
+
+                m_DevicePool->push([this, &kernel, &dimensions, &mutex, &condition, &completedRuns, device, index, configuration,
+                    racingIncumbent]()
+                {
+                    CompletedRun run{device, index, KernelResult(), nullptr};
+                    KernelRunner& runner = *m_ParallelRunners[device];
+
+                    try
+                    {
+                        runner.SetRacingIncumbent(racingIncumbent);
+                        run.m_Result = RunConfiguration(runner, kernel, configuration, dimensions);
+                        run.m_Result.SetTuningDevice(static_cast<DeviceIndex>(device));
+                    }
+                    catch (...)
+                    {
+                        run.m_Failure = std::current_exception();
+                    }
+
+                    runner.SetRacingIncumbent(std::nullopt);
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        completedRuns.push_back(std::move(run));
+                    }
+
+                    condition.notify_one();
+                });
+            }
+        }
+
+        if (runningConfigurations.empty())
+        {
+            break;
+        }
+
+        std::deque<CompletedRun> runs;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&completedRuns]()
+            {
+                return !completedRuns.empty();
+            });
+
+            runs.swap(completedRuns);
+        }
+
+        for (auto& run : runs)
+        {
+            idleDevices[run.m_Device] = true;
+            runningConfigurations.erase(run.m_Index);
+
+            if (run.m_Failure != nullptr)
+            {
+                // Remaining devices finish their current runs before the failure is reported
+                failure = failure != nullptr ? failure : run.m_Failure;
+                stopped = true;
+                continue;
+            }
+
+            finishedResults[run.m_Index] = std::move(run.m_Result);
+        }
+    }
+
+    if (failure != nullptr)
+    {
+        std::rethrow_exception(failure);
+    }
+
+    return results;
+}
+
+std::vector<KernelResult> TuningRunner::TuneSandboxed(const Kernel& kernel, StopCondition* stopCondition)
+{
+    const auto id = kernel.GetId();
+    const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+    auto listener = TcpSocket::Listen(0, true);
+
+    const std::map<std::string, std::string> environment
+    {
+        {m_SandboxPortVariable, std::to_string(listener->GetPort())},
+        {m_SandboxKernelVariable, std::to_string(id)}
+    };
+
+    std::unique_ptr<ChildProcess> process;
+    std::unique_ptr<TcpSocket> socket;
+    std::optional<Nanoseconds> bestTime;
+    std::vector<KernelResult> results;
+
+    while (!m_ConfigurationManager->IsDataProcessed(id))
+    {
+        if (socket == nullptr)
+        {
+            Logger::LogInfo("Launching sandbox worker process for kernel " + kernel.GetName());
+            process.reset();
+            process = std::make_unique<ChildProcess>(m_SandboxWorkerArguments, environment);
+            socket = AcceptSandboxWorker(kernel, *listener, *process);
+        }
+
+        const auto configuration = m_ConfigurationManager->GetCurrentConfiguration(id);
+        const uint64_t index = m_ConfigurationManager->GetIndexForConfiguration(id, configuration);
+        const auto timeout = GetSandboxTimeout(bestTime);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        Logger::LogInfo("Launching configuration " + std::to_string(index) + " / " + std::to_string(configurationCount)
+            + " for kernel " + kernel.GetName() + " in sandbox worker process");
+
+        try
+        {
+            socket->Send(json{{"Type", "Lease"}, {"Index", index}}.dump());
+        }
+        catch (const KttException&)
+        {
+            // Worker which has crashed is detected while waiting for the result
+        }
+
+        KernelResult result;
+
+        if (WaitForSandboxResult(*socket, index, deadline, result))
+        {
+            if (result.IsValid())
+            {
+                const Nanoseconds time = result.GetTotalDuration() + result.GetTotalOverhead();
+                bestTime = bestTime.has_value() ? std::min(*bestTime, time) : time;
+            }
+        }
+        else
+        {
+            const bool timedOut = std::chrono::steady_clock::now() >= deadline;
+            socket.reset();
+            process.reset();
+
+            if (timedOut)
+            {
+                const auto& time = TimeConfiguration::GetInstance();
+                Logger::LogWarning("Configuration " + std::to_string(index) + " did not finish within "
+                    + std::to_string(time.ConvertFromNanoseconds(static_cast<Nanoseconds>(timeout.count()))) + time.GetUnitTag()
+                    + ", sandbox worker process was terminated");
+            }
+            else
+            {
+                Logger::LogWarning("Sandbox worker process terminated unexpectedly while running configuration " + std::to_string(index));
+            }
+
+            result = KernelResult(kernel.GetName(), configuration);
+            result.SetStatus(timedOut ? ResultStatus::Timeout : ResultStatus::ComputationFailed);
+        }
+
+        const Nanoseconds searcherOverhead = RunScopeTimer([this, id, &result]()
+        {
+            m_ConfigurationManager->CalculateNextConfiguration(id, result);
+        });
+
+        result.SetSearcherOverhead(searcherOverhead);
+        results.push_back(result);
+
+        if (stopCondition == nullptr)
+        {
+            continue;
+        }
+
+        stopCondition->Update(result);
+        Logger::LogInfo(stopCondition->GetStatusString());
+
+        if (stopCondition->IsFulfilled())
+        {
+            break;
+        }
+    }
+
+    if (socket != nullptr)
+    {
+        try
+        {
+            socket->Send(json{{"Type", "Finish"}}.dump());
+        }
+        catch (const KttException&)
+        {
+            // Worker process is terminated in any case
+        }
+    }
+
+    return results;
+}
+
+std::unique_ptr<TcpSocket> TuningRunner::AcceptSandboxWorker(const Kernel& kernel, TcpSocket& listener, ChildProcess& process) const
+{
+    const std::vector<TcpSocket*> sockets{&listener};
+
+    // Worker process sets up its kernels before it connects, which is not covered by the configuration timeout
+    const auto deadline = std::chrono::steady_clock::now() + m_SandboxStartupTimeout;
+
+    while (TcpSocket::WaitForData(sockets, m_WorkerPollInterval).empty())
+    {
+        if (!process.IsRunning())
+        {
+            throw KttException("Sandbox worker process exited before connecting to the tuner, the application must call "
+                "RunSandboxWorker() for kernel " + kernel.GetName());
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            process.Terminate();
+            throw KttException("Sandbox worker process did not connect to the tuner within "
+                + std::to_string(m_SandboxStartupTimeout.count()) + " seconds");
+        }
+    }
+
+    auto socket = listener.Accept();
+    std::string message;
+
+    if (!socket->Receive(message))
+    {
+        throw KttException("Sandbox worker process closed connection before identifying its kernel");
+    }
+
+    std::string kernelName;
+    uint64_t configurationCount = 0;
+
+    try
+    {
+        const json content = json::parse(message);
+        content.at("KernelName").get_to(kernelName);
+        content.at("ConfigurationCount").get_to(configurationCount);
+    }
+    catch (const json::exception& exception)
+    {
+        throw KttException(std::string("Invalid message from sandbox worker process: ") + exception.what());
+    }
+
+    if (kernelName != kernel.GetName() || configurationCount != m_ConfigurationManager->GetTotalConfigurationsCount(kernel.GetId()))
+    {
+        throw KttException("Sandbox worker process uses different setup of kernel " + kernel.GetName()
+            + ", the application must set up the kernel identically in each run");
+    }
+
+    return socket;
+}
+
+std::chrono::nanoseconds TuningRunner::GetSandboxTimeout(const std::optional<Nanoseconds> bestTime) const
+{
+    const std::chrono::nanoseconds minimumTimeout = m_SandboxMinimumTimeout;
+
+    if (!bestTime.has_value())
+    {
+        return minimumTimeout;
+    }
+
+    const auto timeout = std::chrono::nanoseconds(static_cast<int64_t>(m_SandboxTimeoutFactor * static_cast<double>(*bestTime)));
+    return std::max(minimumTimeout, timeout);
+}
+
+void TuningRunner::ProcessFinishedResults(const KernelId id, std::map<uint64_t, KernelResult>& finishedResults,
+    std::vector<KernelResult>& results, StopCondition* stopCondition, bool& stopped)
+{
+    // Results are passed to searcher in the order in which it requests them, so that the search proceeds in the same way
+    // as with a single device, other devices only measure configurations which the searcher is expected to request next
+    while (!stopped && !m_ConfigurationManager->IsDataProcessed(id))
+    {
+        const uint64_t index = m_ConfigurationManager->GetIndexForConfiguration(id, m_ConfigurationManager->GetCurrentConfiguration(id));
+        const auto finished = finishedResults.find(index);
+
+        if (finished == finishedResults.cend())
+        {
+            break;
+        }
+
+        KernelResult result = std::move(finished->second);
+        finishedResults.erase(finished);
+        UpdateRacingIncumbent(id, result);
+
+        const Nanoseconds searcherOverhead = RunScopeTimer([this, id, &result]()
+        {
+            m_ConfigurationManager->CalculateNextConfiguration(id, result);
+        });
+
+        result.SetSearcherOverhead(searcherOverhead);
+        results.push_back(result);
+
+        if (stopCondition != nullptr)
+        {
+            stopCondition->Update(result);
+            Logger::LogInfo(stopCondition->GetStatusString());
+            stopped = stopCondition->IsFulfilled();
+        }
+    }
+}
+
+std::vector<uint64_t> TuningRunner::GetCandidateIndices(const KernelId id, const size_t lookahead) const
+{
+    std::vector<KernelConfiguration> candidates{m_ConfigurationManager->GetCurrentConfiguration(id)};
+    const auto upcoming = m_ConfigurationManager->GetUpcomingConfigurations(id, lookahead);
+    candidates.insert(candidates.end(), upcoming.cbegin(), upcoming.cend());
+    std::vector<uint64_t> indices;
+
+    for (const auto& configuration : candidates)
+    {
+        indices.push_back(m_ConfigurationManager->GetIndexForConfiguration(id, configuration));
+    }
+
+    return indices;
+}
+
+void TuningRunner::CheckUpcomingConfigurations(const Kernel& kernel) const
+{
+    const auto id = kernel.GetId();
+
+    if (m_ConfigurationManager->IsDataProcessed(id)
+        || m_ConfigurationManager->GetExploredConfigurationsCount(id) + 1 >= m_ConfigurationManager->GetTotalConfigurationsCount(id))
+    {
+        return;
+    }
+
+    if (!m_ConfigurationManager->GetUpcomingConfigurations(id, 1).empty())
+    {
+        return;
+    }
+
+    const std::string consequence = m_ParallelRunners.empty() ? "kernels are compiled on launch"
+        : "configurations are evaluated on a single tuning device at a time";
+    Logger::LogWarning("Searcher for kernel " + kernel.GetName() + " does not report upcoming configurations, " + consequence);
+}
+
+void TuningRunner::ProcessWorkerMessage(const Kernel& kernel, const DeviceIndex workerId, const std::string& message,
+    std::map<DeviceIndex, DistributedWorker>& workers, std::map<uint64_t, ConfigurationLease>& leases,
+    std::map<uint64_t, KernelResult>& finishedResults, std::set<uint64_t>& completedIndices)
+{
+    const auto id = kernel.GetId();
+    const uint64_t configurationCount = m_ConfigurationManager->GetTotalConfigurationsCount(id);
+    auto& worker = workers.at(workerId);
+    const json content = json::parse(message);
+    const auto type = content.at("Type").get<std::string>();
+
+    if (type == "Hello")
+    {
+        const auto kernelName = content.at("KernelName").get<std::string>();
+        const auto workerCount = content.at("ConfigurationCount").get<uint64_t>();
+
+        // Worker with different kernel setup would measure different configurations under the same indices
+        if (kernelName != kernel.GetName() || workerCount != configurationCount)
+        {
+            Logger::LogWarning("Tuning worker " + std::to_string(workerId) + " uses kernel " + kernelName + " with "
+                + std::to_string(workerCount) + " configurations, which does not match the tuned kernel, the worker will be dropped");
+
+            try
+            {
+                worker.m_Socket->Send(json{{"Type", "Finish"}}.dump());
+            }
+            catch (const KttException&)
+            {
+                // Worker is dropped regardless of whether it receives the notification
+            }
+
+            DropWorker(workerId, workers, leases);
+            return;
+        }
+
+        worker.m_Ready = true;
+        worker.m_Idle = true;
+        return;
+    }
+
+    if (type != "Result")
+    {
+        Logger::LogWarning("Tuning worker " + std::to_string(workerId) + " has sent message of unknown type " + type
+            + ", the worker will be dropped");
+        DropWorker(workerId, workers, leases);
+        return;
+    }
+
+    const auto index = content.at("Index").get<uint64_t>();
+    auto result = content.at("Result").get<KernelResult>();
+
+    if (index >= configurationCount || result.GetConfiguration() != m_ConfigurationManager->GetConfigurationForIndex(id, index))
+    {
+        Logger::LogWarning("Tuning worker " + std::to_string(workerId) + " has sent result with mismatched configuration "
+            + std::to_string(index) + ", the worker will be dropped");
+        DropWorker(workerId, workers, leases);
+        return;
+    }
+
+    worker.m_Idle = true;
+    const auto lease = leases.find(index);
+
+    // Lease of expired configuration may already belong to another worker, which is still measuring it
+    if (lease != leases.cend() && lease->second.m_Worker == workerId)
+    {
+        leases.erase(lease);
+    }
+
+    // Configuration which was reassigned after lease expiration may be completed by several workers, only the first result is used
+    if (completedIndices.insert(index).second)
+    {
+        result.SetTuningDevice(workerId);
+        finishedResults.emplace(index, std::move(result));
+        Logger::LogInfo("Received result of configuration " + std::to_string(index) + " / " + std::to_string(configurationCount)
+            + " for kernel " + kernel.GetName() + " from tuning worker " + std::to_string(workerId));
+    }
+}
+
+KernelResult TuningRunner::ConfirmBestResult(const Kernel& kernel, const KernelDimensions& dimensions, const KernelResult& result)
+{
+    const auto remeasured = RunConfiguration(m_KernelRunner, kernel, result.GetConfiguration(), dimensions);
+    const auto& time = TimeConfiguration::GetInstance();
+
+    if (!remeasured.IsValid())
+    {
+        Logger::LogWarning("Re-measurement of new best configuration for kernel " + kernel.GetName()
+            + " failed, the original measurement is kept");
+        return result;
+    }
+
+    const Nanoseconds duration = result.GetTotalDuration();
+    const Nanoseconds remeasuredDuration = remeasured.GetTotalDuration();
+
+    if (OutlierDetector::AreConsistent(duration, remeasuredDuration))
+    {
+        Logger::LogDebug("New best configuration for kernel " + kernel.GetName() + " was confirmed by re-measurement");
+        return result;
+    }
+
+    // Suspiciously fast measurement must not become the best configuration, the slower of both measurements is kept
+    Logger::LogWarning("New best configuration for kernel " + kernel.GetName() + " measured in "
+        + std::to_string(time.ConvertFromNanoseconds(duration)) + time.GetUnitTag() + " was not confirmed by re-measurement with "
+        + std::to_string(time.ConvertFromNanoseconds(remeasuredDuration)) + time.GetUnitTag());
+    return remeasuredDuration > duration ? remeasured : result;
+}
+
+void TuningRunner::CheckMeasurementDrift(const Kernel& kernel, const KernelDimensions& dimensions, OutlierDetector& detector,
+    std::vector<KernelResult>& results, size_t& periodBegin)
+{
+    const auto id = kernel.GetId();
+
+    if (!detector.HasSentinel())
+    {
+        // The first valid configuration serves as a sentinel whose duration reflects the current device performance
+        if (results.back().IsValid())
+        {
+            detector.SetSentinel(results.back().GetConfiguration(), results.back().GetTotalDuration());
+            periodBegin = results.size();
+        }
+
+        return;
+    }
+
+    if (results.size() - periodBegin < m_OutlierDetectionInterval)
+    {
+        return;
+    }
+
+    const auto measureSentinel = [this, &kernel, &dimensions, &detector]() -> std::optional<Nanoseconds>
+    {
+        const auto result = RunConfiguration(m_KernelRunner, kernel, detector.GetSentinel(), dimensions);
+        return result.IsValid() ? std::optional<Nanoseconds>(result.GetTotalDuration()) : std::nullopt;
+    };
+
+    const auto duration = measureSentinel();
+
+    if (!duration.has_value() || !detector.IsOutlier(*duration))
+    {
+        if (duration.has_value())
+        {
+            detector.AddSentinelDuration(*duration);
+        }
+
+        periodBegin = results.size();
+        return;
+    }
+
+    const auto& time = TimeConfiguration::GetInstance();
+    Logger::LogWarning("Sentinel configuration for kernel " + kernel.GetName() + " was measured in "
+        + std::to_string(time.ConvertFromNanoseconds(*duration)) + time.GetUnitTag() + ", while its typical duration is "
+        + std::to_string(time.ConvertFromNanoseconds(detector.GetTypicalDuration())) + time.GetUnitTag());
+
+    // Transient disturbance such as a slow launch affects only a single measurement, while throttling persists
+    const auto confirmation = measureSentinel();
+
+    if (confirmation.has_value() && !detector.IsOutlier(*confirmation))
+    {
+        Logger::LogInfo("Re-measuring " + std::to_string(results.size() - periodBegin) + " configurations for kernel "
+            + kernel.GetName() + " affected by transient measurement anomaly");
+        detector.AddSentinelDuration(*confirmation);
+
+        for (size_t i = periodBegin; i < results.size(); ++i)
+        {
+            auto result = RunConfiguration(m_KernelRunner, kernel, results[i].GetConfiguration(), dimensions);
+            result.SetSearcherOverhead(results[i].GetSearcherOverhead());
+            results[i] = result;
+            m_ConfigurationManager->UpdateResult(id, result);
+        }
+    }
+    else if (confirmation.has_value())
+    {
+        // Sentinel history is not updated, so that durations are always corrected towards the performance before the drift
+        const double factor = detector.GetDriftFactor(*confirmation);
+        Logger::LogInfo("Applying drift correction with factor " + std::to_string(factor) + " to "
+            + std::to_string(results.size() - periodBegin) + " configurations for kernel " + kernel.GetName());
+
+        for (size_t i = periodBegin; i < results.size(); ++i)
+        {
+            if (results[i].IsValid())
+            {
+                results[i].ApplyDriftCorrection(factor);
+                m_ConfigurationManager->UpdateResult(id, results[i]);
+            }
+        }
+    }
+
+    periodBegin = results.size();
+}
+
+void TuningRunner::UpdateRacingIncumbent(const KernelId id, const KernelResult& result)
+{
+    if (!result.IsValid() || !result.HasMeasurementStatistics())
+    {
+        return;
+    }
+
+    const auto& statistics = result.GetMeasurementStatistics();
+
+    if (statistics.m_EarlyAborted)
+    {
+        return;
+    }
+
+    const auto incumbent = m_RacingIncumbents.find(id);
+
+    if (incumbent == m_RacingIncumbents.cend() || statistics.m_Median < incumbent->second.m_Median)
+    {
+        m_RacingIncumbents[id] = statistics;
+    }
+}
+
+KernelResult TuningRunner::RunConfiguration(KernelRunner& runner, const Kernel& kernel, const KernelConfiguration& configuration,
+    const KernelDimensions& dimensions)
+{
+    KernelResult result;
+    KernelResult multiResult(kernel.GetName(), configuration);
+    uint64_t runCount = 0;
+
+    do
+    {
+        result = runner.RunKernel(kernel, configuration, dimensions, KernelRunMode::OfflineTuning, std::vector<BufferOutputDescriptor>{});
+        multiResult.FuseProfilingTimes(result, runCount == 0);
+        multiResult.TransferPowerData(result);
+        ++runCount;
+    }
+    while (result.HasRemainingProfilingRuns());
+
+    if (runCount > 1)
+    {
+        result.CopyProfilingTimes(multiResult);
+        result.TransferPowerData(multiResult);
+    }
+
+    return result;
+}
+
+void TuningRunner::CheckParallelArguments(const Kernel& kernel)
+{
+    for (const auto* argument : kernel.GetVectorArguments())
+    {
+        // Zero-copy buffers of all devices would share the same host memory, so the devices would overwrite each other's output
+        if (argument->GetMemoryLocation() == ArgumentMemoryLocation::HostZeroCopy
+            && argument->GetAccessType() != ArgumentAccessType::ReadOnly)
+        {
+            throw KttException("Writable argument with id " + argument->GetId()
+                + " uses host zero-copy memory, which is not supported in multi-device tuning");
+        }
+    }
+}
+
+bool TuningRunner::IsSandboxWorker()
+{
+    return std::getenv(m_SandboxPortVariable.c_str()) != nullptr && std::getenv(m_SandboxKernelVariable.c_str()) != nullptr;
+}
+
+bool TuningRunner::WaitForSandboxResult(TcpSocket& socket, const uint64_t index, const std::chrono::steady_clock::time_point deadline,
+    KernelResult& result)
+{
+    const std::vector<TcpSocket*> sockets{&socket};
+    std::string message;
+
+    while (!socket.PopMessage(message))
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now >= deadline)
+        {
+            return false;
+        }
+
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1);
+
+        if (!TcpSocket::WaitForData(sockets, remaining).empty() && !socket.ReadAvailable())
+        {
+            return false;
+        }
+    }
+
+    try
+    {
+        const json content = json::parse(message);
+
+        if (content.at("Type").get<std::string>() != "Result" || content.at("Index").get<uint64_t>() != index)
+        {
+            throw KttException("Sandbox worker process has sent unexpected message: " + message);
+        }
+
+        content.at("Result").get_to(result);
+    }
+    catch (const json::exception& exception)
+    {
+        throw KttException(std::string("Invalid message from sandbox worker process: ") + exception.what());
+    }
+
+    return true;
+}
+
+void TuningRunner::DropWorker(const DeviceIndex workerId, std::map<DeviceIndex, DistributedWorker>& workers,
+    std::map<uint64_t, ConfigurationLease>& leases)
 {
-    for (const auto& result : results)
+    for (auto lease = leases.begin(); lease != leases.end();)
     {
-        if (result.GetConfiguration() == configuration)
+        if (lease->second.m_Worker == workerId)
+        {
+            lease = leases.erase(lease);
+        }
+        else
         {
-            return result;
+            ++lease;
         }
     }
 
-    throw KttException("Matching configuration was not found");
+    workers.erase(workerId);
 }
 
 } // namespace ktt
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <vector>
+#include <ctpl_stl.h>
 
 #include <Api/Output/BufferOutputDescriptor.h>
 #include <Api/Output/KernelResult.h>
@@ -9,6 +17,10 @@
 #include <Kernel/Kernel.h>
 #include <KernelRunner/KernelRunner.h>
 #include <TuningRunner/ConfigurationManager.h>
+#include <TuningRunner/OutlierDetector.h>
+#include <Utility/ChildProcess.h>
+#include <Utility/TcpSocket.h>
+#include <Utility/Timer/VirtualClock.h>
 
 namespace ktt
 {
@@ -16,25 +28,98 @@ namespace ktt
 class TuningRunner
 {
 public:
-    explicit TuningRunner(KernelRunner& kernelRunner);
+    explicit TuningRunner(KernelRunner& kernelRunner, const VirtualClock* virtualClock);
 
     std::vector<KernelResult> Tune(const Kernel& kernel, const KernelDimensions& dimensions, std::unique_ptr<StopCondition> stopCondition);
+    std::vector<KernelResult> TuneDistributed(const Kernel& kernel, const uint16_t port, const std::chrono::seconds leaseTimeout,
+        std::unique_ptr<StopCondition> stopCondition);
+    uint64_t RunWorker(const Kernel& kernel, const KernelDimensions& dimensions, const std::string& host, const uint16_t port);
+    bool RunSandboxWorker(const Kernel& kernel, const KernelDimensions& dimensions);
     KernelResult TuneIteration(const Kernel& kernel, const KernelDimensions& dimensions, const KernelRunMode mode,
         const std::vector<BufferOutputDescriptor>& output, const bool recomputeReference);
     std::vector<KernelResult> SimulateTuning(const Kernel& kernel, const std::vector<KernelResult>& results,
         std::unique_ptr<StopCondition> stopCondition);
+    void Precompile(const Kernel& kernel, const uint64_t startIndex, const uint64_t endIndex);
 
     void SetSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void SetCompilationLookahead(const uint64_t count);
+    void SetParallelRunners(const std::vector<KernelRunner*>& runners);
+    void SetSandboxedExecution(const bool flag, const double timeoutFactor, const std::chrono::seconds minimumTimeout,
+        const std::vector<std::string>& workerArguments);
+    void SetOutlierDetection(const uint64_t sentinelInterval);
+    void SetObjectives(const KernelId id, const std::vector<TuningObjective>& objectives, ObjectiveScalarization scalarization);
     void InitializeConfigurationData(const Kernel& kernel);
     void ClearConfigurationData(const KernelId id, const bool clearSearcher = false);
+    void ClearRacingIncumbents();
     uint64_t GetConfigurationsCount(const KernelId id) const;
     KernelConfiguration GetBestConfiguration(const KernelId id) const;
+    std::vector<KernelResult> GetParetoFront(const KernelId id) const;
 
 private:
     KernelRunner& m_KernelRunner;
+    const VirtualClock* m_VirtualClock;
     std::unique_ptr<ConfigurationManager> m_ConfigurationManager;
+    std::map<KernelId, MeasurementStatistics> m_RacingIncumbents;
+    uint64_t m_CompilationLookahead;
+    std::vector<KernelRunner*> m_ParallelRunners;
+    std::unique_ptr<ctpl::thread_pool> m_DevicePool;
+    bool m_Sandboxed;
+    double m_SandboxTimeoutFactor;
+    std::chrono::seconds m_SandboxMinimumTimeout;
+    std::vector<std::string> m_SandboxWorkerArguments;
+    uint64_t m_OutlierDetectionInterval;
+
+    inline static const uint64_t m_PrecompilationBatchSize = 1024;
+    inline static const std::chrono::milliseconds m_WorkerPollInterval = std::chrono::milliseconds(100);
+    inline static const std::string m_SandboxPortVariable = "KTT_SANDBOX_PORT";
+    inline static const std::string m_SandboxKernelVariable = "KTT_SANDBOX_KERNEL";
+    inline static const std::chrono::seconds m_SandboxStartupTimeout = std::chrono::seconds(60);
+
+    struct CompletedRun
+    {
+        size_t m_Device;
+        uint64_t m_Index;
+        KernelResult m_Result;
+        std::exception_ptr m_Failure;
+    };
+
+    struct DistributedWorker
+    {
+        std::unique_ptr<TcpSocket> m_Socket;
+        bool m_Ready;
+        bool m_Idle;
+    };
+
+    struct ConfigurationLease
+    {
+        DeviceIndex m_Worker;
+        std::chrono::steady_clock::time_point m_Deadline;
+    };
+
+    std::vector<KernelResult> TuneParallel(const Kernel& kernel, const KernelDimensions& dimensions, StopCondition* stopCondition);
+    std::vector<KernelResult> TuneSandboxed(const Kernel& kernel, StopCondition* stopCondition);
+    std::unique_ptr<TcpSocket> AcceptSandboxWorker(const Kernel& kernel, TcpSocket& listener, ChildProcess& process) const;
+    std::chrono::nanoseconds GetSandboxTimeout(const std::optional<Nanoseconds> bestTime) const;
+    void ProcessFinishedResults(const KernelId id, std::map<uint64_t, KernelResult>& finishedResults, std::vector<KernelResult>& results,
+        StopCondition* stopCondition, bool& stopped);
+    std::vector<uint64_t> GetCandidateIndices(const KernelId id, const size_t lookahead) const;
+    void CheckUpcomingConfigurations(const Kernel& kernel) const;
+    void ProcessWorkerMessage(const Kernel& kernel, const DeviceIndex workerId, const std::string& message,
+        std::map<DeviceIndex, DistributedWorker>& workers, std::map<uint64_t, ConfigurationLease>& leases,
+        std::map<uint64_t, KernelResult>& finishedResults, std::set<uint64_t>& completedIndices);
+    KernelResult ConfirmBestResult(const Kernel& kernel, const KernelDimensions& dimensions, const KernelResult& result);
+    void CheckMeasurementDrift(const Kernel& kernel, const KernelDimensions& dimensions, OutlierDetector& detector,
+        std::vector<KernelResult>& results, size_t& periodBegin);
+    void UpdateRacingIncumbent(const KernelId id, const KernelResult& result);
 
-    static const KernelResult& FindMatchingResult(const std::vector<KernelResult>& results, const KernelConfiguration& configuration);
+    static KernelResult RunConfiguration(KernelRunner& runner, const Kernel& kernel, const KernelConfiguration& configuration,
+        const KernelDimensions& dimensions);
+    static void CheckParallelArguments(const Kernel& kernel);
+    static bool IsSandboxWorker();
+    static bool WaitForSandboxResult(TcpSocket& socket, const uint64_t index, const std::chrono::steady_clock::time_point deadline,
+        KernelResult& result);
+    static void DropWorker(const DeviceIndex workerId, std::map<DeviceIndex, DistributedWorker>& workers,
+        std::map<uint64_t, ConfigurationLease>& leases);
 };
 
 } // namespace ktt
@@ -0,0 +1,219 @@
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <csignal>
+#include <fstream>
+#include <vector>
+#include <spawn.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif // _WIN32
+
+#include <Api/KttException.h>
+#include <Utility/ChildProcess.h>
+
+#if !defined(_WIN32)
+extern char** environ;
+#endif // _WIN32
+
+namespace ktt
+{
+
+#if defined(_WIN32)
+
+ChildProcess::ChildProcess(const std::vector<std::string>& arguments, const std::map<std::string, std::string>& environment) :
+    m_Process(nullptr),
+    m_Running(false)
+{
+    // Child inherits environment of the current process, so the additional variables are set only for the duration of its launch
+    std::map<std::string, std::string> previousEnvironment;
+
+    for (const auto& [name, value] : environment)
+    {
+        const DWORD size = GetEnvironmentVariableA(name.c_str(), nullptr, 0);
+
+        if (size > 0)
+        {
+            std::string previousValue(size, '\0');
+            GetEnvironmentVariableA(name.c_str(), previousValue.data(), size);
+            previousValue.resize(size - 1);
+            previousEnvironment[name] = previousValue;
+        }
+
+        SetEnvironmentVariableA(name.c_str(), value.c_str());
+    }
+
+    std::string commandLine = GetCommandLineA();
+
+    if (!arguments.empty())
+    {
+        std::string executable(MAX_PATH, '\0');
+        executable.resize(GetModuleFileNameA(nullptr, executable.data(), MAX_PATH));
+        commandLine = "\"" + executable + "\"";
+
+        for (const auto& argument : arguments)
+        {
+            commandLine += " \"" + argument + "\"";
+        }
+    }
+
+    STARTUPINFOA startupInfo{};
+    startupInfo.cb = sizeof(startupInfo);
+    PROCESS_INFORMATION processInfo{};
+
+    const BOOL created = CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo,
+        &processInfo);
+
+    for (const auto& pair : environment)
+    {
+        const auto previous = previousEnvironment.find(pair.first);
+        SetEnvironmentVariableA(pair.first.c_str(), previous != previousEnvironment.cend() ? previous->second.c_str() : nullptr);
+    }
+
+    if (!created)
+    {
+        throw KttException("Unable to launch child process");
+    }
+
+    CloseHandle(processInfo.hThread);
+    m_Process = processInfo.hProcess;
+    m_Running = true;
+}
+
+ChildProcess::~ChildProcess()
+{
+    Terminate();
+
+    if (m_Process != nullptr)
+    {
+        CloseHandle(m_Process);
+    }
+}
+
+bool ChildProcess::IsRunning()
+{
+    if (m_Running && WaitForSingleObject(m_Process, 0) != WAIT_TIMEOUT)
+    {
+        m_Running = false;
+    }
+
+    return m_Running;
+}
+
+void ChildProcess::Terminate()
+{
+    if (!m_Running)
+    {
+        return;
+    }
+
+    TerminateProcess(m_Process, 1);
+    WaitForSingleObject(m_Process, INFINITE);
+    m_Running = false;
+}
+
+#else
+
+ChildProcess::ChildProcess(const std::vector<std::string>& arguments, const std::map<std::string, std::string>& environment) :
+    m_Process(-1),
+    m_Running(false)
+{
+    std::ifstream commandLine("/proc/self/cmdline", std::ios::binary);
+
+    if (!commandLine.is_open())
+    {
+        throw KttException("Unable to retrieve command line of the current process");
+    }
+
+    std::vector<std::string> processArguments;
+    std::string argument;
+
+    while (std::getline(commandLine, argument, '\0'))
+    {
+        processArguments.push_back(argument);
+
+        // Only the program name is kept when different arguments are specified
+        if (!arguments.empty())
+        {
+            processArguments.insert(processArguments.end(), arguments.cbegin(), arguments.cend());
+            break;
+        }
+    }
+
+    std::vector<std::string> variables;
+
+    for (char** variable = environ; *variable != nullptr; ++variable)
+    {
+        const std::string entry(*variable);
+
+        if (environment.find(entry.substr(0, entry.find('='))) == environment.cend())
+        {
+            variables.push_back(entry);
+        }
+    }
+
+    for (const auto& [name, value] : environment)
+    {
+        variables.push_back(name + "=" + value);
+    }
+
+    std::vector<char*> argumentPointers;
+    std::vector<char*> variablePointers;
+
+    for (auto& currentArgument : processArguments)
+    {
+        argumentPointers.push_back(currentArgument.data());
+    }
+
+    for (auto& variable : variables)
+    {
+        variablePointers.push_back(variable.data());
+    }
+
+    argumentPointers.push_back(nullptr);
+    variablePointers.push_back(nullptr);
+
+    // Executable is referenced through procfs, so that the child runs the same binary regardless of working directory and path
+    pid_t process;
+
+    if (posix_spawn(&process, "/proc/self/exe", nullptr, nullptr, argumentPointers.data(), variablePointers.data()) != 0)
+    {
+        throw KttException("Unable to launch child process");
+    }
+
+    m_Process = static_cast<int>(process);
+    m_Running = true;
+}
+
+ChildProcess::~ChildProcess()
+{
+    Terminate();
+}
+
+bool ChildProcess::IsRunning()
+{
+    if (m_Running && waitpid(static_cast<pid_t>(m_Process), nullptr, WNOHANG) != 0)
+    {
+        m_Running = false;
+    }
+
+    return m_Running;
+}
+
+void ChildProcess::Terminate()
+{
+    if (!m_Running)
+    {
+        return;
+    }
+
+    kill(static_cast<pid_t>(m_Process), SIGKILL);
+    waitpid(static_cast<pid_t>(m_Process), nullptr, 0);
+    m_Running = false;
+}
+
+#endif // _WIN32
+
+} // namespace ktt
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Utility/DisableCopyMove.h>
+
+namespace ktt
+{
+
+// Child process runs the same executable as the current process, with the same command line arguments unless different ones are
+// specified
+class ChildProcess : public DisableCopyMove
+{
+public:
+    explicit ChildProcess(const std::vector<std::string>& arguments, const std::map<std::string, std::string>& environment);
+    ~ChildProcess();
+
+    bool IsRunning();
+    void Terminate();
+
+private:
+#if defined(_WIN32)
+    void* m_Process;
+#else
+    int m_Process;
+#endif // _WIN32
+
+    bool m_Running;
+};
+
+} // namespace ktt
@@ -42,6 +42,9 @@ void Logger::Log(const LoggingLevel level, const std::string& message) const
         return;
     }
 
+    // Messages may be logged from multiple threads, e.g., during multi-device tuning
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
     if (m_FileValid)
     {
         std::ofstream outputFile(m_File, std::ios::app | std::ios_base::out);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <ostream>
 #include <string>
 
@@ -31,6 +32,7 @@ private:
     std::ostream* m_OutputTarget;
     std::string m_File;
     bool m_FileValid;
+    mutable std::mutex m_Mutex;
 
     Logger();
     static std::string GetLoggingLevelString(const LoggingLevel level);
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <list>
 #include <unordered_map>
 #include <utility>
@@ -16,32 +19,58 @@ public:
     using ListIterator = typename std::list<KeyValuePair>::iterator;
 
     LruCache(const size_t maxSize) :
-        m_MaxSize(maxSize)
+        m_MaxSize(maxSize),
+        m_MemoryLimit(0),
+        m_MemorySize(0),
+        m_SegmentedFlag(false),
+        m_HitCount(0),
+        m_MissCount(0),
+        m_EvictionCount(0)
     {}
-    
-    void Put(const KeyType& key, const ValueType& value)
+
+    void Put(const KeyType& key, const ValueType& value, const uint64_t memorySize = 0)
     {
-        PutPrivate(key, value);
+        PutPrivate(key, value, memorySize);
     }
-    
-    void Put(const KeyType& key, ValueType&& value)
+
+    void Put(const KeyType& key, ValueType&& value, const uint64_t memorySize = 0)
     {
-        PutPrivate(key, std::move(value));
+        PutPrivate(key, std::move(value), memorySize);
     }
 
     ListIterator Get(const KeyType& key)
     {
         auto it = m_ItemsMap.find(key);
-        
+
         if (it == m_ItemsMap.cend())
         {
+            ++m_MissCount;
             return End();
         }
 
-        m_ItemsList.splice(m_ItemsList.begin(), m_ItemsList, it->second);
-        return it->second;
+        ++m_HitCount;
+        CacheEntry& entry = it->second;
+
+        if (!m_SegmentedFlag)
+        {
+            m_ItemsList.splice(m_ItemsList.begin(), m_ItemsList, entry.m_Iterator);
+            return entry.m_Iterator;
+        }
+
+        // Items which are accessed repeatedly are promoted into protected segment, so that they are not evicted by items used once
+        m_ProtectedList.splice(m_ProtectedList.begin(), entry.m_Protected ? m_ProtectedList : m_ItemsList, entry.m_Iterator);
+        entry.m_Protected = true;
+
+        if (m_ProtectedList.size() > GetProtectedSize())
+        {
+            auto last = std::prev(m_ProtectedList.end());
+            m_ItemsMap[last->first].m_Protected = false;
+            m_ItemsList.splice(m_ItemsList.begin(), m_ProtectedList, last);
+        }
+
+        return entry.m_Iterator;
     }
-    
+
     void SetMaxSize(const size_t maxSize)
     {
         if (m_MaxSize > maxSize)
@@ -52,17 +81,43 @@ public:
         m_MaxSize = maxSize;
     }
 
+    void SetMemoryLimit(const uint64_t limit)
+    {
+        m_MemoryLimit = limit;
+        EvictItems();
+    }
+
+    void SetSegmented(const bool flag)
+    {
+        if (m_SegmentedFlag == flag)
+        {
+            return;
+        }
+
+        // Switching policy forgets access history, all items start in probationary segment
+        m_ItemsList.splice(m_ItemsList.begin(), m_ProtectedList);
+
+        for (auto& pair : m_ItemsMap)
+        {
+            pair.second.m_Protected = false;
+        }
+
+        m_SegmentedFlag = flag;
+    }
+
     void Clear()
     {
         m_ItemsList.clear();
+        m_ProtectedList.clear();
         m_ItemsMap.clear();
+        m_MemorySize = 0;
     }
 
     bool Exists(const KeyType& key) const
     {
         return m_ItemsMap.find(key) != m_ItemsMap.cend();
     }
-    
+
     size_t Size() const noexcept
     {
         return m_ItemsMap.size();
@@ -73,43 +128,96 @@ public:
         return m_MaxSize;
     }
 
+    uint64_t GetMemorySize() const noexcept
+    {
+        return m_MemorySize;
+    }
+
+    uint64_t GetHitCount() const noexcept
+    {
+        return m_HitCount;
+    }
+
+    uint64_t GetMissCount() const noexcept
+    {
+        return m_MissCount;
+    }
+
+    uint64_t GetEvictionCount() const noexcept
+    {
+        return m_EvictionCount;
+    }
+
     ListIterator Begin()
     {
         return m_ItemsList.begin();
     }
-    
+
     ListIterator End()
     {
         return m_ItemsList.end();
     }
 
 private:
+    struct CacheEntry
+    {
+        ListIterator m_Iterator;
+        uint64_t m_MemorySize;
+        bool m_Protected;
+    };
+
     std::list<KeyValuePair> m_ItemsList;
-    std::unordered_map<KeyType, ListIterator> m_ItemsMap;
+    std::list<KeyValuePair> m_ProtectedList;
+    std::unordered_map<KeyType, CacheEntry> m_ItemsMap;
     size_t m_MaxSize;
+    uint64_t m_MemoryLimit;
+    uint64_t m_MemorySize;
+    bool m_SegmentedFlag;
+    uint64_t m_HitCount;
+    uint64_t m_MissCount;
+    uint64_t m_EvictionCount;
 
     template <typename PrivateValueType>
-    void PutPrivate(const KeyType& key, PrivateValueType&& value)
+    void PutPrivate(const KeyType& key, PrivateValueType&& value, const uint64_t memorySize)
     {
         auto it = m_ItemsMap.find(key);
-        m_ItemsList.push_front(KeyValuePair(key, std::forward<PrivateValueType>(value)));
 
         if (it != m_ItemsMap.cend())
         {
-            m_ItemsList.erase(it->second);
-            m_ItemsMap.erase(it);
+            Erase(it);
         }
 
-        m_ItemsMap[key] = m_ItemsList.begin();
+        m_ItemsList.push_front(KeyValuePair(key, std::forward<PrivateValueType>(value)));
+        m_ItemsMap[key] = CacheEntry{m_ItemsList.begin(), memorySize, false};
+        m_MemorySize += memorySize;
+        EvictItems();
+    }
 
-        if (m_ItemsMap.size() > m_MaxSize)
+    void EvictItems()
+    {
+        // The most recently inserted item is always kept, even if it alone exceeds the memory limit
+        while (m_ItemsMap.size() > 1 && (m_ItemsMap.size() > m_MaxSize || (m_MemoryLimit > 0 && m_MemorySize > m_MemoryLimit)))
         {
-            auto last = m_ItemsList.end();
-            --last;
-            m_ItemsMap.erase(last->first);
-            m_ItemsList.pop_back();
+            const bool evictProtected = m_ItemsList.size() <= 1 && !m_ProtectedList.empty();
+            auto& list = evictProtected ? m_ProtectedList : m_ItemsList;
+            Erase(m_ItemsMap.find(std::prev(list.end())->first));
+            ++m_EvictionCount;
         }
     }
+
+    void Erase(typename std::unordered_map<KeyType, CacheEntry>::iterator it)
+    {
+        const CacheEntry& entry = it->second;
+        m_MemorySize -= entry.m_MemorySize;
+        (entry.m_Protected ? m_ProtectedList : m_ItemsList).erase(entry.m_Iterator);
+        m_ItemsMap.erase(it);
+    }
+
+    size_t GetProtectedSize() const
+    {
+        // Protected segment takes up to 80% of the cache, remaining capacity is used for newly inserted items
+        return std::max<size_t>(1, m_MaxSize * 4 / 5);
+    }
 };
 
 } // namespace ktt
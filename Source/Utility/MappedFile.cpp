@@ -0,0 +1,140 @@
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include <Api/KttException.h>
+#include <Utility/MappedFile.h>
+
+namespace ktt
+{
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& filePath) :
+    m_Data(nullptr),
+    m_Size(0),
+    m_File(INVALID_HANDLE_VALUE),
+    m_Mapping(nullptr)
+{
+    m_File = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (m_File == INVALID_HANDLE_VALUE)
+    {
+        throw KttException("Unable to open file: " + filePath);
+    }
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(m_File, &size))
+    {
+        CloseHandle(m_File);
+        throw KttException("Unable to retrieve size of file: " + filePath);
+    }
+
+    m_Size = static_cast<size_t>(size.QuadPart);
+
+    if (m_Size == 0)
+    {
+        return;
+    }
+
+    m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (m_Mapping != nullptr)
+    {
+        m_Data = MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+
+    if (m_Data == nullptr)
+    {
+        if (m_Mapping != nullptr)
+        {
+            CloseHandle(m_Mapping);
+        }
+
+        CloseHandle(m_File);
+        throw KttException("Unable to map file into memory: " + filePath);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_Data != nullptr)
+    {
+        UnmapViewOfFile(m_Data);
+        CloseHandle(m_Mapping);
+    }
+
+    CloseHandle(m_File);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filePath) :
+    m_Data(nullptr),
+    m_Size(0),
+    m_File(-1)
+{
+    m_File = open(filePath.c_str(), O_RDONLY);
+
+    if (m_File == -1)
+    {
+        throw KttException("Unable to open file: " + filePath);
+    }
+
+    struct stat fileStatus;
+
+    if (fstat(m_File, &fileStatus) != 0)
+    {
+        close(m_File);
+        throw KttException("Unable to retrieve size of file: " + filePath);
+    }
+
+    m_Size = static_cast<size_t>(fileStatus.st_size);
+
+    if (m_Size == 0)
+    {
+        return;
+    }
+
+    void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_File, 0);
+
+    if (data == MAP_FAILED)
+    {
+        close(m_File);
+        throw KttException("Unable to map file into memory: " + filePath);
+    }
+
+    m_Data = data;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_Data != nullptr)
+    {
+        munmap(const_cast<void*>(m_Data), m_Size);
+    }
+
+    close(m_File);
+}
+
+#endif // _WIN32
+
+const void* MappedFile::GetData() const
+{
+    return m_Data;
+}
+
+size_t MappedFile::GetSize() const
+{
+    return m_Size;
+}
+
+} // namespace ktt
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <Utility/DisableCopyMove.h>
+
+namespace ktt
+{
+
+class MappedFile : public DisableCopyMove
+{
+public:
+    explicit MappedFile(const std::string& filePath);
+    ~MappedFile();
+
+    const void* GetData() const;
+    size_t GetSize() const;
+
+private:
+    const void* m_Data;
+    size_t m_Size;
+
+#if defined(_WIN32)
+    void* m_File;
+    void* m_Mapping;
+#else
+    int m_File;
+#endif // _WIN32
+};
+
+} // namespace ktt
@@ -0,0 +1,284 @@
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include <array>
+
+#include <Api/KttException.h>
+#include <Utility/TcpSocket.h>
+
+namespace ktt
+{
+
+#if defined(_WIN32)
+using PollDescriptor = WSAPOLLFD;
+const uintptr_t InvalidSocket = static_cast<uintptr_t>(INVALID_SOCKET);
+const int SendFlags = 0;
+#else
+using PollDescriptor = pollfd;
+const int InvalidSocket = -1;
+// Writing into a socket closed by the other side must not terminate the whole process
+const int SendFlags = MSG_NOSIGNAL;
+#endif // _WIN32
+
+TcpSocket::TcpSocket(const SocketHandle handle) :
+    m_Handle(handle)
+{}
+
+TcpSocket::~TcpSocket()
+{
+    CloseSocket(m_Handle);
+}
+
+std::unique_ptr<TcpSocket> TcpSocket::Listen(const uint16_t port, const bool localOnly)
+{
+    InitializeSockets();
+    const auto handle = static_cast<SocketHandle>(socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+
+    if (handle == InvalidSocket)
+    {
+        throw KttException("Unable to create listening socket");
+    }
+
+    std::unique_ptr<TcpSocket> result(new TcpSocket(handle));
+
+    // Coordinator can be restarted on the same port without waiting for closed connections to time out
+    const int reuse = 1;
+    setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(localOnly ? INADDR_LOOPBACK : INADDR_ANY);
+    address.sin_port = htons(port);
+
+    if (bind(handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        throw KttException("Unable to bind socket to port " + std::to_string(port));
+    }
+
+    if (listen(handle, SOMAXCONN) != 0)
+    {
+        throw KttException("Unable to listen on port " + std::to_string(port));
+    }
+
+    return result;
+}
+
+std::unique_ptr<TcpSocket> TcpSocket::Connect(const std::string& host, const uint16_t port)
+{
+    InitializeSockets();
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    addrinfo* addresses = nullptr;
+
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses) != 0)
+    {
+        throw KttException("Unable to resolve host " + host);
+    }
+
+    for (const addrinfo* address = addresses; address != nullptr; address = address->ai_next)
+    {
+        const auto handle = static_cast<SocketHandle>(socket(address->ai_family, address->ai_socktype, address->ai_protocol));
+
+        if (handle == InvalidSocket)
+        {
+            continue;
+        }
+
+        if (connect(handle, address->ai_addr, static_cast<socklen_t>(address->ai_addrlen)) == 0)
+        {
+            freeaddrinfo(addresses);
+            DisableDelay(handle);
+            return std::unique_ptr<TcpSocket>(new TcpSocket(handle));
+        }
+
+        CloseSocket(handle);
+    }
+
+    freeaddrinfo(addresses);
+    throw KttException("Unable to connect to " + host + ":" + std::to_string(port));
+}
+
+std::vector<TcpSocket*> TcpSocket::WaitForData(const std::vector<TcpSocket*>& sockets, const std::chrono::milliseconds timeout)
+{
+    std::vector<TcpSocket*> result;
+    std::vector<PollDescriptor> descriptors;
+
+    for (auto* socket : sockets)
+    {
+        // Messages which were already received do not need to wait for more data
+        if (socket->HasMessage())
+        {
+            result.push_back(socket);
+        }
+
+        PollDescriptor descriptor{};
+        descriptor.fd = socket->m_Handle;
+        descriptor.events = POLLIN;
+        descriptors.push_back(descriptor);
+    }
+
+    if (!result.empty() || descriptors.empty())
+    {
+        return result;
+    }
+
+#if defined(_WIN32)
+    const int count = WSAPoll(descriptors.data(), static_cast<ULONG>(descriptors.size()), static_cast<INT>(timeout.count()));
+#else
+    const int count = poll(descriptors.data(), static_cast<nfds_t>(descriptors.size()), static_cast<int>(timeout.count()));
+#endif // _WIN32
+
+    if (count < 0)
+    {
+        throw KttException("Waiting for socket data failed");
+    }
+
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        if (descriptors[i].revents != 0)
+        {
+            result.push_back(sockets[i]);
+        }
+    }
+
+    return result;
+}
+
+std::unique_ptr<TcpSocket> TcpSocket::Accept() const
+{
+    const auto handle = static_cast<SocketHandle>(accept(m_Handle, nullptr, nullptr));
+
+    if (handle == InvalidSocket)
+    {
+        throw KttException("Unable to accept connection on port " + std::to_string(GetPort()));
+    }
+
+    DisableDelay(handle);
+    return std::unique_ptr<TcpSocket>(new TcpSocket(handle));
+}
+
+void TcpSocket::Send(const std::string& message) const
+{
+    const std::string data = message + '\n';
+    size_t sentSize = 0;
+
+    while (sentSize < data.size())
+    {
+        const auto size = send(m_Handle, data.data() + sentSize, static_cast<int>(data.size() - sentSize), SendFlags);
+
+        if (size <= 0)
+        {
+            throw KttException("Unable to send message through socket");
+        }
+
+        sentSize += static_cast<size_t>(size);
+    }
+}
+
+bool TcpSocket::Receive(std::string& message)
+{
+    while (!PopMessage(message))
+    {
+        if (!ReadAvailable())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TcpSocket::ReadAvailable()
+{
+    std::array<char, m_ReceiveSize> buffer;
+    const auto size = recv(m_Handle, buffer.data(), static_cast<int>(buffer.size()), 0);
+
+    if (size <= 0)
+    {
+        return false;
+    }
+
+    m_Buffer.append(buffer.data(), static_cast<size_t>(size));
+    return true;
+}
+
+bool TcpSocket::PopMessage(std::string& message)
+{
+    const size_t end = m_Buffer.find('\n');
+
+    if (end == std::string::npos)
+    {
+        return false;
+    }
+
+    message = m_Buffer.substr(0, end);
+    m_Buffer.erase(0, end + 1);
+    return true;
+}
+
+bool TcpSocket::HasMessage() const
+{
+    return m_Buffer.find('\n') != std::string::npos;
+}
+
+uint16_t TcpSocket::GetPort() const
+{
+    sockaddr_in address{};
+    socklen_t size = sizeof(address);
+
+    if (getsockname(m_Handle, reinterpret_cast<sockaddr*>(&address), &size) != 0)
+    {
+        throw KttException("Unable to retrieve socket port");
+    }
+
+    return ntohs(address.sin_port);
+}
+
+void TcpSocket::InitializeSockets()
+{
+#if defined(_WIN32)
+    static const bool initialized = []()
+    {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+
+    if (!initialized)
+    {
+        throw KttException("Unable to initialize Windows sockets");
+    }
+#endif // _WIN32
+}
+
+void TcpSocket::CloseSocket(const SocketHandle handle)
+{
+#if defined(_WIN32)
+    closesocket(static_cast<SOCKET>(handle));
+#else
+    close(handle);
+#endif // _WIN32
+}
+
+void TcpSocket::DisableDelay(const SocketHandle handle)
+{
+    // Messages are short and each one is waited for by the other side, so they should not be delayed by Nagle's algorithm
+    const int flag = 1;
+    setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&flag), sizeof(flag));
+}
+
+} // namespace ktt
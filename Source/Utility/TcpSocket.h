@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Utility/DisableCopyMove.h>
+
+namespace ktt
+{
+
+// Messages are transferred as single lines of text, so they must not contain line breaks
+class TcpSocket : public DisableCopyMove
+{
+public:
+    ~TcpSocket();
+
+    static std::unique_ptr<TcpSocket> Listen(const uint16_t port, const bool localOnly = false);
+    static std::unique_ptr<TcpSocket> Connect(const std::string& host, const uint16_t port);
+    static std::vector<TcpSocket*> WaitForData(const std::vector<TcpSocket*>& sockets, const std::chrono::milliseconds timeout);
+
+    std::unique_ptr<TcpSocket> Accept() const;
+    void Send(const std::string& message) const;
+    bool Receive(std::string& message);
+    bool ReadAvailable();
+    bool PopMessage(std::string& message);
+    bool HasMessage() const;
+    uint16_t GetPort() const;
+
+private:
+#if defined(_WIN32)
+    using SocketHandle = uintptr_t;
+#else
+    using SocketHandle = int;
+#endif // _WIN32
+
+    SocketHandle m_Handle;
+    std::string m_Buffer;
+
+    explicit TcpSocket(const SocketHandle handle);
+
+    static void InitializeSockets();
+    static void CloseSocket(const SocketHandle handle);
+    static void DisableDelay(const SocketHandle handle);
+
+    inline static const size_t m_ReceiveSize = 4096;
+};
+
+} // namespace ktt
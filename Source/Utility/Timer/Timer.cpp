@@ -1,5 +1,6 @@
 #include <Utility/ErrorHandling/Assert.h>
 #include <Utility/Timer/Timer.h>
+#include <Utility/Timer/VirtualClock.h>
 
 namespace ktt
 {
@@ -11,14 +12,14 @@ Timer::Timer() :
 void Timer::Start()
 {
     KttAssert(!m_Running, "Calls to Start and Stop should be properly paired");
-    m_InitialTime = std::chrono::steady_clock::now();
+    m_InitialTime = VirtualClock::Now();
     m_Running = true;
 }
 
 void Timer::Stop()
 {
     KttAssert(m_Running, "Calls to Start and Stop should be properly paired");
-    m_EndTime = std::chrono::steady_clock::now();
+    m_EndTime = VirtualClock::Now();
     m_Running = false;
 }
 
@@ -41,7 +42,7 @@ Nanoseconds Timer::GetElapsedTime() const
 Nanoseconds Timer::GetCheckpointTime() const
 {
     KttAssert(m_Running, "Checkpoint time should only be retrieved when timer is running");
-    const auto currentTime = std::chrono::steady_clock::now();
+    const auto currentTime = VirtualClock::Now();
     return static_cast<Nanoseconds>(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - m_InitialTime).count());
 }
 
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <Utility/Timer/Timer.h>
+#include <Utility/Timer/TimerCalibration.h>
+
+namespace ktt
+{
+
+TimerCalibration::TimerCalibration()
+{
+    Reset();
+}
+
+void TimerCalibration::MeasureHostTimer()
+{
+    std::vector<Nanoseconds> overheads;
+    auto resolution = std::chrono::steady_clock::duration::max();
+
+    for (uint64_t i = 0; i < m_HostSampleCount; ++i)
+    {
+        Timer timer;
+        timer.Start();
+        timer.Stop();
+        overheads.push_back(timer.GetElapsedTime());
+
+        // Resolution is the smallest observable step of the clock, reading it repeatedly until the value changes finds the step
+        const auto first = std::chrono::steady_clock::now();
+        auto second = std::chrono::steady_clock::now();
+
+        while (second == first)
+        {
+            second = std::chrono::steady_clock::now();
+        }
+
+        resolution = std::min(resolution, second - first);
+    }
+
+    const auto median = overheads.begin() + overheads.size() / 2;
+    std::nth_element(overheads.begin(), median, overheads.end());
+
+    m_TimerOverhead = *median;
+    m_TimerResolution = static_cast<Nanoseconds>(std::chrono::duration_cast<std::chrono::nanoseconds>(resolution).count());
+}
+
+void TimerCalibration::SetLaunchOverhead(const Nanoseconds overhead)
+{
+    m_LaunchOverhead = overhead;
+}
+
+void TimerCalibration::SetEventTimingOverhead(const Nanoseconds overhead)
+{
+    m_EventTimingOverhead = overhead;
+}
+
+void TimerCalibration::SetTimerOverhead(const Nanoseconds overhead)
+{
+    m_TimerOverhead = overhead;
+}
+
+void TimerCalibration::SetTimerResolution(const Nanoseconds resolution)
+{
+    m_TimerResolution = resolution;
+}
+
+void TimerCalibration::SetValid(const bool flag)
+{
+    m_Valid = flag;
+}
+
+void TimerCalibration::Reset()
+{
+    m_LaunchOverhead = 0;
+    m_EventTimingOverhead = 0;
+    m_TimerOverhead = 0;
+    m_TimerResolution = 0;
+    m_Valid = false;
+}
+
+Nanoseconds TimerCalibration::CorrectKernelDuration(const Nanoseconds duration) const
+{
+    if (!m_Valid || duration == InvalidDuration)
+    {
+        return duration;
+    }
+
+    // Duration of an empty kernel is the bias of event timing, durations indistinguishable from it are reported as zero
+    return duration - std::min(duration, m_EventTimingOverhead);
+}
+
+Nanoseconds TimerCalibration::CorrectHostDuration(const Nanoseconds duration) const
+{
+    if (!m_Valid || duration == InvalidDuration)
+    {
+        return duration;
+    }
+
+    return duration - std::min(duration, m_TimerOverhead);
+}
+
+bool TimerCalibration::IsValid() const
+{
+    return m_Valid;
+}
+
+Nanoseconds TimerCalibration::GetLaunchOverhead() const
+{
+    return m_LaunchOverhead;
+}
+
+Nanoseconds TimerCalibration::GetEventTimingOverhead() const
+{
+    return m_EventTimingOverhead;
+}
+
+Nanoseconds TimerCalibration::GetTimerOverhead() const
+{
+    return m_TimerOverhead;
+}
+
+Nanoseconds TimerCalibration::GetTimerResolution() const
+{
+    return m_TimerResolution;
+}
+
+} // namespace ktt
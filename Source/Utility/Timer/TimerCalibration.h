@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+class TimerCalibration
+{
+public:
+    TimerCalibration();
+
+    void MeasureHostTimer();
+    void SetLaunchOverhead(const Nanoseconds overhead);
+    void SetEventTimingOverhead(const Nanoseconds overhead);
+    void SetTimerOverhead(const Nanoseconds overhead);
+    void SetTimerResolution(const Nanoseconds resolution);
+    void SetValid(const bool flag);
+    void Reset();
+
+    Nanoseconds CorrectKernelDuration(const Nanoseconds duration) const;
+    Nanoseconds CorrectHostDuration(const Nanoseconds duration) const;
+
+    bool IsValid() const;
+    Nanoseconds GetLaunchOverhead() const;
+    Nanoseconds GetEventTimingOverhead() const;
+    Nanoseconds GetTimerOverhead() const;
+    Nanoseconds GetTimerResolution() const;
+
+private:
+    Nanoseconds m_LaunchOverhead;
+    Nanoseconds m_EventTimingOverhead;
+    Nanoseconds m_TimerOverhead;
+    Nanoseconds m_TimerResolution;
+    bool m_Valid;
+
+    inline static const uint64_t m_HostSampleCount = 1000;
+};
+
+} // namespace ktt
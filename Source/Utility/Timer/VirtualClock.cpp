@@ -0,0 +1,53 @@
+#include <Utility/Timer/VirtualClock.h>
+
+namespace ktt
+{
+
+VirtualClock::VirtualClock() :
+    m_Offset(0)
+{}
+
+void VirtualClock::Advance(const Nanoseconds duration)
+{
+    m_Offset += duration;
+}
+
+Nanoseconds VirtualClock::GetOffset() const
+{
+    return m_Offset.load();
+}
+
+std::chrono::steady_clock::time_point VirtualClock::Now()
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    if (m_ActiveClock == nullptr)
+    {
+        return now;
+    }
+
+    return now + std::chrono::nanoseconds(m_ActiveClock->GetOffset());
+}
+
+void VirtualClock::SetActiveClock(const VirtualClock* clock)
+{
+    m_ActiveClock = clock;
+}
+
+const VirtualClock* VirtualClock::GetActiveClock()
+{
+    return m_ActiveClock;
+}
+
+VirtualClockScope::VirtualClockScope(const VirtualClock* clock) :
+    m_PreviousClock(VirtualClock::GetActiveClock())
+{
+    VirtualClock::SetActiveClock(clock);
+}
+
+VirtualClockScope::~VirtualClockScope()
+{
+    VirtualClock::SetActiveClock(m_PreviousClock);
+}
+
+} // namespace ktt
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <Utility/DisableCopyMove.h>
+#include <KttTypes.h>
+
+namespace ktt
+{
+
+// Steady clock which can be advanced by durations of simulated kernel runs, so that time-based stop conditions measure
+// replayed tuning as if the kernels were really executed. Each replay tuner owns its clock, which is only visible to timers and
+// stop conditions on the thread which performs tuning with that tuner.
+class VirtualClock : public DisableCopyMove
+{
+public:
+    VirtualClock();
+
+    void Advance(const Nanoseconds duration);
+    Nanoseconds GetOffset() const;
+
+    static std::chrono::steady_clock::time_point Now();
+    static void SetActiveClock(const VirtualClock* clock);
+    static const VirtualClock* GetActiveClock();
+
+private:
+    std::atomic<Nanoseconds> m_Offset;
+
+    inline static thread_local const VirtualClock* m_ActiveClock = nullptr;
+};
+
+// Makes the clock active on the current thread until the end of scope, wall-clock time is used when the clock is null
+class VirtualClockScope : public DisableCopyMove
+{
+public:
+    explicit VirtualClockScope(const VirtualClock* clock);
+    ~VirtualClockScope();
+
+private:
+    const VirtualClock* m_PreviousClock;
+};
+
+} // namespace ktt
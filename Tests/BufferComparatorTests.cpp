@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <catch.hpp>
+
+#include <KernelRunner/BufferComparator.h>
+
+TEST_CASE("Comparison of result buffers", "BufferComparator")
+{
+    const ktt::BufferComparator comparator;
+    const std::vector<float> reference(10000, 1.0f);
+    std::vector<float> result = reference;
+
+    SECTION("Matching buffers are valid and differences are summarized")
+    {
+        result[5000] = 1.5f;
+        const auto summary = comparator.Compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::SideBySideComparison, 1.0);
+
+        REQUIRE(summary.m_Valid);
+        REQUIRE_FALSE(summary.HasMismatch());
+        REQUIRE(summary.m_ComparedCount == 10000);
+        REQUIRE(summary.m_WorstIndex == 5000);
+        REQUIRE(summary.m_WorstDifference == 0.5);
+        REQUIRE(summary.m_Histogram[0] == 9999);
+        REQUIRE(summary.m_Histogram[7] == 1);
+    }
+
+    SECTION("The first mismatch is reported")
+    {
+        result[7000] = 5.0f;
+        result[3000] = 3.0f;
+        const auto summary = comparator.Compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::SideBySideComparison, 1.0);
+
+        REQUIRE_FALSE(summary.m_Valid);
+        REQUIRE(summary.m_MismatchIndex == 3000);
+        REQUIRE(summary.m_MismatchResult == 3.0);
+    }
+
+    SECTION("NaN differences are mismatches and worst elements for every method")
+    {
+        result[20] = 0.5f;
+        result[100] = std::numeric_limits<float>::quiet_NaN();
+
+        for (const auto method : {ktt::ValidationMethod::AbsoluteDifference, ktt::ValidationMethod::SideBySideComparison,
+            ktt::ValidationMethod::SideBySideRelativeComparison})
+        {
+            const auto summary = comparator.Compare(result.data(), reference.data(), result.size(), method, 1000.0);
+
+            REQUIRE_FALSE(summary.m_Valid);
+            REQUIRE(summary.m_MismatchIndex == 100);
+            REQUIRE(summary.m_WorstIndex == 100);
+            REQUIRE(std::isnan(summary.m_WorstDifference));
+            REQUIRE(summary.m_Histogram[0] == summary.m_ComparedCount - 2);
+            REQUIRE(summary.m_Histogram.back() == 1);
+        }
+    }
+
+    SECTION("Integer buffers are compared exactly")
+    {
+        const std::vector<int> integerReference(100, 7);
+        std::vector<int> integerResult = integerReference;
+        integerResult[42] = 8;
+
+        const auto summary = comparator.Compare(integerResult.data(), integerReference.data(), integerResult.size(),
+            ktt::ValidationMethod::SideBySideComparison, 10.0);
+
+        REQUIRE_FALSE(summary.m_Valid);
+        REQUIRE(summary.m_MismatchIndex == 42);
+    }
+}
+
+TEST_CASE("Comparison of large buffers in parallel chunks", "BufferComparator")
+{
+    const ktt::BufferComparator comparator;
+    const size_t chunkSize = 1 << 20;
+    const std::vector<float> reference(4 * chunkSize, 2.0f);
+    std::vector<float> result = reference;
+
+    SECTION("Mismatch with the lowest index is reported regardless of chunk completion order")
+    {
+        result[chunkSize + 100] = 3.0f;
+        result[2 * chunkSize] = 4.0f;
+        result[3 * chunkSize + 5] = 5.0f;
+
+        const auto summary = comparator.Compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::SideBySideComparison, 0.1);
+
+        REQUIRE_FALSE(summary.m_Valid);
+        REQUIRE(summary.m_MismatchIndex == chunkSize + 100);
+        REQUIRE(summary.m_MismatchResult == 3.0);
+    }
+
+    SECTION("Sum of absolute differences is limited by the threshold")
+    {
+        for (size_t i = 0; i < result.size(); i += 1000)
+        {
+            result[i] = 2.5f;
+        }
+
+        const auto valid = comparator.Compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::AbsoluteDifference, 10000.0);
+        REQUIRE(valid.m_Valid);
+        REQUIRE(valid.m_ComparedCount == result.size());
+
+        const auto invalid = comparator.Compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::AbsoluteDifference, 100.0);
+        REQUIRE_FALSE(invalid.m_Valid);
+    }
+}
+
+TEST_CASE("Comparison of sampled elements", "BufferComparator")
+{
+    const ktt::BufferComparator comparator;
+    const size_t range = 100000;
+    const auto indices = ktt::BufferComparator::GenerateSampleIndices(range, ktt::BufferComparator::m_DefaultSampleCount);
+
+    SECTION("Sample is deterministic, sorted and contains buffer edges")
+    {
+        REQUIRE(indices == ktt::BufferComparator::GenerateSampleIndices(range, ktt::BufferComparator::m_DefaultSampleCount));
+        REQUIRE(std::is_sorted(indices.cbegin(), indices.cend()));
+        REQUIRE(indices.front() == 0);
+        REQUIRE(indices.back() == range - 1);
+        REQUIRE(indices.size() < range / 10);
+
+        REQUIRE(ktt::BufferComparator::GenerateSampleIndices(100, ktt::BufferComparator::m_DefaultSampleCount).size() == 100);
+    }
+
+    SECTION("Sample size follows the requested sample count")
+    {
+        const auto smallSample = ktt::BufferComparator::GenerateSampleIndices(range, 16);
+        REQUIRE(smallSample.size() < indices.size());
+        REQUIRE(smallSample.size() <= 16 + 2 * 64);
+        REQUIRE(smallSample.front() == 0);
+        REQUIRE(smallSample.back() == range - 1);
+
+        const auto largeSample = ktt::BufferComparator::GenerateSampleIndices(range, 10000);
+        REQUIRE(largeSample.size() > indices.size());
+    }
+
+    SECTION("Mismatches are reported at their buffer positions")
+    {
+        const std::vector<double> reference(range, 1.0);
+        std::vector<double> result = reference;
+        result[range - 1] = 2.0;
+
+        const auto summary = comparator.CompareSample(result.data(), reference.data(), indices, 0.5);
+        REQUIRE_FALSE(summary.m_Valid);
+        REQUIRE(summary.m_MismatchIndex == range - 1);
+        REQUIRE(summary.m_WorstIndex == range - 1);
+        REQUIRE(summary.m_ComparedCount == indices.size());
+    }
+}
+
+TEST_CASE("Comparison of block checksums", "BufferComparator")
+{
+    const ktt::BufferComparator comparator;
+    const size_t blockSize = ktt::BufferComparator::m_ChecksumBlockSize;
+    const size_t range = 10 * blockSize + 100;
+    std::vector<float> reference(range);
+
+    for (size_t i = 0; i < range; ++i)
+    {
+        reference[i] = static_cast<float>(i % 7) - 3.0f;
+    }
+
+    std::vector<float> result = reference;
+    const auto referenceChecksums = comparator.ComputeChecksums(reference.data(), range);
+
+    SECTION("Checksums are computed for every block including the partial last one")
+    {
+        REQUIRE(referenceChecksums.size() == 11);
+        REQUIRE(referenceChecksums[0].m_ElementCount == blockSize);
+        REQUIRE(referenceChecksums[10].m_ElementCount == 100);
+        REQUIRE(referenceChecksums[10].m_IntegerSum == 0);
+
+        const auto typeErased = comparator.ComputeChecksums(static_cast<const void*>(reference.data()),
+            ktt::ArgumentDataType::Float, range);
+        REQUIRE(ktt::BufferComparator::MatchChecksums(typeErased, referenceChecksums, 0.0));
+    }
+
+    SECTION("Differences within tolerance are accepted")
+    {
+        result[5] += 0.001f;
+        result[blockSize + 5] -= 0.001f;
+        REQUIRE(ktt::BufferComparator::MatchChecksums(comparator.ComputeChecksums(result.data(), range), referenceChecksums,
+            0.01));
+    }
+
+    SECTION("A single wrong element is detected")
+    {
+        result[3 * blockSize + 17] += 100.0f;
+        REQUIRE_FALSE(ktt::BufferComparator::MatchChecksums(comparator.ComputeChecksums(result.data(), range),
+            referenceChecksums, 0.01));
+    }
+
+    SECTION("Swapped integer elements are detected")
+    {
+        std::vector<int32_t> integers(range);
+
+        for (size_t i = 0; i < range; ++i)
+        {
+            integers[i] = static_cast<int32_t>(i);
+        }
+
+        const auto integerChecksums = comparator.ComputeChecksums(integers.data(), range);
+        std::swap(integers[10], integers[20]);
+        REQUIRE_FALSE(ktt::BufferComparator::MatchChecksums(comparator.ComputeChecksums(integers.data(), range),
+            integerChecksums, 0.0));
+    }
+}
@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <catch.hpp>
+
+#include <Api/KttException.h>
+#include <TuningRunner/ProfileBased/DecisionTreeModel.h>
+
+const std::string modelFile = "DecisionTreeModelTest.json";
+
+void SaveModel(const std::string& trees)
+{
+    std::ofstream output(modelFile);
+    output << R"({"ComputeCapability": 7.5, "TuningParameters": ["A", "B"], "ProfilingCounters": ["c0", "c1"], "Trees": [)"
+        << trees << "]}";
+}
+
+// Root splits on the second parameter, leaves hold values of both counters
+const std::string splitTree = R"({"LeftChildren": [1, -1, -1], "RightChildren": [2, -1, -1], "Features": [1, -2, -2],
+    "Thresholds": [1.5, -2.0, -2.0], "Values": [[0.0, 0.0], [1.0, 10.0], [3.0, 30.0]]})";
+const std::string leafTree = R"({"LeftChildren": [-1], "RightChildren": [-1], "Features": [-2], "Thresholds": [-2.0],
+    "Values": [[5.0, 50.0]]})";
+
+TEST_CASE("Decision tree model loading and prediction", "DecisionTreeModel")
+{
+    SECTION("Model metadata is loaded and single tree is evaluated")
+    {
+        SaveModel(splitTree);
+        const ktt::DecisionTreeModel model(modelFile);
+
+        REQUIRE(model.GetComputeCapability() == 7.5);
+        REQUIRE(model.GetParameterNames() == std::vector<std::string>{"A", "B"});
+        REQUIRE(model.GetCounterNames() == std::vector<std::string>{"c0", "c1"});
+        REQUIRE(model.Predict({8.0, 1.0}) == std::vector<double>{1.0, 10.0});
+        REQUIRE(model.Predict({0.0, 2.0}) == std::vector<double>{3.0, 30.0});
+    }
+
+    SECTION("Prediction of ensemble is the average of its trees")
+    {
+        SaveModel(splitTree + ", " + leafTree);
+        const ktt::DecisionTreeModel model(modelFile);
+
+        REQUIRE(model.Predict({0.0, 1.0}) == std::vector<double>{3.0, 30.0});
+        REQUIRE(model.Predict({0.0, 4.0}) == std::vector<double>{4.0, 40.0});
+    }
+
+    SECTION("Invalid models are rejected")
+    {
+        SaveModel("");
+        REQUIRE_THROWS_AS(ktt::DecisionTreeModel(modelFile), ktt::KttException);
+
+        SaveModel(R"({"LeftChildren": [0, -1], "RightChildren": [1, -1], "Features": [0, -2], "Thresholds": [0.5, -2.0],
+            "Values": [[0.0, 0.0], [1.0, 1.0]]})");
+        REQUIRE_THROWS_AS(ktt::DecisionTreeModel(modelFile), ktt::KttException);
+
+        SaveModel(R"({"LeftChildren": [-1], "RightChildren": [-1], "Features": [-2], "Thresholds": [-2.0], "Values": [[1.0]]})");
+        REQUIRE_THROWS_AS(ktt::DecisionTreeModel(modelFile), ktt::KttException);
+
+        REQUIRE_THROWS_AS(ktt::DecisionTreeModel("MissingModel.json"), ktt::KttException);
+    }
+
+    std::remove(modelFile.c_str());
+}
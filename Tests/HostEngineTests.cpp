@@ -0,0 +1,156 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+
+#include <ComputeEngine/Host/HostEngine.h>
+#include <KernelArgument/KernelArgument.h>
+#include <Utility/NumericalUtilities.h>
+#include <Ktt.h>
+
+TEST_CASE("Working with host buffer", "HostEngine")
+{
+    ktt::HostEngine engine(0, 0, 1);
+    std::vector<float> data;
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        data.push_back(static_cast<float>(i));
+    }
+
+    ktt::KernelArgument argument("0", sizeof(float), ktt::ArgumentDataType::Float, ktt::ArgumentMemoryLocation::Device,
+        ktt::ArgumentAccessType::ReadWrite, ktt::ArgumentMemoryType::Vector, ktt::ArgumentManagementType::Framework);
+    argument.SetOwnedData(data.data(), data.size() * sizeof(float));
+
+    SECTION("Transfering argument to / from device")
+    {
+        const auto uploadAction = engine.UploadArgument(argument, engine.GetDefaultQueue());
+        engine.WaitForTransferAction(uploadAction);
+
+        std::vector<float> result(64);
+        const auto downloadAction = engine.DownloadArgument(argument.GetId(), engine.GetDefaultQueue(), result.data(),
+            result.size() * sizeof(float));
+        engine.WaitForTransferAction(downloadAction);
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            REQUIRE(ktt::FloatEquals(result[i], data[i], 0.001f));
+        }
+    }
+
+    SECTION("Updating buffer does not modify argument data")
+    {
+        const auto uploadAction = engine.UploadArgument(argument, engine.GetDefaultQueue());
+        engine.WaitForTransferAction(uploadAction);
+
+        std::vector<float> update(64, 1.0f);
+        const auto updateAction = engine.UpdateArgument(argument.GetId(), engine.GetDefaultQueue(), update.data(),
+            update.size() * sizeof(float));
+        engine.WaitForTransferAction(updateAction);
+
+        std::vector<float> result(64);
+        const auto downloadAction = engine.DownloadArgument(argument.GetId(), engine.GetDefaultQueue(), result.data(), 0);
+        engine.WaitForTransferAction(downloadAction);
+
+        const auto* argumentData = argument.GetDataWithType<float>();
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            REQUIRE(ktt::FloatEquals(result[i], 1.0f, 0.001f));
+            REQUIRE(ktt::FloatEquals(argumentData[i], data[i], 0.001f));
+        }
+    }
+}
+
+TEST_CASE("Tuning host kernel", "HostEngine")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+
+    const size_t size = 256;
+    std::vector<float> input(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        input[i] = static_cast<float>(i);
+    }
+
+    const ktt::ArgumentId inputId = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::ReadOnly);
+    const ktt::ArgumentId outputId = tuner.AddArgumentVector(std::vector<float>(size, 0.0f), ktt::ArgumentAccessType::WriteOnly);
+
+    // Configurations with block size 8 skip the last element of each block, so that they fail validation
+    const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("scale",
+        [size](const ktt::KernelConfiguration& configuration, const std::vector<void*>& arguments)
+    {
+        const auto* source = static_cast<const float*>(arguments[0]);
+        auto* destination = static_cast<float*>(arguments[1]);
+        const size_t block = configuration.GetPairs()[0].GetValueUint();
+        const size_t unroll = configuration.GetPairs()[1].GetValueUint();
+        const size_t computed = block == 8 ? block - 1 : block;
+
+        for (size_t i = 0; i < size; i += block * unroll)
+        {
+            for (size_t j = 0; j < unroll; ++j)
+            {
+                for (size_t k = 0; k < computed; ++k)
+                {
+                    const size_t index = i + j * block + k;
+                    destination[index] = 2.0f * source[index];
+                }
+            }
+        }
+    });
+
+    tuner.SetArguments(definition, {inputId, outputId});
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("Scale", definition);
+    tuner.AddParameter(kernel, "BLOCK", std::vector<uint64_t>{1, 2, 4, 8});
+    tuner.AddParameter(kernel, "UNROLL", std::vector<uint64_t>{1, 2});
+    tuner.AddConstraint(kernel, {"BLOCK", "UNROLL"}, [](const std::vector<uint64_t>& values)
+    {
+        return values[0] * values[1] <= 8;
+    });
+
+    tuner.SetSearcher(kernel, std::make_unique<ktt::RandomSearcher>());
+    tuner.SetValidationMethod(ktt::ValidationMethod::SideBySideComparison, 0.001);
+    tuner.SetReferenceComputation(outputId, [&input](void* buffer)
+    {
+        auto* reference = static_cast<float*>(buffer);
+
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            reference[i] = 2.0f * input[i];
+        }
+    });
+
+    const auto results = tuner.Tune(kernel);
+    REQUIRE(results.size() == 7);
+
+    for (const auto& result : results)
+    {
+        const uint64_t block = result.GetConfiguration().GetPairs()[0].GetValueUint();
+        REQUIRE(result.GetStatus() == (block == 8 ? ktt::ResultStatus::ValidationFailed : ktt::ResultStatus::Ok));
+
+        if (result.IsValid())
+        {
+            REQUIRE(result.GetTotalDuration() > 0);
+        }
+    }
+
+    const auto best = tuner.GetBestConfiguration(kernel);
+    REQUIRE(best.GetPairs()[0].GetValueUint() != 8);
+
+    const std::string resultsFile = "HostEngineTuningResults";
+    tuner.SaveResults(results, resultsFile, ktt::OutputFormat::JSON);
+    const auto loadedResults = tuner.LoadResults(resultsFile, ktt::OutputFormat::JSON);
+    std::remove((resultsFile + ".json").c_str());
+
+    REQUIRE(loadedResults.size() == results.size());
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        REQUIRE(loadedResults[i].GetConfiguration() == results[i].GetConfiguration());
+        REQUIRE(loadedResults[i].GetStatus() == results[i].GetStatus());
+        // Durations are saved in the tuner time unit, so they may be rounded
+        REQUIRE(static_cast<double>(loadedResults[i].GetTotalDuration()) == Approx(results[i].GetTotalDuration()).margin(1.0));
+    }
+}
@@ -0,0 +1,50 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+
+#include <ComputeEngine/KernelBinaryCache.h>
+
+const std::string cacheDirectory = "KernelBinaryCacheTest";
+
+TEST_CASE("Kernel binary cache eviction", "KernelBinaryCache")
+{
+    std::filesystem::remove_all(cacheDirectory);
+    const std::vector<uint8_t> binary(100, 1);
+    std::vector<uint8_t> loaded;
+
+    SECTION("Least recently used binaries are evicted once the limit is exceeded")
+    {
+        ktt::KernelBinaryCache cache;
+        cache.SetDirectory(cacheDirectory);
+        cache.SetMaximumSize(250);
+
+        cache.Store("a", binary);
+        cache.Store("b", binary);
+        REQUIRE(cache.Load("a", loaded));
+        REQUIRE(loaded == binary);
+
+        cache.Store("c", binary);
+        REQUIRE(cache.Exists("a"));
+        REQUIRE_FALSE(cache.Exists("b"));
+        REQUIRE(cache.Exists("c"));
+    }
+
+    SECTION("Existing binaries are indexed when the directory is set")
+    {
+        ktt::KernelBinaryCache cache;
+        cache.SetDirectory(cacheDirectory);
+        cache.Store("a", binary);
+        cache.Store("b", binary);
+
+        ktt::KernelBinaryCache other;
+        other.SetDirectory(cacheDirectory);
+        REQUIRE(other.Load("b", loaded));
+
+        other.SetMaximumSize(150);
+        REQUIRE_FALSE(other.Exists("a"));
+        REQUIRE(other.Exists("b"));
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
@@ -0,0 +1,96 @@
+#include <string>
+#include <catch.hpp>
+
+#include <Utility/LruCache.h>
+
+TEST_CASE("Least recently used cache policies", "LruCache")
+{
+    SECTION("Least recently used item is evicted first")
+    {
+        ktt::LruCache<std::string, int> cache(2);
+        cache.Put("a", 1);
+        cache.Put("b", 2);
+        REQUIRE(cache.Get("a")->second == 1);
+
+        cache.Put("c", 3);
+        REQUIRE(cache.Size() == 2);
+        REQUIRE(cache.Exists("a"));
+        REQUIRE_FALSE(cache.Exists("b"));
+        REQUIRE(cache.Exists("c"));
+        REQUIRE(cache.GetEvictionCount() == 1);
+    }
+
+    SECTION("Items accessed repeatedly are promoted and survive a scan of items used once")
+    {
+        ktt::LruCache<std::string, int> cache(5);
+        cache.SetSegmented(true);
+        cache.Put("a", 1);
+        cache.Put("b", 2);
+        REQUIRE(cache.Get("a") != cache.End());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            cache.Put("scan" + std::to_string(i), i);
+        }
+
+        REQUIRE(cache.Size() == 5);
+        REQUIRE(cache.Exists("a"));
+        REQUIRE_FALSE(cache.Exists("b"));
+        REQUIRE_FALSE(cache.Exists("scan5"));
+        REQUIRE(cache.Exists("scan6"));
+        REQUIRE(cache.Exists("scan9"));
+        REQUIRE(cache.Get("a")->second == 1);
+    }
+
+    SECTION("Plain policy evicts items regardless of previous accesses")
+    {
+        ktt::LruCache<std::string, int> cache(5);
+        cache.Put("a", 1);
+        REQUIRE(cache.Get("a") != cache.End());
+
+        for (int i = 0; i < 5; ++i)
+        {
+            cache.Put("scan" + std::to_string(i), i);
+        }
+
+        REQUIRE_FALSE(cache.Exists("a"));
+    }
+
+    SECTION("Items are evicted when memory limit is exceeded")
+    {
+        ktt::LruCache<std::string, int> cache(10);
+        cache.SetMemoryLimit(100);
+        cache.Put("a", 1, 60);
+        cache.Put("b", 2, 30);
+        REQUIRE(cache.GetMemorySize() == 90);
+
+        cache.Put("c", 3, 30);
+        REQUIRE_FALSE(cache.Exists("a"));
+        REQUIRE(cache.GetMemorySize() == 60);
+
+        cache.Put("d", 4, 200);
+        REQUIRE(cache.Size() == 1);
+        REQUIRE(cache.Exists("d"));
+        REQUIRE(cache.GetMemorySize() == 200);
+
+        cache.Put("d", 5, 50);
+        cache.Put("e", 6, 40);
+        cache.SetMemoryLimit(60);
+        REQUIRE_FALSE(cache.Exists("d"));
+        REQUIRE(cache.GetMemorySize() == 40);
+        REQUIRE(cache.GetEvictionCount() == 4);
+    }
+
+    SECTION("Hits and misses are counted")
+    {
+        ktt::LruCache<std::string, int> cache(2);
+        cache.Put("a", 1);
+        REQUIRE(cache.Get("a") != cache.End());
+        REQUIRE(cache.Get("a") != cache.End());
+        REQUIRE(cache.Get("b") == cache.End());
+
+        REQUIRE(cache.GetHitCount() == 2);
+        REQUIRE(cache.GetMissCount() == 1);
+        REQUIRE(cache.GetEvictionCount() == 0);
+    }
+}
@@ -0,0 +1,41 @@
+#include <catch.hpp>
+
+#include <KernelRunner/MeasurementPolicy.h>
+
+TEST_CASE("Adaptive measurement statistics", "MeasurementPolicy")
+{
+    SECTION("Statistics of measured durations are computed correctly")
+    {
+        const auto single = ktt::MeasurementPolicy::ComputeStatistics({100});
+        REQUIRE(single.m_RunCount == 1);
+        REQUIRE(single.m_Median == 100);
+        REQUIRE(single.m_StandardDeviation == 0.0);
+
+        const auto statistics = ktt::MeasurementPolicy::ComputeStatistics({130, 100, 110, 120, 90, 100, 105, 95, 115, 125});
+        REQUIRE(statistics.m_RunCount == 10);
+        REQUIRE(statistics.m_Minimum == 90);
+        REQUIRE(statistics.m_Median == 107);
+        REQUIRE(statistics.m_ConfidenceIntervalLower <= statistics.m_Median);
+        REQUIRE(statistics.m_ConfidenceIntervalUpper >= statistics.m_Median);
+        REQUIRE(statistics.m_ConfidenceIntervalLower >= 90);
+        REQUIRE(statistics.m_ConfidenceIntervalUpper <= 130);
+    }
+
+    SECTION("Single run does not finish adaptive measurement")
+    {
+        ktt::MeasurementPolicy policy;
+        policy.SetRepetitions(0, 1, 10, 0.05);
+
+        REQUIRE_FALSE(policy.IsMeasurementFinished({}));
+        REQUIRE_FALSE(policy.IsMeasurementFinished({100}));
+        REQUIRE(policy.IsMeasurementFinished({100, 100, 100, 100, 100, 100}));
+        REQUIRE_FALSE(policy.IsMeasurementFinished({100, 200, 50, 150, 120, 80}));
+        REQUIRE(policy.IsMeasurementFinished({100, 200, 50, 150, 120, 80, 90, 110, 130, 70}));
+    }
+
+    SECTION("Single run finishes measurement without repetitions")
+    {
+        ktt::MeasurementPolicy policy;
+        REQUIRE(policy.IsMeasurementFinished({100}));
+    }
+}
@@ -1,8 +1,23 @@
+#include <filesystem>
+#include <iterator>
+#include <limits>
 #include <catch.hpp>
 
 #include <ComputeEngine/OpenCl/OpenClEngine.h>
+#include <ComputeEngine/OpenCl/OpenClPlatform.h>
 #include <KernelArgument/KernelArgument.h>
+#include <KernelRunner/BufferComparator.h>
+#include <TunerCore.h>
 #include <Utility/NumericalUtilities.h>
+#include <Ktt.h>
+
+#if defined(_MSC_VER)
+const std::string openClKernelPrefix = "";
+#else
+const std::string openClKernelPrefix = "../";
+#endif
+
+const std::string openClKernelSource = openClKernelPrefix + "../Tests/Kernels/SimpleOpenClKernel.cl";
 
 TEST_CASE("Working with OpenCL buffer", "OpenClEngine")
 {
@@ -34,3 +49,201 @@ TEST_CASE("Working with OpenCL buffer", "OpenClEngine")
         }
     }
 }
+
+TEST_CASE("Computation of block checksums on device", "OpenClEngine")
+{
+    ktt::OpenClEngine engine(0, 0, 1);
+    const size_t blockSize = ktt::BufferComparator::m_ChecksumBlockSize;
+    const size_t size = 3 * blockSize + 10;
+    std::vector<float> data;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        data.push_back(static_cast<float>(i % 13) - 6.5f);
+    }
+
+    ktt::KernelArgument argument("checksumData", sizeof(float), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadWrite, ktt::ArgumentMemoryType::Vector,
+        ktt::ArgumentManagementType::Framework);
+    argument.SetOwnedData(data.data(), data.size() * sizeof(float));
+    engine.WaitForTransferAction(engine.UploadArgument(argument, engine.GetDefaultQueue()));
+
+    std::vector<ktt::BlockChecksum> checksums;
+    const bool computed = engine.ComputeBlockChecksums(argument.GetId(), argument.GetDataType(), size, blockSize,
+        engine.GetDefaultQueue(), checksums);
+
+    if (engine.GetCurrentDeviceInfo().GetExtensions().find("cl_khr_fp64") == std::string::npos)
+    {
+        REQUIRE_FALSE(computed);
+        return;
+    }
+
+    REQUIRE(computed);
+
+    const ktt::BufferComparator comparator;
+    const auto hostChecksums = comparator.ComputeChecksums(data.data(), size);
+    REQUIRE(checksums.size() == 4);
+    REQUIRE(checksums[3].m_ElementCount == 10);
+    REQUIRE(ktt::BufferComparator::MatchChecksums(checksums, hostChecksums, 0.0));
+
+    // Integer buffers are left to the host fallback
+    REQUIRE_FALSE(engine.ComputeBlockChecksums(argument.GetId(), ktt::ArgumentDataType::Int, size, blockSize,
+        engine.GetDefaultQueue(), checksums));
+}
+
+TEST_CASE("Pipelined compilation of upcoming configurations", "OpenClEngine")
+{
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::OpenCL);
+    tuner.SetCompilationLookahead(2);
+
+    const size_t size = 1024;
+    std::vector<float> a(size, 1.0f);
+    std::vector<float> b(size, 2.0f);
+    std::vector<float> result(size, 0.0f);
+
+    const ktt::KernelDefinitionId definition = tuner.AddKernelDefinitionFromFile("simpleKernel", openClKernelSource,
+        ktt::DimensionVector(size), ktt::DimensionVector(64));
+    const ktt::ArgumentId numberId = tuner.AddArgumentScalar(3.0f);
+    const ktt::ArgumentId aId = tuner.AddArgumentVector(a, ktt::ArgumentAccessType::ReadOnly);
+    const ktt::ArgumentId bId = tuner.AddArgumentVector(b, ktt::ArgumentAccessType::ReadOnly);
+    const ktt::ArgumentId resultId = tuner.AddArgumentVector(result, ktt::ArgumentAccessType::WriteOnly);
+    tuner.SetArguments(definition, {numberId, aId, bId, resultId});
+
+    // Each value produces different source, so every configuration is compiled separately
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("simple", definition);
+    tuner.AddParameter(kernel, "UNUSED", std::vector<uint64_t>{1, 2, 3, 4});
+    tuner.SetSearcher(kernel, std::make_unique<ktt::DeterministicSearcher>());
+
+    const auto results = tuner.Tune(kernel);
+    REQUIRE(results.size() == 4);
+
+    // Kernels compiled in background are inserted into the cache instead of being compiled again on launch
+    const auto tuningStatistics = tuner.GetKernelCacheStatistics();
+    REQUIRE(tuningStatistics.m_MissCount == 4);
+    REQUIRE(tuningStatistics.m_EntryCount == 4);
+
+    for (const auto& tuningResult : results)
+    {
+        REQUIRE(tuningResult.IsValid());
+        tuner.Run(kernel, tuningResult.GetConfiguration(), {});
+    }
+
+    const auto statistics = tuner.GetKernelCacheStatistics();
+    REQUIRE(statistics.m_MissCount == 4);
+    REQUIRE(statistics.m_HitCount >= 4);
+}
+
+TEST_CASE("Precompilation of kernel configurations", "OpenClEngine")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+
+    // Tuner API only logs the errors, so the exceptions are checked on the tuner core
+    ktt::TunerCore tuner(0, 0, ktt::ComputeApi::OpenCL, 1);
+
+    // Both definitions share the same source, so each configuration produces only one program
+    const ktt::KernelDefinitionId definition = tuner.AddKernelDefinitionFromFile("simpleKernel", openClKernelSource,
+        ktt::DimensionVector(1024), ktt::DimensionVector(64));
+    const ktt::KernelDefinitionId copy = tuner.AddKernelDefinitionFromFile("simpleKernelCopy", openClKernelSource,
+        ktt::DimensionVector(1024), ktt::DimensionVector(64));
+    const ktt::KernelId kernel = tuner.CreateKernel("composite", {definition, copy}, nullptr);
+    tuner.AddParameter(kernel, "UNUSED", std::vector<ktt::ParameterValue>{static_cast<uint64_t>(1), static_cast<uint64_t>(2),
+        static_cast<uint64_t>(3)}, "");
+    const uint64_t end = std::numeric_limits<uint64_t>::max();
+
+    SECTION("Precompilation requires kernel binary cache")
+    {
+        REQUIRE_THROWS_AS(tuner.Precompile(kernel, 0, end), ktt::KttException);
+    }
+
+    SECTION("Identical sources are compiled only once")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "KttPrecompilationTest";
+        std::filesystem::remove_all(directory);
+        tuner.SetKernelBinaryCache(directory.string(), 0);
+
+        const auto countBinaries = [&directory]()
+        {
+            return std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator());
+        };
+
+        tuner.Precompile(kernel, 0, 2);
+        REQUIRE(countBinaries() == 2);
+
+        // Binaries which are already cached are skipped
+        tuner.Precompile(kernel, 0, end);
+        REQUIRE(countBinaries() == 3);
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+TEST_CASE("Tuning on OpenCL sub-devices", "OpenClEngine")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    const auto device = ktt::OpenClPlatform::GetAllPlatforms()[0].GetDevices()[0];
+
+    cl_uint maxSubDevices = 0;
+    clGetDeviceInfo(device.GetId(), CL_DEVICE_PARTITION_MAX_SUB_DEVICES, sizeof(maxSubDevices), &maxSubDevices, nullptr);
+
+    if (maxSubDevices < 2 || device.GetInfo().GetMaxComputeUnits() < 2)
+    {
+        WARN("Device cannot be partitioned into sub-devices, the test is skipped");
+        return;
+    }
+
+    SECTION("Sub-device engines split compute units and hold independent buffers")
+    {
+        const auto engines = ktt::OpenClEngine::CreateSubDeviceEngines(0, 0, 2, 1);
+        REQUIRE(engines.size() == 2);
+
+        std::vector<float> data(64, 1.0f);
+        ktt::KernelArgument argument("subDeviceData", sizeof(float), ktt::ArgumentDataType::Float,
+            ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentMemoryType::Vector,
+            ktt::ArgumentManagementType::Framework);
+        argument.SetOwnedData(data.data(), data.size() * sizeof(float));
+
+        for (const auto& engine : engines)
+        {
+            REQUIRE(engine->GetCurrentDeviceInfo().GetMaxComputeUnits() == device.GetInfo().GetMaxComputeUnits() / 2);
+            engine->WaitForTransferAction(engine->UploadArgument(argument, engine->GetDefaultQueue()));
+        }
+
+        engines[0]->ClearBuffer(argument.GetId());
+        REQUIRE_FALSE(engines[0]->HasBuffer(argument.GetId()));
+        REQUIRE(engines[1]->HasBuffer(argument.GetId()));
+    }
+
+    SECTION("Statistics are summed over sub-device engines")
+    {
+        ktt::Tuner tuner(0, std::vector<ktt::DeviceIndex>{0}, ktt::ComputeApi::OpenCL, 2);
+
+        const size_t size = 1024;
+        std::vector<float> a(size, 1.0f);
+        std::vector<float> b(size, 2.0f);
+        std::vector<float> result(size, 0.0f);
+
+        const ktt::KernelDefinitionId definition = tuner.AddKernelDefinitionFromFile("simpleKernel", openClKernelSource,
+            ktt::DimensionVector(size), ktt::DimensionVector(64));
+        const ktt::ArgumentId numberId = tuner.AddArgumentScalar(3.0f);
+        const ktt::ArgumentId aId = tuner.AddArgumentVector(a, ktt::ArgumentAccessType::ReadOnly);
+        const ktt::ArgumentId bId = tuner.AddArgumentVector(b, ktt::ArgumentAccessType::ReadOnly);
+        const ktt::ArgumentId resultId = tuner.AddArgumentVector(result, ktt::ArgumentAccessType::WriteOnly);
+        tuner.SetArguments(definition, {numberId, aId, bId, resultId});
+
+        const ktt::KernelId kernel = tuner.CreateSimpleKernel("simple", definition);
+        tuner.AddParameter(kernel, "UNUSED", std::vector<uint64_t>{1, 2, 3, 4});
+        tuner.SetSearcher(kernel, std::make_unique<ktt::DeterministicSearcher>());
+
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(results.size() == 4);
+
+        for (const auto& tuningResult : results)
+        {
+            REQUIRE(tuningResult.IsValid());
+        }
+
+        // Tuning runs only on the sub-devices, the whole device engine alone would report no compilations and transfers
+        REQUIRE(tuner.GetKernelCacheStatistics().m_MissCount >= 4);
+        REQUIRE(tuner.GetTransferStatistics().m_UploadCount >= 4);
+    }
+}
@@ -0,0 +1,91 @@
+#include <catch.hpp>
+
+#include <TuningRunner/OutlierDetector.h>
+
+TEST_CASE("Detection of sentinel measurement outliers", "OutlierDetector")
+{
+    ktt::OutlierDetector detector;
+    REQUIRE_FALSE(detector.HasSentinel());
+
+    const ktt::KernelConfiguration sentinel({ktt::ParameterPair("A", static_cast<uint64_t>(1))});
+
+    SECTION("Typical duration is the median of sentinel durations")
+    {
+        detector.SetSentinel(sentinel, 100);
+        REQUIRE(detector.HasSentinel());
+        REQUIRE(detector.GetSentinel() == sentinel);
+        REQUIRE(detector.GetTypicalDuration() == 100);
+
+        detector.AddSentinelDuration(200);
+        REQUIRE(detector.GetTypicalDuration() == 150);
+
+        detector.AddSentinelDuration(120);
+        REQUIRE(detector.GetTypicalDuration() == 120);
+    }
+
+    SECTION("Only the most recent durations are kept")
+    {
+        detector.SetSentinel(sentinel, 1000);
+
+        for (int i = 0; i < 15; ++i)
+        {
+            detector.AddSentinelDuration(1000);
+        }
+
+        for (int i = 0; i < 9; ++i)
+        {
+            detector.AddSentinelDuration(100);
+        }
+
+        REQUIRE(detector.GetTypicalDuration() == 100);
+
+        detector.SetSentinel(sentinel, 500);
+        REQUIRE(detector.GetTypicalDuration() == 500);
+    }
+
+    SECTION("Outliers are detected according to median absolute deviation")
+    {
+        // Median is 100 and median absolute deviation is 10, so the allowed deviation is 3.5 * 1.4826 * 10
+        detector.SetSentinel(sentinel, 100);
+
+        for (const ktt::Nanoseconds duration : {120, 80, 110, 90})
+        {
+            detector.AddSentinelDuration(duration);
+        }
+
+        REQUIRE_FALSE(detector.IsOutlier(100));
+        REQUIRE_FALSE(detector.IsOutlier(151));
+        REQUIRE_FALSE(detector.IsOutlier(49));
+        REQUIRE(detector.IsOutlier(152));
+        REQUIRE(detector.IsOutlier(48));
+    }
+
+    SECTION("Deviation relative to typical duration is always tolerated")
+    {
+        detector.SetSentinel(sentinel, 100);
+        detector.AddSentinelDuration(100);
+        detector.AddSentinelDuration(100);
+
+        REQUIRE_FALSE(detector.IsOutlier(110));
+        REQUIRE_FALSE(detector.IsOutlier(90));
+        REQUIRE(detector.IsOutlier(111));
+        REQUIRE(detector.IsOutlier(89));
+    }
+
+    SECTION("Drift factor scales durations to the typical duration")
+    {
+        detector.SetSentinel(sentinel, 100);
+
+        REQUIRE(detector.GetDriftFactor(125) == Approx(0.8));
+        REQUIRE(detector.GetDriftFactor(50) == Approx(2.0));
+        REQUIRE(detector.GetDriftFactor(0) == 1.0);
+    }
+
+    SECTION("Consistent measurements differ by at most a tenth of the longer one")
+    {
+        REQUIRE(ktt::OutlierDetector::AreConsistent(100, 109));
+        REQUIRE(ktt::OutlierDetector::AreConsistent(110, 100));
+        REQUIRE_FALSE(ktt::OutlierDetector::AreConsistent(100, 112));
+        REQUIRE_FALSE(ktt::OutlierDetector::AreConsistent(112, 100));
+    }
+}
@@ -0,0 +1,31 @@
+#include <catch.hpp>
+
+#include <TuningRunner/ParetoFront.h>
+
+TEST_CASE("Pareto front maintenance", "ParetoFront")
+{
+    ktt::ParetoFront front;
+    const ktt::KernelResult result;
+
+    SECTION("Dominance requires strict improvement in at least one objective")
+    {
+        REQUIRE(ktt::ParetoFront::Dominates({1.0, 2.0}, {1.0, 3.0}));
+        REQUIRE_FALSE(ktt::ParetoFront::Dominates({1.0, 2.0}, {1.0, 2.0}));
+        REQUIRE_FALSE(ktt::ParetoFront::Dominates({1.0, 4.0}, {2.0, 3.0}));
+    }
+
+    SECTION("Non-dominated points are kept and dominated ones are removed")
+    {
+        REQUIRE(front.Insert(result, {3.0, 1.0}));
+        REQUIRE(front.Insert(result, {1.0, 3.0}));
+        REQUIRE(front.GetSize() == 2);
+
+        REQUIRE_FALSE(front.Insert(result, {4.0, 2.0}));
+        REQUIRE_FALSE(front.Insert(result, {1.0, 3.0}));
+        REQUIRE(front.GetSize() == 2);
+
+        REQUIRE(front.Insert(result, {1.0, 1.0}));
+        REQUIRE(front.GetSize() == 1);
+        REQUIRE(front.GetEntries()[0].second == std::vector<double>{1.0, 1.0});
+    }
+}
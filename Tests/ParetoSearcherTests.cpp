@@ -0,0 +1,75 @@
+#include <set>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+
+#include <Api/Searcher/ParetoSearcher.h>
+#include <Kernel/KernelManager.h>
+#include <TuningRunner/ConfigurationData.h>
+#include <Utility/Logger/Logger.h>
+
+#if defined(_MSC_VER)
+const std::string paretoKernelPrefix = "";
+#else
+const std::string paretoKernelPrefix = "../";
+#endif
+
+// Kernel duration grows and compilation overhead shrinks with parameter A, parameter B makes both objectives worse, so the Pareto
+// front consists exactly of configurations with B equal to zero
+ktt::KernelResult CreateSyntheticResult(const ktt::KernelConfiguration& configuration)
+{
+    const uint64_t a = configuration.GetPairs()[0].GetValueUint();
+    const uint64_t b = configuration.GetPairs()[1].GetValueUint();
+
+    ktt::ComputationResult computation("simpleKernel");
+    computation.SetDurationData((a + 1) * 100 + b, 0, (5 - a) * 100 + b);
+    return ktt::KernelResult("kernel", configuration, {computation});
+}
+
+TEST_CASE("Exploration of two-objective space", "ParetoSearcher")
+{
+    ktt::Logger::GetLogger().SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::KernelArgumentManager argumentManager;
+    ktt::KernelManager manager(argumentManager);
+
+    const ktt::KernelDefinitionId definition = manager.AddKernelDefinitionFromFile("simpleKernel",
+        paretoKernelPrefix + "../Tests/Kernels/SimpleOpenClKernel.cl", ktt::DimensionVector(1024), ktt::DimensionVector(8, 8));
+    const ktt::KernelId kernelId = manager.CreateKernel("kernel", {definition});
+    const std::vector<ktt::ParameterValue> values{static_cast<uint64_t>(0), static_cast<uint64_t>(1), static_cast<uint64_t>(2),
+        static_cast<uint64_t>(3), static_cast<uint64_t>(4)};
+    manager.AddParameter(kernelId, "A", values, "");
+    manager.AddParameter(kernelId, "B", values, "");
+    const auto& kernel = manager.GetKernel(kernelId);
+
+    // Population is smaller than the space, so most configurations are created by selection and recombination
+    ktt::ParetoSearcher searcher(4, 0.2);
+    ktt::ConfigurationData data(searcher, kernel, {ktt::TuningObjective::KernelDuration,
+        ktt::TuningObjective::CompilationOverhead});
+    REQUIRE(data.GetTotalConfigurationsCount() == 25);
+
+    std::set<uint64_t> visited;
+    bool active = true;
+
+    while (active)
+    {
+        const auto configuration = data.GetCurrentConfiguration();
+        const uint64_t index = data.GetIndexForConfiguration(configuration);
+        REQUIRE(visited.insert(index).second);
+        active = data.CalculateNextConfiguration(CreateSyntheticResult(configuration));
+    }
+
+    REQUIRE(data.IsProcessed());
+    REQUIRE(visited.size() == 25);
+
+    const auto front = data.GetParetoFront();
+    REQUIRE(front.size() == 5);
+    std::set<uint64_t> frontValues;
+
+    for (const auto& result : front)
+    {
+        REQUIRE(result.GetConfiguration().GetPairs()[1].GetValueUint() == 0);
+        frontValues.insert(result.GetConfiguration().GetPairs()[0].GetValueUint());
+    }
+
+    REQUIRE(frontValues.size() == 5);
+}
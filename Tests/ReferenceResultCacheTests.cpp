@@ -0,0 +1,80 @@
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+
+#include <KernelArgument/KernelArgument.h>
+#include <KernelRunner/ReferenceResultCache.h>
+
+const std::string referenceDirectory = "ReferenceResultCacheTest";
+
+TEST_CASE("Reference results are stored and mapped from cache", "ReferenceResultCache")
+{
+    std::filesystem::remove_all(referenceDirectory);
+    ktt::ReferenceResultCache cache;
+    const std::vector<float> reference{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    const size_t size = reference.size() * sizeof(float);
+
+    SECTION("Disabled cache does not store results")
+    {
+        REQUIRE_FALSE(cache.IsEnabled());
+        cache.Store("key", reference.data(), size);
+        REQUIRE(cache.Load("key", size) == nullptr);
+    }
+
+    SECTION("Stored result is mapped with the same contents")
+    {
+        cache.SetDirectory(referenceDirectory);
+        cache.SetVersion("1.0");
+        const std::string key = cache.GenerateKey({"kernel", "a", "b"});
+        cache.Store(key, reference.data(), size);
+
+        const auto file = cache.Load(key, size);
+        REQUIRE(file != nullptr);
+        REQUIRE(file->GetSize() == size);
+        REQUIRE(std::memcmp(file->GetData(), reference.data(), size) == 0);
+
+        REQUIRE(cache.Load(key, size + sizeof(float)) == nullptr);
+    }
+
+    SECTION("Results are missed after the version changes")
+    {
+        cache.SetDirectory(referenceDirectory);
+        cache.SetVersion("1.0");
+        const std::string key = cache.GenerateKey({"kernel"});
+        cache.Store(key, reference.data(), size);
+
+        cache.SetVersion("2.0");
+        const std::string newKey = cache.GenerateKey({"kernel"});
+        REQUIRE(newKey != key);
+        REQUIRE(cache.Load(newKey, size) == nullptr);
+    }
+
+    SECTION("Keys depend on order and boundaries of their components")
+    {
+        REQUIRE(cache.GenerateKey({"a", "b"}) == cache.GenerateKey({"a", "b"}));
+        REQUIRE(cache.GenerateKey({"a", "b"}) != cache.GenerateKey({"b", "a"}));
+        REQUIRE(cache.GenerateKey({"ab", "c"}) != cache.GenerateKey({"a", "bc"}));
+        REQUIRE(cache.GenerateKey({"a"}) != cache.GenerateKey({"a", ""}));
+    }
+
+    SECTION("Argument hash depends on argument data and is empty for user buffers")
+    {
+        ktt::KernelArgument argument("a", sizeof(float), ktt::ArgumentDataType::Float, ktt::ArgumentMemoryLocation::Device,
+            ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentMemoryType::Vector, ktt::ArgumentManagementType::Framework);
+        argument.SetOwnedData(reference.data(), size);
+        const std::string hash = ktt::ReferenceResultCache::HashArguments({&argument});
+        REQUIRE_FALSE(hash.empty());
+
+        std::vector<float> changed = reference;
+        changed[2] = 0.0f;
+        argument.SetOwnedData(changed.data(), size);
+        REQUIRE(ktt::ReferenceResultCache::HashArguments({&argument}) != hash);
+
+        argument.SetUserBuffer(size);
+        REQUIRE(ktt::ReferenceResultCache::HashArguments({&argument}).empty());
+    }
+
+    std::filesystem::remove_all(referenceDirectory);
+}
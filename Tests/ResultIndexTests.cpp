@@ -0,0 +1,83 @@
+#include <string>
+#include <vector>
+#include <catch.hpp>
+
+#include <Api/KttException.h>
+#include <TuningRunner/ResultIndex.h>
+
+TEST_CASE("Result lookup by configuration", "ResultIndex")
+{
+    std::vector<ktt::KernelResult> results;
+
+    for (const uint64_t a : {1, 2, 4})
+    {
+        for (const std::string b : {"x", "y"})
+        {
+            const ktt::KernelConfiguration configuration({ktt::ParameterPair("A", a), ktt::ParameterPair("B", b)});
+            results.emplace_back("kernel", configuration);
+        }
+    }
+
+    results.pop_back();
+    const ktt::ResultIndex index(results);
+
+    SECTION("Configurations are matched regardless of parameter order")
+    {
+        REQUIRE(index.GetSize() == 5);
+
+        const ktt::KernelConfiguration configuration({ktt::ParameterPair("B", std::string("y")),
+            ktt::ParameterPair("A", static_cast<uint64_t>(2))});
+        REQUIRE(index.Find(configuration).GetConfiguration() == configuration);
+    }
+
+    SECTION("Missing configurations are reported")
+    {
+        const ktt::KernelConfiguration unknownValue({ktt::ParameterPair("A", static_cast<uint64_t>(8)),
+            ktt::ParameterPair("B", std::string("x"))});
+        REQUIRE_THROWS_WITH(index.Find(unknownValue), Catch::Contains("A 8"));
+
+        const ktt::KernelConfiguration missingCombination({ktt::ParameterPair("A", static_cast<uint64_t>(4)),
+            ktt::ParameterPair("B", std::string("y"))});
+        REQUIRE_THROWS_AS(index.Find(missingCombination), ktt::KttException);
+
+        const ktt::KernelConfiguration missingParameter({ktt::ParameterPair("A", static_cast<uint64_t>(1))});
+        REQUIRE_THROWS_AS(index.Find(missingParameter), ktt::KttException);
+    }
+}
+
+TEST_CASE("Computation lookup by kernel function", "ResultIndex")
+{
+    ktt::ComputationResult first("first");
+    first.SetDurationData(100, 10, 0);
+    ktt::ComputationResult second("second");
+    second.SetDurationData(200, 20, 0);
+
+    const ktt::KernelConfiguration configuration({ktt::ParameterPair("A", 0.1 + 0.2)});
+    const ktt::KernelConfiguration failedConfiguration({ktt::ParameterPair("A", 0.5)});
+    std::vector<ktt::KernelResult> results{ktt::KernelResult("kernel", configuration, {first, second}),
+        ktt::KernelResult("kernel", failedConfiguration, {first})};
+    results.back().SetStatus(ktt::ResultStatus::ComputationFailed);
+    const ktt::ResultIndex index(results);
+
+    SECTION("Floating-point values are matched with the same rule as configuration lookup")
+    {
+        const ktt::KernelConfiguration lookup({ktt::ParameterPair("A", 0.3)});
+        REQUIRE(index.TryFind(lookup) == &results[0]);
+        REQUIRE(index.GetComputationCount() == 2);
+
+        const ktt::ComputationResult* computation = index.TryFind("second", lookup);
+        REQUIRE(computation != nullptr);
+        REQUIRE(computation->GetDuration() == 200);
+        REQUIRE(index.TryFind("third", lookup) == nullptr);
+    }
+
+    SECTION("Computations of failed results are not indexed")
+    {
+        REQUIRE(index.TryFind(failedConfiguration) == &results[1]);
+        REQUIRE(index.TryFind("first", failedConfiguration) == nullptr);
+
+        const ktt::KernelConfiguration unknownValue({ktt::ParameterPair("A", 0.7)});
+        REQUIRE(index.TryFind(unknownValue) == nullptr);
+        REQUIRE(index.TryFind("first", unknownValue) == nullptr);
+    }
+}
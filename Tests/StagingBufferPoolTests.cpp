@@ -0,0 +1,84 @@
+#include <memory>
+#include <vector>
+#include <catch.hpp>
+
+#include <ComputeEngine/StagingBufferPool.h>
+
+struct TestBuffer
+{
+    size_t m_Size;
+};
+
+TEST_CASE("Staging buffers are pooled by size class", "StagingBufferPool")
+{
+    const size_t minimumSize = 1 << 16;
+    size_t allocatedCount = 0;
+
+    ktt::StagingBufferPool<TestBuffer> pool([&allocatedCount](const size_t size)
+    {
+        ++allocatedCount;
+        return std::make_unique<TestBuffer>(TestBuffer{size});
+    });
+
+    SECTION("Disabled pool does not allocate buffers")
+    {
+        REQUIRE_FALSE(pool.IsEnabled());
+        REQUIRE_FALSE(pool.Acquire(100).IsValid());
+        REQUIRE(allocatedCount == 0);
+    }
+
+    SECTION("Sizes are rounded up to power of two classes and large transfers use chunks")
+    {
+        pool.SetMemoryLimit(64 << 20);
+        REQUIRE(pool.Acquire(100).GetSize() == minimumSize);
+        REQUIRE(pool.Acquire(minimumSize + 1).GetBuffer().m_Size == 2 * minimumSize);
+        REQUIRE(pool.Acquire(100 << 20).GetSize() == pool.GetChunkSize());
+    }
+
+    SECTION("Released buffers are reused within their size class")
+    {
+        pool.SetMemoryLimit(64 << 20);
+        pool.Acquire(1000);
+        pool.Acquire(2000);
+        REQUIRE(allocatedCount == 1);
+        REQUIRE(pool.GetReuseCount() == 1);
+
+        {
+            const auto first = pool.Acquire(1000);
+            const auto second = pool.Acquire(1000);
+            REQUIRE(allocatedCount == 2);
+        }
+
+        pool.Acquire(3 * minimumSize);
+        REQUIRE(pool.GetAllocationCount() == 3);
+        REQUIRE(pool.GetMemorySize() == 6 * minimumSize);
+    }
+
+    SECTION("Memory limit is enforced and free buffers are released only when needed")
+    {
+        pool.SetMemoryLimit(4 * minimumSize);
+
+        {
+            const auto first = pool.Acquire(minimumSize);
+            const auto second = pool.Acquire(minimumSize);
+            const auto third = pool.Acquire(2 * minimumSize);
+            REQUIRE(pool.GetMemorySize() == 4 * minimumSize);
+            REQUIRE_FALSE(pool.Acquire(minimumSize).IsValid());
+        }
+
+        pool.SetMemoryLimit(8 * minimumSize);
+        REQUIRE(pool.GetMemorySize() == 4 * minimumSize);
+
+        pool.SetMemoryLimit(3 * minimumSize);
+        REQUIRE(pool.GetMemorySize() == 2 * minimumSize);
+        REQUIRE(pool.Acquire(minimumSize).IsValid());
+        REQUIRE(pool.GetReuseCount() == 1);
+
+        const auto large = pool.Acquire(2 * minimumSize);
+        REQUIRE(large.IsValid());
+        REQUIRE(pool.GetMemorySize() == 3 * minimumSize);
+
+        pool.SetMemoryLimit(0);
+        REQUIRE(pool.GetMemorySize() == 2 * minimumSize);
+    }
+}
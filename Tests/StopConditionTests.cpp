@@ -0,0 +1,176 @@
+#include <string>
+#include <catch.hpp>
+
+#include <Api/StopCondition/ConvergenceCondition.h>
+#include <Api/StopCondition/PredictiveTuningDuration.h>
+#include <Utility/Timer/VirtualClock.h>
+
+ktt::KernelResult CreateStopConditionResult(const ktt::Nanoseconds duration, const bool valid = true)
+{
+    ktt::ComputationResult computation("kernel");
+    computation.SetDurationData(duration, 0, 0);
+    ktt::KernelResult result("kernel", ktt::KernelConfiguration(), {computation});
+
+    if (!valid)
+    {
+        result.SetStatus(ktt::ResultStatus::ComputationFailed);
+    }
+
+    return result;
+}
+
+TEST_CASE("Convergence of best duration", "ConvergenceCondition")
+{
+    SECTION("Condition is fulfilled after window without significant improvement")
+    {
+        ktt::ConvergenceCondition condition(10.0, 3);
+        condition.Initialize(100);
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        condition.Update(CreateStopConditionResult(1'000'000));
+        condition.Update(CreateStopConditionResult(2'000'000));
+        condition.Update(CreateStopConditionResult(1'500'000));
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        // Improvement by 40% resets the window
+        condition.Update(CreateStopConditionResult(600'000));
+        condition.Update(CreateStopConditionResult(700'000));
+        condition.Update(CreateStopConditionResult(800'000));
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        // Improvement by less than the threshold does not reset the window
+        condition.Update(CreateStopConditionResult(580'000));
+        REQUIRE(condition.IsFulfilled());
+    }
+
+    SECTION("Invalid results do not count as improvement")
+    {
+        ktt::ConvergenceCondition condition(10.0, 2);
+        condition.Initialize(100);
+
+        condition.Update(CreateStopConditionResult(1'000'000));
+        condition.Update(CreateStopConditionResult(100'000, false));
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        condition.Update(CreateStopConditionResult(100'000, false));
+        REQUIRE(condition.IsFulfilled());
+        REQUIRE(condition.GetStatusString().find("1.000000ms") != std::string::npos);
+    }
+
+    SECTION("Condition is not fulfilled before minimum number of evaluations")
+    {
+        ktt::ConvergenceCondition condition(10.0, 1, 0.0, 4);
+        condition.Initialize(100);
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            condition.Update(CreateStopConditionResult(1'000'000));
+            REQUIRE_FALSE(condition.IsFulfilled());
+        }
+
+        condition.Update(CreateStopConditionResult(1'000'000));
+        REQUIRE(condition.IsFulfilled());
+    }
+
+    SECTION("Time window is measured with active clock")
+    {
+        ktt::VirtualClock clock;
+        ktt::VirtualClockScope scope(&clock);
+        ktt::ConvergenceCondition condition(10.0, 0, 2.0);
+        condition.Initialize(100);
+
+        condition.Update(CreateStopConditionResult(1'000'000));
+        clock.Advance(1'500'000'000);
+        condition.Update(CreateStopConditionResult(1'000'000));
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        clock.Advance(1'000'000'000);
+        condition.Update(CreateStopConditionResult(1'000'000));
+        REQUIRE(condition.IsFulfilled());
+    }
+
+    SECTION("Status string contains progress towards both windows")
+    {
+        ktt::ConvergenceCondition condition(10.0, 5, 3.0);
+        condition.Initialize(100);
+        condition.Update(CreateStopConditionResult(2'000'000));
+        condition.Update(CreateStopConditionResult(2'500'000));
+
+        const std::string status = condition.GetStatusString();
+        REQUIRE(status.find("2.000000ms") != std::string::npos);
+        REQUIRE(status.find("improvement: 1 / 5") != std::string::npos);
+        REQUIRE(status.find(" / 3.000000 seconds") != std::string::npos);
+    }
+}
+
+TEST_CASE("Prediction of evaluation time", "PredictiveTuningDuration")
+{
+    ktt::VirtualClock clock;
+    ktt::VirtualClockScope scope(&clock);
+
+    // Each evaluation consists of 1 second of kernel run and 0.5 seconds of data movement, the rest of the wall time is tracked
+    // as other overhead. Virtual clock still includes a small amount of real time, so the budget leaves some slack.
+    ktt::KernelResult result = CreateStopConditionResult(1'000'000'000);
+    result.SetDataMovementOverhead(500'000'000);
+
+    SECTION("Prediction is based on running averages of evaluation parts")
+    {
+        ktt::PredictiveTuningDuration condition(10.5);
+        condition.Initialize(100);
+        REQUIRE(condition.GetPredictedEvaluationTime() == 0.0);
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        clock.Advance(2'000'000'000);
+        condition.Update(result);
+        REQUIRE(condition.GetPredictedEvaluationTime() == Approx(2.0).margin(0.01));
+        REQUIRE(condition.GetPredictedRemainingCount() == 4);
+
+        clock.Advance(3'000'000'000);
+        condition.Update(result);
+        REQUIRE(condition.GetPredictedEvaluationTime() == Approx(2.5).margin(0.01));
+        REQUIRE(condition.GetPredictedRemainingCount() == 2);
+        REQUIRE_FALSE(condition.IsFulfilled());
+        REQUIRE(condition.GetStatusString().find("predicted remaining configurations: 2") != std::string::npos);
+    }
+
+    SECTION("Condition is fulfilled before budget when next evaluation would overrun it")
+    {
+        ktt::PredictiveTuningDuration condition(10.5);
+        condition.Initialize(100);
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            clock.Advance(2'000'000'000);
+            condition.Update(result);
+            REQUIRE_FALSE(condition.IsFulfilled());
+        }
+
+        // 8.5 seconds passed, so 2 seconds remain while the next evaluation is predicted to take 2.125 seconds
+        clock.Advance(2'500'000'000);
+        condition.Update(result);
+        REQUIRE(condition.GetPredictedEvaluationTime() == Approx(2.125).margin(0.01));
+        REQUIRE(condition.GetPredictedRemainingCount() == 0);
+        REQUIRE(condition.IsFulfilled());
+    }
+
+    SECTION("Safety factor makes the condition more conservative")
+    {
+        ktt::PredictiveTuningDuration condition(10.5, 2.0);
+        condition.Initialize(100);
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            clock.Advance(2'000'000'000);
+            condition.Update(result);
+        }
+
+        // 6.5 seconds remain, which is enough only for a single evaluation predicted at 2 seconds with the safety factor of 2
+        REQUIRE(condition.GetPredictedRemainingCount() == 1);
+        REQUIRE_FALSE(condition.IsFulfilled());
+
+        clock.Advance(2'500'000'000);
+        condition.Update(result);
+        REQUIRE(condition.GetPredictedRemainingCount() == 0);
+        REQUIRE(condition.IsFulfilled());
+    }
+}
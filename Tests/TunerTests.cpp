@@ -0,0 +1,669 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <catch.hpp>
+
+#include <Kernel/KernelManager.h>
+#include <KernelRunner/ComputeLayerData.h>
+#include <TunerCore.h>
+#include <Utility/TcpSocket.h>
+#include <Utility/Timer/TimerCalibration.h>
+#include <Utility/Timer/VirtualClock.h>
+#include <Ktt.h>
+
+#if defined(_MSC_VER)
+const std::string examplesPrefix = "";
+#else
+const std::string examplesPrefix = "../";
+#endif
+
+const std::string replayResults = examplesPrefix + "../Examples/CoulombSum3d/coulomb_2080_full_search_space";
+
+// Tuning space matches the one of CoulombSum3d example which recorded the replayed results, kernel source is not needed
+ktt::KernelId AddRecordedCoulombKernel(ktt::Tuner& tuner)
+{
+    const ktt::KernelDefinitionId definition = tuner.AddKernelDefinition("directCoulombSum", "", ktt::DimensionVector(256, 256, 256),
+        ktt::DimensionVector());
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("CoulombSum", definition);
+
+    tuner.AddParameter(kernel, "WORK_GROUP_SIZE_X", std::vector<uint64_t>{16, 32});
+    tuner.AddParameter(kernel, "WORK_GROUP_SIZE_Y", std::vector<uint64_t>{1, 2, 4, 8});
+    tuner.AddParameter(kernel, "WORK_GROUP_SIZE_Z", std::vector<uint64_t>{1});
+    tuner.AddParameter(kernel, "Z_ITERATIONS", std::vector<uint64_t>{1, 2, 4, 8, 16, 32});
+    tuner.AddParameter(kernel, "INNER_UNROLL_FACTOR", std::vector<uint64_t>{0, 1, 2, 4, 8, 16, 32});
+    tuner.AddParameter(kernel, "USE_CONSTANT_MEMORY", std::vector<uint64_t>{0});
+    tuner.AddParameter(kernel, "USE_SOA", std::vector<uint64_t>{0, 1});
+    tuner.AddParameter(kernel, "VECTOR_SIZE", std::vector<uint64_t>{1});
+
+    tuner.AddConstraint(kernel, {"INNER_UNROLL_FACTOR", "Z_ITERATIONS"}, [](const std::vector<uint64_t>& values)
+    {
+        return values[0] < values[1];
+    });
+
+    tuner.AddConstraint(kernel, {"WORK_GROUP_SIZE_X", "WORK_GROUP_SIZE_Y"}, [](const std::vector<uint64_t>& values)
+    {
+        return values[0] * values[1] >= 64;
+    });
+
+    return kernel;
+}
+
+TEST_CASE("Asynchronous output downloads", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+
+    const auto fill = [](const float value)
+    {
+        return [value](const ktt::KernelConfiguration&, const std::vector<void*>& arguments)
+        {
+            auto* data = static_cast<float*>(arguments[0]);
+
+            for (size_t i = 0; i < 64; ++i)
+            {
+                data[i] = value;
+            }
+        };
+    };
+
+    const std::vector<float> input(64, 0.0f);
+    const ktt::ArgumentId first = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::WriteOnly);
+    const ktt::ArgumentId second = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::WriteOnly);
+
+    const ktt::KernelDefinitionId firstDefinition = tuner.AddHostKernelDefinition("first", fill(1.0f));
+    const ktt::KernelDefinitionId secondDefinition = tuner.AddHostKernelDefinition("second", fill(2.0f));
+    tuner.SetArguments(firstDefinition, {first});
+    tuner.SetArguments(secondDefinition, {second});
+    const ktt::KernelId firstKernel = tuner.CreateSimpleKernel("First", firstDefinition);
+    const ktt::KernelId secondKernel = tuner.CreateSimpleKernel("Second", secondDefinition);
+
+    std::vector<float> output(64, 0.0f);
+    size_t finishedCount = 0;
+
+    SECTION("Pending downloads are finished only by runs which overwrite their buffers")
+    {
+        tuner.RunAsync(firstKernel, {}, {ktt::BufferOutputDescriptor(first, output.data())}, [&finishedCount](const auto&)
+        {
+            ++finishedCount;
+        });
+
+        tuner.Run(secondKernel, {}, {});
+        REQUIRE(finishedCount == 0);
+
+        tuner.Run(firstKernel, {}, {});
+        REQUIRE(finishedCount == 1);
+        REQUIRE(output == std::vector<float>(64, 1.0f));
+    }
+
+    SECTION("Callbacks of multiple pending runs are invoked in the order of runs")
+    {
+        std::vector<std::string> order;
+        std::vector<float> secondOutput(64, 0.0f);
+
+        tuner.RunAsync(firstKernel, {}, {ktt::BufferOutputDescriptor(first, output.data())}, [&order](const auto&)
+        {
+            order.push_back("first");
+        });
+
+        tuner.RunAsync(secondKernel, {}, {ktt::BufferOutputDescriptor(second, secondOutput.data())}, [&order](const auto&)
+        {
+            order.push_back("second");
+        });
+
+        REQUIRE(order.empty());
+        tuner.Run(secondKernel, {}, {});
+        REQUIRE(order == std::vector<std::string>{"first", "second"});
+        REQUIRE(secondOutput == std::vector<float>(64, 2.0f));
+
+        tuner.RunAsync(firstKernel, {}, {ktt::BufferOutputDescriptor(first, output.data())}, nullptr);
+        tuner.WaitForOutputs();
+        REQUIRE(output == std::vector<float>(64, 1.0f));
+    }
+}
+
+TEST_CASE("Snapshots of read-write arguments", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+    tuner.SetReadWriteArgumentSnapshot(true);
+
+    // Kernel records whether it received the pristine input and then modifies the input in place
+    const size_t size = 1024;
+    std::vector<float> seenValues;
+
+    const auto addKernel = [&tuner, &seenValues, size](const ktt::ArgumentId& argument)
+    {
+        const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("increment", [&seenValues, size](
+            const ktt::KernelConfiguration&, const std::vector<void*>& arguments)
+        {
+            auto* data = static_cast<float*>(arguments[0]);
+            const float first = data[0];
+            const bool uniform = std::all_of(data, data + size, [first](const float value)
+            {
+                return value == first;
+            });
+
+            seenValues.push_back(uniform ? first : -1.0f);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] += 1.0f;
+            }
+        });
+
+        tuner.SetArguments(definition, {argument});
+        const ktt::KernelId kernel = tuner.CreateSimpleKernel("Increment", definition);
+        tuner.AddParameter(kernel, "UNUSED", std::vector<uint64_t>{1, 2, 3, 4});
+        return std::make_pair(definition, kernel);
+    };
+
+    const ktt::ArgumentId argument = tuner.AddArgumentVector(std::vector<float>(size, 1.0f), ktt::ArgumentAccessType::ReadWrite,
+        "data");
+    const auto [definition, kernel] = addKernel(argument);
+
+    // Configuration data are cleared, so that every tuning runs all configurations again
+    const auto tuneAll = [&tuner](const ktt::KernelId id)
+    {
+        tuner.ClearConfigurationData(id);
+        const auto results = tuner.Tune(id);
+
+        return results.size() == 4 && std::all_of(results.cbegin(), results.cend(), [](const auto& result)
+        {
+            return result.IsValid();
+        });
+    };
+
+    SECTION("Every run of in-place kernel starts from pristine input")
+    {
+        const uint64_t uploads = tuner.GetTransferStatistics().m_UploadCount;
+        REQUIRE(tuneAll(kernel));
+        REQUIRE(seenValues == std::vector<float>(4, 1.0f));
+
+        // Argument and its snapshot are uploaded only once, later runs restore the argument with device-side copy
+        REQUIRE(tuner.GetTransferStatistics().m_UploadCount - uploads == 2);
+    }
+
+    SECTION("Disabling snapshots releases their buffers")
+    {
+        REQUIRE(tuneAll(kernel));
+        tuner.SetReadWriteArgumentSnapshot(false);
+
+        // Host engine refuses to upload into existing buffer, so the runs would fail if the buffers were kept
+        uint64_t uploads = tuner.GetTransferStatistics().m_UploadCount;
+        REQUIRE(tuneAll(kernel));
+        REQUIRE(tuner.GetTransferStatistics().m_UploadCount - uploads == 4);
+
+        // New snapshot is created when snapshots are enabled again
+        tuner.SetReadWriteArgumentSnapshot(true);
+        uploads = tuner.GetTransferStatistics().m_UploadCount;
+        REQUIRE(tuneAll(kernel));
+        REQUIRE(tuner.GetTransferStatistics().m_UploadCount - uploads == 2);
+        REQUIRE(seenValues == std::vector<float>(12, 1.0f));
+    }
+
+    SECTION("Removing argument clears its snapshot")
+    {
+        REQUIRE(tuneAll(kernel));
+        tuner.RemoveKernel(kernel);
+        tuner.RemoveKernelDefinition(definition);
+        tuner.RemoveArgument(argument);
+
+        // Argument with the same id must not be restored from the snapshot of the removed one
+        const ktt::ArgumentId newArgument = tuner.AddArgumentVector(std::vector<float>(size, 5.0f),
+            ktt::ArgumentAccessType::ReadWrite, "data");
+        const auto newKernel = addKernel(newArgument).second;
+        seenValues.clear();
+
+        REQUIRE(tuneAll(newKernel));
+        REQUIRE(seenValues == std::vector<float>(4, 5.0f));
+    }
+}
+
+TEST_CASE("Timer calibration", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+
+    SECTION("Durations are corrected only by valid calibration")
+    {
+        ktt::TimerCalibration calibration;
+        calibration.SetEventTimingOverhead(100);
+        calibration.SetTimerOverhead(10);
+        REQUIRE(calibration.CorrectKernelDuration(500) == 500);
+
+        calibration.SetValid(true);
+        REQUIRE(calibration.CorrectKernelDuration(500) == 400);
+        REQUIRE(calibration.CorrectKernelDuration(50) == 0);
+        REQUIRE(calibration.CorrectHostDuration(500) == 490);
+        REQUIRE(calibration.CorrectKernelDuration(ktt::InvalidDuration) == ktt::InvalidDuration);
+
+        calibration.Reset();
+        REQUIRE_FALSE(calibration.IsValid());
+        REQUIRE(calibration.GetEventTimingOverhead() == 0);
+    }
+
+    SECTION("Removed bias is reported as calibration overhead for simple and launcher kernels")
+    {
+        ktt::TimerCalibration calibration;
+        calibration.SetEventTimingOverhead(100);
+        calibration.SetTimerOverhead(10);
+        calibration.SetValid(true);
+
+        ktt::KernelArgumentManager argumentManager;
+        ktt::KernelManager manager(argumentManager);
+        const ktt::KernelDefinitionId definition = manager.AddKernelDefinition("kernel", "", ktt::DimensionVector(64),
+            ktt::DimensionVector(8));
+        const ktt::KernelId simpleKernel = manager.CreateKernel("simple", {definition});
+        const ktt::KernelId launcherKernel = manager.CreateKernel("launcher", {definition});
+        manager.SetLauncher(launcherKernel, [](ktt::ComputeInterface&) {});
+
+        // Kernel event reports 500 ns out of 1000 ns measured around the whole launcher
+        ktt::ComputationResult partialResult("kernel");
+        partialResult.SetDurationData(500, 0, 0);
+        const ktt::KernelConfiguration configuration;
+
+        ktt::ComputeLayerData simpleData(manager.GetKernel(simpleKernel), configuration, {}, ktt::KernelRunMode::Running,
+            calibration);
+        simpleData.AddPartialResult(partialResult);
+        const auto simpleResult = simpleData.GenerateResult(1000);
+        REQUIRE(simpleResult.GetKernelDuration() == 400);
+        REQUIRE(simpleResult.GetDataMovementOverhead() == 490);
+        REQUIRE(simpleResult.GetCalibrationOverhead() == 110);
+
+        // Launcher time is computed from the raw kernel duration, so the removed bias does not reappear in extra duration
+        ktt::ComputeLayerData launcherData(manager.GetKernel(launcherKernel), configuration, {}, ktt::KernelRunMode::Running,
+            calibration);
+        launcherData.AddPartialResult(partialResult);
+        const auto launcherResult = launcherData.GenerateResult(1000);
+        REQUIRE(launcherResult.GetKernelDuration() == 400);
+        REQUIRE(launcherResult.GetExtraDuration() == 490);
+        REQUIRE(launcherResult.GetTotalDuration() == 890);
+        REQUIRE(launcherResult.GetDataMovementOverhead() == 0);
+        REQUIRE(launcherResult.GetCalibrationOverhead() == 110);
+    }
+
+    SECTION("Host timer overhead and resolution are measured")
+    {
+        ktt::TimerCalibration calibration;
+        calibration.MeasureHostTimer();
+        REQUIRE(calibration.GetTimerResolution() > 0);
+        REQUIRE(calibration.GetTimerOverhead() < 1'000'000);
+    }
+
+    SECTION("Calibrated host tuner runs kernels")
+    {
+        ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+        REQUIRE_NOTHROW(tuner.CalibrateTimer());
+
+        const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("empty",
+            [](const ktt::KernelConfiguration&, const std::vector<void*>&) {});
+        const ktt::KernelId kernel = tuner.CreateSimpleKernel("Empty", definition);
+
+        const ktt::KernelResult result = tuner.Run(kernel, {}, {});
+        REQUIRE(result.IsValid());
+
+        const ktt::KernelId launcherKernel = tuner.CreateSimpleKernel("EmptyLauncher", definition);
+        tuner.SetLauncher(launcherKernel, [definition](ktt::ComputeInterface& interface)
+        {
+            interface.RunKernel(definition);
+        });
+
+        const ktt::KernelResult launcherResult = tuner.Run(launcherKernel, {}, {});
+        REQUIRE(launcherResult.IsValid());
+        REQUIRE(launcherResult.GetCalibrationOverhead() != ktt::InvalidDuration);
+    }
+
+    SECTION("Calibration is skipped when results are replayed")
+    {
+        ktt::Tuner tuner(replayResults, ktt::OutputFormat::JSON);
+        REQUIRE_NOTHROW(tuner.CalibrateTimer());
+    }
+}
+
+TEST_CASE("Fast validation methods", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+
+    // Configuration with ERROR equal to 1 writes a single wrong element, configuration with ERROR equal to 2 writes wrong values
+    // into the whole buffer
+    const size_t size = 10000;
+    const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("fill", [size](
+        const ktt::KernelConfiguration& configuration, const std::vector<void*>& arguments)
+    {
+        const uint64_t error = configuration.GetPairs()[0].GetValueUint();
+        auto* data = static_cast<float*>(arguments[0]);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = error == 2 ? 2.0f : 1.0f;
+        }
+
+        if (error == 1)
+        {
+            data[size / 2 + 3] = 100.0f;
+        }
+    });
+
+    const std::vector<float> input(size, 0.0f);
+    const ktt::ArgumentId output = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::WriteOnly);
+    tuner.SetArguments(definition, {output});
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("Fill", definition);
+    tuner.AddParameter(kernel, "ERROR", std::vector<uint64_t>{0, 1, 2});
+
+    tuner.SetReferenceComputation(output, [size](void* buffer)
+    {
+        auto* data = static_cast<float*>(buffer);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = 1.0f;
+        }
+    });
+
+    const auto validity = [](const std::vector<ktt::KernelResult>& results)
+    {
+        std::vector<bool> valid;
+
+        for (const auto& result : results)
+        {
+            valid.push_back(result.IsValid());
+        }
+
+        return valid;
+    };
+
+    SECTION("Block checksums detect a single wrong element and all wrong elements")
+    {
+        tuner.SetValidationMethod(ktt::ValidationMethod::BlockChecksumComparison, 0.01);
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(validity(results) == std::vector<bool>{true, false, false});
+    }
+
+    SECTION("Sampled comparison with custom sample count detects wrong buffers")
+    {
+        tuner.SetValidationMethod(ktt::ValidationMethod::SampledComparison, 0.01);
+        tuner.SetValidationSampleCount(16);
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(validity(results)[0]);
+        REQUIRE_FALSE(validity(results)[2]);
+    }
+}
+
+TEST_CASE("Precompilation of configuration ranges", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+
+    // Tuner API only logs the errors, so the exceptions are checked on the tuner core
+    ktt::TunerCore tuner(0, 0, ktt::ComputeApi::Host, 1);
+    const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("empty",
+        [](const ktt::KernelConfiguration&, const std::vector<void*>&) {}, ktt::DimensionVector(), ktt::DimensionVector());
+    const ktt::KernelId kernel = tuner.CreateKernel("Empty", definition);
+    tuner.AddParameter(kernel, "VALUE", std::vector<ktt::ParameterValue>{static_cast<uint64_t>(1), static_cast<uint64_t>(2),
+        static_cast<uint64_t>(3), static_cast<uint64_t>(4)}, "");
+    const uint64_t end = std::numeric_limits<uint64_t>::max();
+
+    SECTION("Empty and out of range index ranges are rejected")
+    {
+        REQUIRE_THROWS_AS(tuner.Precompile(kernel, 2, 2), ktt::KttException);
+        REQUIRE_THROWS_AS(tuner.Precompile(kernel, 3, 1), ktt::KttException);
+        REQUIRE_THROWS_AS(tuner.Precompile(kernel, 4, end), ktt::KttException);
+    }
+
+    SECTION("End index is clamped to the size of configuration space")
+    {
+        // Host functions are compiled together with the application, so there is nothing to precompile
+        REQUIRE_NOTHROW(tuner.Precompile(kernel, 1, 100));
+        REQUIRE_NOTHROW(tuner.Precompile(kernel, 0, end));
+    }
+}
+
+TEST_CASE("Tuning on multiple devices", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, std::vector<ktt::DeviceIndex>{0, 0, 0}, ktt::ComputeApi::Host);
+
+    const std::vector<float> input(64, 0.0f);
+    const ktt::ArgumentId output = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::WriteOnly);
+
+    const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("sleep",
+        [](const ktt::KernelConfiguration& configuration, const std::vector<void*>& arguments)
+    {
+        // Runs take long enough to overlap, so that idle devices receive upcoming configurations
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        auto* data = static_cast<float*>(arguments[0]);
+        data[0] = static_cast<float>(configuration.GetPairs()[0].GetValueUint());
+    });
+
+    tuner.SetArguments(definition, {output});
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("Sleep", definition);
+    tuner.AddParameter(kernel, "A", std::vector<uint64_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+
+    const auto checkResults = [](const std::vector<ktt::KernelResult>& results)
+    {
+        std::set<uint64_t> values;
+        std::set<ktt::DeviceIndex> devices;
+
+        for (const auto& result : results)
+        {
+            REQUIRE(result.IsValid());
+            values.insert(result.GetConfiguration().GetPairs()[0].GetValueUint());
+            devices.insert(result.GetTuningDevice());
+        }
+
+        REQUIRE(values.size() == 12);
+        REQUIRE(devices.size() > 1);
+    };
+
+    SECTION("Deterministic searcher results are processed in searcher order")
+    {
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(results.size() == 12);
+        checkResults(results);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            REQUIRE(results[i].GetConfiguration().GetPairs()[0].GetValueUint() == i + 1);
+        }
+
+        // Output argument is uploaded before every run, statistics are summed over all devices
+        REQUIRE(tuner.GetTransferStatistics().m_UploadCount == 12);
+    }
+
+    SECTION("Random searcher reports upcoming configurations for other devices")
+    {
+        tuner.SetSearcher(kernel, std::make_unique<ktt::RandomSearcher>());
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(results.size() == 12);
+        checkResults(results);
+    }
+}
+
+TEST_CASE("Distributed tuning with local workers", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+
+    // Coordinator and workers are set up identically, except that the coordinator does not need kernel arguments
+    const auto createKernel = [](ktt::Tuner& tuner, const bool addArguments)
+    {
+        const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("sleep",
+            [](const ktt::KernelConfiguration&, const std::vector<void*>&)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        });
+
+        if (addArguments)
+        {
+            const ktt::ArgumentId output = tuner.AddArgumentVector(std::vector<float>(16, 0.0f), ktt::ArgumentAccessType::WriteOnly);
+            tuner.SetArguments(definition, {output});
+        }
+
+        const ktt::KernelId kernel = tuner.CreateSimpleKernel("Sleep", definition);
+        tuner.AddParameter(kernel, "A", std::vector<uint64_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        return kernel;
+    };
+
+    // Free port is found by the operating system, it is released before the coordinator starts listening on it
+    const uint16_t port = ktt::TcpSocket::Listen(0, true)->GetPort();
+    std::vector<uint64_t> testedCounts(2, 0);
+    std::vector<std::thread> workers;
+
+    for (size_t i = 0; i < testedCounts.size(); ++i)
+    {
+        workers.emplace_back([&createKernel, &testedCounts, port, i]()
+        {
+            ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+            const ktt::KernelId kernel = createKernel(tuner, true);
+
+            // Tuner does not report failed connection to the caller, so the worker starts only once the coordinator is listening
+            for (int attempt = 0; attempt < 100; ++attempt)
+            {
+                try
+                {
+                    ktt::TcpSocket::Connect("127.0.0.1", port);
+                    break;
+                }
+                catch (const ktt::KttException&)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                }
+            }
+
+            testedCounts[i] = tuner.RunTuningWorker(kernel, "127.0.0.1", port);
+        });
+    }
+
+    ktt::Tuner coordinator(0, 0, ktt::ComputeApi::Host);
+    const ktt::KernelId kernel = createKernel(coordinator, false);
+    const auto results = coordinator.TuneDistributed(kernel, port, 10);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::set<uint64_t> values;
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        REQUIRE(results[i].IsValid());
+        REQUIRE(results[i].GetConfiguration().GetPairs()[0].GetValueUint() == i + 1);
+        values.insert(results[i].GetConfiguration().GetPairs()[0].GetValueUint());
+    }
+
+    REQUIRE(results.size() == 10);
+    REQUIRE(values.size() == 10);
+    REQUIRE(testedCounts[0] + testedCounts[1] >= 10);
+}
+
+TEST_CASE("Sandboxed execution of hanging and crashing kernels", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+    ktt::Tuner tuner(0, 0, ktt::ComputeApi::Host);
+
+    const std::vector<float> input(64, 0.0f);
+    const ktt::ArgumentId output = tuner.AddArgumentVector(input, ktt::ArgumentAccessType::WriteOnly);
+
+    const ktt::KernelDefinitionId definition = tuner.AddHostKernelDefinition("faulty",
+        [](const ktt::KernelConfiguration& configuration, const std::vector<void*>& arguments)
+    {
+        const uint64_t value = configuration.GetPairs()[0].GetValueUint();
+
+        if (value == 1)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(60));
+        }
+        else if (value == 2)
+        {
+            std::abort();
+        }
+
+        auto* data = static_cast<float*>(arguments[0]);
+        data[0] = static_cast<float>(value);
+    });
+
+    tuner.SetArguments(definition, {output});
+    const ktt::KernelId kernel = tuner.CreateSimpleKernel("Faulty", definition);
+    tuner.AddParameter(kernel, "A", std::vector<uint64_t>{0, 1, 2, 3});
+
+    // Worker process runs only this test case and its report does not mix with the report of the tuning process
+    const std::string workerReport = "SandboxWorkerReport.txt";
+    tuner.SetSandboxedExecution(true, 10.0, 1, {"Sandboxed execution of hanging and crashing kernels", "-o", workerReport});
+
+    if (tuner.RunSandboxWorker(kernel))
+    {
+        return;
+    }
+
+    const auto results = tuner.Tune(kernel);
+    std::remove(workerReport.c_str());
+
+    REQUIRE(results.size() == 4);
+    REQUIRE(results[0].IsValid());
+    REQUIRE(results[1].GetStatus() == ktt::ResultStatus::Timeout);
+    REQUIRE(results[2].GetStatus() == ktt::ResultStatus::ComputationFailed);
+    REQUIRE(results[3].IsValid());
+    REQUIRE(results[3].GetConfiguration().GetPairs()[0].GetValueUint() == 3);
+}
+
+TEST_CASE("Replaying recorded tuning", "Tuner")
+{
+    ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+
+    // Recorded results use microseconds, the tuner time unit has to match them
+    ktt::Tuner::SetTimeUnit(ktt::TimeUnit::Microseconds);
+
+    SECTION("All recorded configurations are replayed")
+    {
+        ktt::Tuner tuner(replayResults, ktt::OutputFormat::JSON);
+        const ktt::KernelId kernel = AddRecordedCoulombKernel(tuner);
+        const auto results = tuner.Tune(kernel);
+        REQUIRE(results.size() == 210);
+
+        const ktt::KernelResult* fastest = &results[0];
+
+        for (const auto& result : results)
+        {
+            REQUIRE(result.IsValid());
+            REQUIRE(result.GetTotalDuration() > 0);
+
+            if (result.GetTotalDuration() < fastest->GetTotalDuration())
+            {
+                fastest = &result;
+            }
+        }
+
+        REQUIRE(tuner.GetBestConfiguration(kernel) == fastest->GetConfiguration());
+    }
+
+    SECTION("Virtual clock measures only replayed time of its own tuner")
+    {
+        // Replayed kernel runs take almost a minute, so the limit is reached only in replayed time
+        for (int i = 0; i < 2; ++i)
+        {
+            ktt::Tuner tuner(replayResults, ktt::OutputFormat::JSON);
+            const ktt::KernelId kernel = AddRecordedCoulombKernel(tuner);
+            const auto results = tuner.Tune(kernel, std::make_unique<ktt::TuningDuration>(10.0));
+
+            REQUIRE(results.size() > 0);
+            REQUIRE(results.size() < 210);
+            REQUIRE(ktt::VirtualClock::Now() - std::chrono::steady_clock::now() < std::chrono::seconds(1));
+        }
+    }
+
+    SECTION("Wall-clock time is measured without virtual clock")
+    {
+        ktt::Tuner tuner(replayResults, ktt::OutputFormat::JSON, false);
+        const ktt::KernelId kernel = AddRecordedCoulombKernel(tuner);
+        const auto results = tuner.Tune(kernel, std::make_unique<ktt::TuningDuration>(10.0));
+        REQUIRE(results.size() == 210);
+    }
+
+    ktt::Tuner::SetTimeUnit(ktt::TimeUnit::Milliseconds);
+}
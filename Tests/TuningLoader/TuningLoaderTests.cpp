@@ -0,0 +1,80 @@
+#include <filesystem>
+#include <memory>
+#include <catch.hpp>
+#include <json-schema.hpp>
+
+#include <Commands/PrecompileCommand.h>
+#include <Commands/StopConditionCommand.h>
+#include <Deserialization/JsonCommandConverters.h>
+#include <TunerContext.h>
+#include <TuningSchema.h>
+
+TEST_CASE("Deserialization of stop conditions", "TuningLoader")
+{
+    SECTION("Convergence condition with attributes")
+    {
+        const auto budget = ktt::json::parse(R"([{"Type": "Convergence", "BudgetValue": 1, "ImprovementThreshold": 10.0,
+            "MinimumEvaluations": 3}])");
+        auto command = budget.get<ktt::StopConditionCommand>();
+
+        ktt::TunerContext context;
+        command.Execute(context);
+        auto condition = context.RetrieveStopCondition();
+        REQUIRE(condition != nullptr);
+
+        ktt::ComputationResult computation("kernel");
+        computation.SetDurationData(1'000'000, 0, 0);
+        const ktt::KernelResult result("kernel", ktt::KernelConfiguration(), {computation});
+        condition->Initialize(100);
+
+        // Window of one configuration is exceeded after the second one, but the minimum number of evaluations is not reached yet
+        condition->Update(result);
+        condition->Update(result);
+        REQUIRE_FALSE(condition->IsFulfilled());
+        condition->Update(result);
+        REQUIRE(condition->IsFulfilled());
+    }
+}
+
+TEST_CASE("Deserialization of kernel precompilation", "TuningLoader")
+{
+    nlohmann::json_schema::json_validator validator;
+    validator.set_root_schema(ktt::TuningSchema);
+
+    auto input = ktt::json::parse(R"({
+        "ConfigurationSpace": {"TuningParameters": []},
+        "KernelSpecification": {"Language": "OpenCL", "KernelName": "kernel", "KernelFile": "kernel.cl", "GlobalSize": {"X": "1"},
+            "LocalSize": {"X": "1"}},
+        "General": {"KernelBinaryCache": "KttLoaderCache", "KernelBinaryCacheSize": 1048576, "Precompile": true}
+    })");
+
+    SECTION("Schema accepts kernel binary cache entries")
+    {
+        REQUIRE_NOTHROW(validator.validate(input));
+
+        input["General"]["Precompile"] = "yes";
+        REQUIRE_THROWS(validator.validate(input));
+
+        input["General"]["Precompile"] = false;
+        input["General"]["KernelBinaryCache"] = 1;
+        REQUIRE_THROWS(validator.validate(input));
+    }
+
+    SECTION("Command sets cache and precompiles the kernel from context")
+    {
+        ktt::Tuner::SetLoggingLevel(ktt::LoggingLevel::Off);
+        auto tuner = std::make_unique<ktt::Tuner>(0, 0, ktt::ComputeApi::Host);
+        const ktt::KernelDefinitionId definition = tuner->AddHostKernelDefinition("empty",
+            [](const ktt::KernelConfiguration&, const std::vector<void*>&) {});
+        const ktt::KernelId kernel = tuner->CreateSimpleKernel("Empty", definition);
+
+        // Host backend ignores the cache and has nothing to precompile, so only the deserialized command is exercised
+        ktt::TunerContext context;
+        context.SetWorkingDirectory(std::filesystem::temp_directory_path().string());
+        context.SetTuner(std::move(tuner));
+        context.SetKernelId(kernel);
+
+        auto command = input["General"].get<ktt::PrecompileCommand>();
+        REQUIRE_NOTHROW(command.Execute(context));
+    }
+}
@@ -17,6 +17,7 @@ enum class CommandPriority
     Searcher,
     StopCondition,
     Validation,
+    Precompilation,
     Tuning,
     Output
 };
@@ -0,0 +1,27 @@
+#include <Commands/PrecompileCommand.h>
+
+namespace ktt
+{
+
+PrecompileCommand::PrecompileCommand(const std::string& cacheDirectory, const uint64_t cacheSize, const bool precompile) :
+    m_CacheDirectory(cacheDirectory),
+    m_CacheSize(cacheSize),
+    m_Precompile(precompile)
+{}
+
+void PrecompileCommand::Execute(TunerContext& context)
+{
+    context.GetTuner().SetKernelBinaryCache(context.GetFullPath(m_CacheDirectory), m_CacheSize);
+
+    if (m_Precompile)
+    {
+        context.GetTuner().Precompile(context.GetKernelId());
+    }
+}
+
+CommandPriority PrecompileCommand::GetPriority() const
+{
+    return CommandPriority::Precompilation;
+}
+
+} // namespace ktt
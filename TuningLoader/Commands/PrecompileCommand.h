@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <TunerCommand.h>
+
+namespace ktt
+{
+
+class PrecompileCommand : public TunerCommand
+{
+public:
+    PrecompileCommand() = default;
+    explicit PrecompileCommand(const std::string& cacheDirectory, const uint64_t cacheSize, const bool precompile);
+
+    virtual void Execute(TunerContext& context) override;
+    virtual CommandPriority GetPriority() const override;
+
+private:
+    std::string m_CacheDirectory;
+    uint64_t m_CacheSize;
+    bool m_Precompile;
+};
+
+} // namespace ktt
@@ -24,6 +24,25 @@ void SearcherCommand::Execute(TunerContext& context)
     case SearcherType::MCMC:
         searcher = std::make_unique<McmcSearcher>();
         break;
+    case SearcherType::Pareto:
+    {
+        size_t populationSize = 20;
+
+        if (m_Attributes.count("populationSize") > 0)
+        {
+            populationSize = std::stoul(m_Attributes["populationSize"]);
+        }
+
+        double mutationProbability = 0.1;
+
+        if (m_Attributes.count("mutationProbability") > 0)
+        {
+            mutationProbability = std::stod(m_Attributes["mutationProbability"]);
+        }
+
+        searcher = std::make_unique<ParetoSearcher>(populationSize, mutationProbability);
+        break;
+    }
     case SearcherType::ProfileBased:
         {
           // if default values needs to be changed, do it also in Source/Tuner.cpp
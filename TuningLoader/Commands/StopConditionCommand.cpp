@@ -4,9 +4,11 @@
 namespace ktt
 {
 
-StopConditionCommand::StopConditionCommand(const std::vector<StopConditionType>& types, const std::vector<double>& budgets) :
+StopConditionCommand::StopConditionCommand(const std::vector<StopConditionType>& types, const std::vector<double>& budgets,
+    const std::vector<std::map<std::string, double>>& attributes) :
     m_Types(types),
-    m_Budgets(budgets)
+    m_Budgets(budgets),
+    m_Attributes(attributes)
 {}
 
 void StopConditionCommand::Execute(TunerContext& context)
@@ -28,6 +30,14 @@ void StopConditionCommand::Execute(TunerContext& context)
         case StopConditionType::ConfigurationFraction:
             condition = std::make_unique<ConfigurationFraction>(m_Budgets[i]);
             break;
+        case StopConditionType::Convergence:
+            condition = std::make_unique<ConvergenceCondition>(GetAttribute(i, "ImprovementThreshold", 1.0),
+                static_cast<uint64_t>(m_Budgets[i]), GetAttribute(i, "TimeWindow", 0.0),
+                static_cast<uint64_t>(GetAttribute(i, "MinimumEvaluations", 0.0)));
+            break;
+        case StopConditionType::PredictiveTuningDuration:
+            condition = std::make_unique<PredictiveTuningDuration>(m_Budgets[i], GetAttribute(i, "SafetyFactor", 1.0));
+            break;
         default:
             KttLoaderError("Unhandled stop condition type");
         }
@@ -44,4 +54,22 @@ CommandPriority StopConditionCommand::GetPriority() const
     return CommandPriority::StopCondition;
 }
 
+double StopConditionCommand::GetAttribute(const size_t index, const std::string& name, const double defaultValue) const
+{
+    if (index >= m_Attributes.size())
+    {
+        return defaultValue;
+    }
+
+    const auto& attributes = m_Attributes[index];
+    const auto iterator = attributes.find(name);
+
+    if (iterator == attributes.cend())
+    {
+        return defaultValue;
+    }
+
+    return iterator->second;
+}
+
 } // namespace ktt
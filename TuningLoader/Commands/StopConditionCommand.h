@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+#include <string>
 #include <vector>
 
 #include <Deserialization/StopConditionType.h>
@@ -12,7 +14,8 @@ class StopConditionCommand : public TunerCommand
 {
 public:
     StopConditionCommand() = default;
-    explicit StopConditionCommand(const std::vector<StopConditionType>& types, const std::vector<double>& budgets);
+    explicit StopConditionCommand(const std::vector<StopConditionType>& types, const std::vector<double>& budgets,
+        const std::vector<std::map<std::string, double>>& attributes);
 
     virtual void Execute(TunerContext& context) override;
     virtual CommandPriority GetPriority() const override;
@@ -20,6 +23,9 @@ public:
 private:
     std::vector<StopConditionType> m_Types;
     std::vector<double> m_Budgets;
+    std::vector<std::map<std::string, double>> m_Attributes;
+
+    double GetAttribute(const size_t index, const std::string& name, const double defaultValue) const;
 };
 
 } // namespace ktt
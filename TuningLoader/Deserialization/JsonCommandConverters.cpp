@@ -231,6 +231,28 @@ void from_json(const json& j, ParameterCommand& command)
     command = ParameterCommand(name, valueType, valueScript);
 }
 
+void from_json(const json& j, PrecompileCommand& command)
+{
+    std::string cacheDirectory;
+    j.at("KernelBinaryCache").get_to(cacheDirectory);
+
+    uint64_t cacheSize = 0;
+
+    if (j.contains("KernelBinaryCacheSize"))
+    {
+        j.at("KernelBinaryCacheSize").get_to(cacheSize);
+    }
+
+    bool precompile = false;
+
+    if (j.contains("Precompile"))
+    {
+        j.at("Precompile").get_to(precompile);
+    }
+
+    command = PrecompileCommand(cacheDirectory, cacheSize, precompile);
+}
+
 void from_json(const json& j, SearcherCommand& command)
 {
     const auto type = j.at("Name").get<SearcherType>();
@@ -282,7 +304,24 @@ void from_json(const json& j, StopConditionCommand& command)
         budgets.push_back(value);
     }
 
-    command = StopConditionCommand(types, budgets);
+    std::vector<std::map<std::string, double>> attributes;
+
+    for (auto it = j.begin(); it != j.end(); ++it)
+    {
+        std::map<std::string, double> conditionAttributes;
+
+        for (const auto& name : {"ImprovementThreshold", "TimeWindow", "MinimumEvaluations", "SafetyFactor"})
+        {
+            if (it.value().contains(name))
+            {
+                conditionAttributes[name] = it.value()[name].get<double>();
+            }
+        }
+
+        attributes.push_back(conditionAttributes);
+    }
+
+    command = StopConditionCommand(types, budgets, attributes);
 }
 
 void from_json(const json& j, TimeUnitCommand& command)
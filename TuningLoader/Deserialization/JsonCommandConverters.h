@@ -12,6 +12,7 @@
 #include <Commands/ModifierCommand.h>
 #include <Commands/OutputCommand.h>
 #include <Commands/ParameterCommand.h>
+#include <Commands/PrecompileCommand.h>
 #include <Commands/SearcherCommand.h>
 #include <Commands/SharedMemoryCommand.h>
 #include <Commands/SizeTypeCommand.h>
@@ -88,7 +89,8 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ComputeApi,
 {
     {ComputeApi::OpenCL, "OpenCL"},
     {ComputeApi::CUDA, "CUDA"},
-    {ComputeApi::Vulkan, "Vulkan"}
+    {ComputeApi::Vulkan, "Vulkan"},
+    {ComputeApi::Host, "Host"}
 });
 
 NLOHMANN_JSON_SERIALIZE_ENUM(GlobalSizeType,
@@ -150,14 +152,17 @@ NLOHMANN_JSON_SERIALIZE_ENUM(SearcherType,
     {SearcherType::Deterministic, "Deterministic"},
     {SearcherType::Random, "Random"},
     {SearcherType::MCMC, "MCMC"},
-    {SearcherType::ProfileBased, "ProfileBased"}
+    {SearcherType::ProfileBased, "ProfileBased"},
+    {SearcherType::Pareto, "Pareto"}
 });
 
 NLOHMANN_JSON_SERIALIZE_ENUM(StopConditionType,
 {
     {StopConditionType::TuningDuration, "TuningDuration"},
     {StopConditionType::ConfigurationCount, "ConfigurationCount"},
-    {StopConditionType::ConfigurationFraction, "ConfigurationFraction"}
+    {StopConditionType::ConfigurationFraction, "ConfigurationFraction"},
+    {StopConditionType::Convergence, "Convergence"},
+    {StopConditionType::PredictiveTuningDuration, "PredictiveTuningDuration"}
 });
 
 NLOHMANN_JSON_SERIALIZE_ENUM(TimeUnit,
@@ -172,7 +177,9 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ValidationMethod,
 {
     {ValidationMethod::AbsoluteDifference, "AbsoluteDifference"},
     {ValidationMethod::SideBySideComparison, "SideBySideComparison"},
-    {ValidationMethod::SideBySideRelativeComparison, "SideBySideRelativeComparison"}
+    {ValidationMethod::SideBySideRelativeComparison, "SideBySideRelativeComparison"},
+    {ValidationMethod::SampledComparison, "SampledComparison"},
+    {ValidationMethod::BlockChecksumComparison, "BlockChecksumComparison"}
 });
 
 void to_json(json& j, const DimensionVector& vector);
@@ -189,6 +196,7 @@ void from_json(const json& j, LoggingLevelCommand& command);
 void from_json(const json& j, ModifierCommand& command);
 void from_json(const json& j, OutputCommand& command);
 void from_json(const json& j, ParameterCommand& command);
+void from_json(const json& j, PrecompileCommand& command);
 void from_json(const json& j, SearcherCommand& command);
 void from_json(const json& j, SharedMemoryCommand& command);
 void from_json(const json& j, SizeTypeCommand& command);
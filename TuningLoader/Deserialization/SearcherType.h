@@ -8,7 +8,8 @@ enum class SearcherType
     Deterministic,
     Random,
     MCMC,
-    ProfileBased
+    ProfileBased,
+    Pareto
 };
 
 } // namespace ktt
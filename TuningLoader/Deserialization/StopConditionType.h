@@ -7,7 +7,9 @@ enum class StopConditionType
 {
     TuningDuration,
     ConfigurationCount,
-    ConfigurationFraction
+    ConfigurationFraction,
+    Convergence,
+    PredictiveTuningDuration
 };
 
 } // namespace ktt
@@ -128,6 +128,12 @@ void TuningLoader::DeserializeCommands(const std::string& tuningScript)
             auto outputCommand = general.get<OutputCommand>();
             m_Commands.push_back(std::make_unique<OutputCommand>(outputCommand));
         }
+
+        if (general.contains("KernelBinaryCache"))
+        {
+            auto precompileCommand = general.get<PrecompileCommand>();
+            m_Commands.push_back(std::make_unique<PrecompileCommand>(precompileCommand));
+        }
     }
 
     if (!input.contains("KernelSpecification"))
@@ -117,11 +117,25 @@ R"(
                         "enum": [
                             "TuningDuration",
                             "ConfigurationCount",
-                            "ConfigurationFraction"
+                            "ConfigurationFraction",
+                            "Convergence",
+                            "PredictiveTuningDuration"
                         ]
                     },
                     "BudgetValue": {
                         "type": "number"
+                    },
+                    "ImprovementThreshold": {
+                        "type": "number"
+                    },
+                    "TimeWindow": {
+                        "type": "number"
+                    },
+                    "MinimumEvaluations": {
+                        "type": "integer"
+                    },
+                    "SafetyFactor": {
+                        "type": "number"
                     }
                 }
             }
@@ -161,6 +175,18 @@ R"(
                         "JSON",
                         "XML"
                     ]
+                },
+                "KernelBinaryCache": {
+                    "type": "string",
+                    "examples": [
+                        "KernelCache"
+                    ]
+                },
+                "KernelBinaryCacheSize": {
+                    "type": "integer"
+                },
+                "Precompile": {
+                    "type": "boolean"
                 }
             }
         },
@@ -192,7 +218,8 @@ R"(
                     "enum": [
                         "OpenCL",
                         "CUDA",
-                        "Vulkan"
+                        "Vulkan",
+                        "Host"
                     ]
                 },
                 "CompilerOptions": {
@@ -396,7 +423,9 @@ R"(
                                 "enum": [
                                     "AbsoluteDifference",
                                     "SideBySideComparison",
-                                    "SideBySideRelativeComparison"
+                                    "SideBySideRelativeComparison",
+                                    "SampledComparison",
+                                    "BlockChecksumComparison"
                                 ]
                             },
                             "ValidationThreshold": {
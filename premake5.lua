@@ -248,6 +248,11 @@ function linkAllLibraries()
             error("Python installation was not found. Please ensure that paths to Python headers and Python library (including library name) are correctly set in the environment variables under PYTHON_HEADERS and PYTHON_LIB.")
         end
     end
+    
+    -- Sockets used by distributed tuning
+    if os.target() == "windows" then
+        links {"ws2_32"}
+    end
 end
 
 -- Command line arguments definition
@@ -321,6 +326,12 @@ newoption
     description = "Enables compilation of unit tests"
 }
 
+newoption
+{
+    trigger = "benchmarks",
+    description = "Enables compilation of searcher overhead benchmarks"
+}
+
 newoption
 {
     trigger = "no-cuda",
@@ -784,6 +795,8 @@ project "Tests"
         "Libraries/pugixml-1.11.4"
     }
     
+    removefiles {"Tests/TuningLoader/**"}
+    
     if _OPTIONS["no-opencl"] then
         removefiles {"Tests/OpenClEngineTests.cpp", "Tests/Kernels/SimpleOpenClKernel.cl"}
     end
@@ -797,4 +810,76 @@ project "Tests"
     defines {"KTT_LIBRARY", "KTT_TESTS"}
     linkAllLibraries()
     
+if _OPTIONS["tuning-loader"] then
+
+project "TuningLoaderTests"
+    kind "ConsoleApp"
+    
+    files
+    {
+        "Tests/Main.cpp",
+        "Tests/TuningLoader/**",
+        "TuningLoader/**",
+        "Libraries/Catch-2.13.8/**",
+        "Libraries/Json-3.9.1/**",
+        "Libraries/JsonSchemaValidator-2.1.0/**"
+    }
+    
+    removefiles {"TuningLoader/TuningLauncher.cpp"}
+    
+    includedirs
+    {
+        "TuningLoader",
+        "Libraries/Catch-2.13.8",
+        "Libraries/Json-3.9.1",
+        "Libraries/JsonSchemaValidator-2.1.0",
+        "Source"
+    }
+    
+    filter "action:gmake*"
+        buildoptions {"-pthread"}
+        linkoptions {"-pthread"}
+        
+    filter {}
+    
+    links {"ktt"}
+    
+end -- _OPTIONS["tuning-loader"]
+    
 end -- _OPTIONS["tests"]
+
+-- Benchmarks configuration
+if _OPTIONS["benchmarks"] then
+
+project "SearcherBenchmark"
+    kind "ConsoleApp"
+    
+    files
+    {
+        "Benchmarks/**",
+        "Source/**",
+        "Libraries/CTPL-Ahajha/**",
+        "Libraries/date-3/**",
+        "Libraries/Json-3.9.1/**",
+        "Libraries/pugixml-1.11.4/**"
+    }
+    
+    includedirs
+    {
+        "Source",
+        "Libraries/CTPL-Ahajha",
+        "Libraries/date-3",
+        "Libraries/Json-3.9.1",
+        "Libraries/pugixml-1.11.4"
+    }
+    
+    filter "action:gmake*"
+        buildoptions {"-pthread"}
+        linkoptions {"-pthread"}
+        
+    filter {}
+    
+    defines {"KTT_LIBRARY"}
+    linkAllLibraries()
+    
+end -- _OPTIONS["benchmarks"]